@@ -1392,12 +1392,12 @@ cdef class DynSSSP(SSSP):
 
 cdef extern from "cpp/distance/BFS.h":
 	cdef cppclass _BFS "NetworKit::BFS"(_SSSP):
-		_BFS(_Graph G, node source, bool storePaths, bool storeNodesSortedByDistance, node target) except +
+		_BFS(_Graph G, node source, bool storePaths, bool storeNodesSortedByDistance, node target, bool directionOptimizing) except +
 
 cdef class BFS(SSSP):
 	""" Simple breadth-first search on a Graph from a given source
 
-	BFS(G, source, [storePaths], [storeNodesSortedByDistance], target)
+	BFS(G, source, [storePaths], [storeNodesSortedByDistance], target, [directionOptimizing])
 
 	Create BFS for `G` and source node `source`.
 
@@ -1411,11 +1411,13 @@ cdef class BFS(SSSP):
 		store paths and number of paths?
 	target: node
 		terminate search when the target has been reached
+	directionOptimizing : bool
+		use a parallel direction-optimizing search if neither paths nor a target are requested
 	"""
 
-	def __cinit__(self, Graph G, source, storePaths=True, storeNodesSortedByDistance=False, target=none):
+	def __cinit__(self, Graph G, source, storePaths=True, storeNodesSortedByDistance=False, target=none, directionOptimizing=False):
 		self._G = G
-		self._this = new _BFS(G._this, source, storePaths, storeNodesSortedByDistance, target)
+		self._this = new _BFS(G._this, source, storePaths, storeNodesSortedByDistance, target, directionOptimizing)
 
 cdef extern from "cpp/distance/DynBFS.h":
 	cdef cppclass _DynBFS "NetworKit::DynBFS"(_DynSSSP):
@@ -2396,6 +2398,62 @@ cdef class MocnikGenerator(StaticGraphGenerator):
 		else:
 			pass
 
+cdef extern from "cpp/generators/GIRGGenerator.h":
+	cdef cppclass _GIRGGenerator "NetworKit::GIRGGenerator"(_StaticGraphGenerator):
+		_GIRGGenerator(count n, count dimension, double avgDegree, double exponent, double T) except +
+		vector[double] getWeights() except +
+		vector[double] getPositions() except +
+		double getScaling() except +
+
+cdef class GIRGGenerator(StaticGraphGenerator):
+	"""
+	Creates geometric inhomogeneous random graphs (GIRGs) on the d-dimensional torus, see
+	Bringmann, Keusch and Lengler: "Geometric inhomogeneous random graphs", Theoretical
+	Computer Science 760 (2019).
+
+	Every node gets a power-law distributed weight and a uniformly random position. Two nodes
+	are adjacent if the volume of the ball around one of them reaching the other one is at most
+	c w_u w_v / W (T = 0), otherwise with a probability decreasing with this volume (0 < T < 1).
+	The expected running time is linear in the size of the graph.
+
+	GIRGGenerator(n, dimension=1, avgDegree=10, exponent=2.5, T=0)
+
+	Parameters
+	----------
+	n : count
+		Number of nodes.
+	dimension : count
+		Dimension of the torus.
+	avgDegree : double
+		Expected average degree.
+	exponent : double
+		Exponent of the power-law distribution of the weights, must be > 2.
+	T : double
+		Temperature, 0 for the threshold variant, otherwise in (0, 1).
+	"""
+
+	def __cinit__(self, count n, count dimension=1, double avgDegree=10, double exponent=2.5, double T=0):
+		self._this = new _GIRGGenerator(n, dimension, avgDegree, exponent, T)
+
+	def getWeights(self):
+		"""
+		Returns the weights of the nodes of the last generated graph.
+		"""
+		return (<_GIRGGenerator*>(self._this)).getWeights()
+
+	def getPositions(self):
+		"""
+		Returns the positions of the nodes of the last generated graph, the i-th coordinate
+		of node v is at index v * dimension + i.
+		"""
+		return (<_GIRGGenerator*>(self._this)).getPositions()
+
+	def getScaling(self):
+		"""
+		Returns the scaling constant c of the last generated graph.
+		"""
+		return (<_GIRGGenerator*>(self._this)).getScaling()
+
 cdef extern from "cpp/generators/MocnikGeneratorBasic.h":
 	cdef cppclass _MocnikGeneratorBasic "NetworKit::MocnikGeneratorBasic"(_StaticGraphGenerator):
 		_MocnikGeneratorBasic(count dim, count n, double k) except +
@@ -3049,6 +3107,22 @@ cdef class GraphToolBinaryReader(GraphReader):
 	def __cinit__(self):
 		self._this = new _GraphToolBinaryReader()
 
+cdef extern from "cpp/io/NetworKitBinaryReader.h":
+	cdef cppclass _NetworKitBinaryReader "NetworKit::NetworKitBinaryReader" (_GraphReader):
+		_NetworKitBinaryReader(bool verifyChecksum) except +
+
+cdef class NetworKitBinaryReader(GraphReader):
+	""" Reads graphs written by NetworKitBinaryWriter. The file is memory mapped and copied into the
+		graph in parallel without parsing, so the graph needs as much memory as one read from any other format.
+
+		Parameters
+		----------
+		verifyChecksum : bool
+			If true, the checksum of the file is verified before reading.
+	"""
+	def __cinit__(self, verifyChecksum = True):
+		self._this = new _NetworKitBinaryReader(verifyChecksum)
+
 cdef extern from "cpp/io/ThrillGraphBinaryReader.h":
 	cdef cppclass _ThrillGraphBinaryReader "NetworKit::ThrillGraphBinaryReader" (_GraphReader):
 		_ThrillGraphBinaryReader(count n) except +
@@ -3205,6 +3279,25 @@ cdef class GraphToolBinaryWriter:
 			self._this.write(G._this, cpath)
 
 
+cdef extern from "cpp/io/NetworKitBinaryWriter.h":
+	cdef cppclass _NetworKitBinaryWriter "NetworKit::NetworKitBinaryWriter":
+		_NetworKitBinaryWriter() except +
+		void write(_Graph G, string path) nogil except +
+
+
+cdef class NetworKitBinaryWriter:
+	""" Writes graphs in the NetworKit binary format which NetworKitBinaryReader loads without parsing.
+		Weights, edge ids and deleted nodes are preserved. The file is written sequentially by one thread.
+	"""
+	cdef _NetworKitBinaryWriter _this
+
+	def write(self, Graph G not None, path):
+		 # string needs to be converted to bytes, which are coerced to std::string
+		cdef string cpath = stdstring(path)
+		with nogil:
+			self._this.write(G._this, cpath)
+
+
 cdef extern from "cpp/io/DotGraphWriter.h":
 	cdef cppclass _DotGraphWriter "NetworKit::DotGraphWriter":
 		_DotGraphWriter() except +
@@ -4694,6 +4787,40 @@ cdef class PLM(CommunityDetector):
 	def prolong(Graph Gcoarse, Partition zetaCoarse, Graph Gfine, vector[node] nodeToMetaNode):
 		return Partition().setThis(PLM_prolong(Gcoarse._this, zetaCoarse._this, Gfine._this, nodeToMetaNode))
 
+cdef extern from "cpp/community/ParallelLeiden.h":
+	cdef cppclass _ParallelLeiden "NetworKit::ParallelLeiden"(_CommunityDetectionAlgorithm):
+		_ParallelLeiden(_Graph _G, double gamma, count iterations, count maxIter) except +
+		map[string, vector[count]] getTiming() except +
+
+
+cdef class ParallelLeiden(CommunityDetector):
+	""" Parallel Leiden method - a multi-level modularity maximizer that, unlike PLM,
+		refines the communities before contracting them, so every community is connected.
+
+		Parameters
+		----------
+		G : Graph
+			A graph.
+		gamma : double
+			Multi-resolution modularity parameter:
+			1.0 -> standard modularity
+	 		0.0 -> one community
+	 		2m 	-> singleton communities
+		iterations : count
+			maximum number of passes over all levels
+		maxIter : count
+			maximum number of iterations for move phase
+	"""
+
+	def __cinit__(self, Graph G not None, gamma=1.0, iterations=3, maxIter=32):
+		self._G = G
+		self._this = new _ParallelLeiden(G._this, gamma, iterations, maxIter)
+
+	def getTiming(self):
+		"""  Get detailed time measurements per level.
+		"""
+		return (<_ParallelLeiden*>(self._this)).getTiming()
+
 cdef extern from "cpp/community/CutClustering.h":
 	cdef cppclass _CutClustering "NetworKit::CutClustering"(_CommunityDetectionAlgorithm):
 		_CutClustering(_Graph _G) except +
@@ -7172,12 +7299,12 @@ cdef class ApproxCloseness(Centrality):
 
 cdef extern from "cpp/centrality/PageRank.h":
 	cdef cppclass _PageRank "NetworKit::PageRank" (_Centrality):
-		_PageRank(_Graph, double damp, double tol) except +
+		_PageRank(_Graph, double damp, double tol, bool gaussSeidel) except +
 
 cdef class PageRank(Centrality):
 	"""	Compute PageRank as node centrality measure.
 
-	PageRank(G, damp=0.85, tol=1e-9)
+	PageRank(G, damp=0.85, tol=1e-9, gaussSeidel=False)
 
 	Parameters
 	----------
@@ -7186,12 +7313,17 @@ cdef class PageRank(Centrality):
 	damp : double
 		Damping factor of the PageRank algorithm.
 	tol : double, optional
-		Error tolerance for PageRank iteration.
+		Error tolerance for PageRank iteration, bounds the L1 distance between consecutive iterations.
+		Before, it bounded the L2 distance; the L1 distance is larger, so the same tolerance needs more
+		iterations (about 1.8 times as many on a hyperbolic graph with 2M nodes). Pass a larger tolerance
+		for the previous running time.
+	gaussSeidel : bool, optional
+		Update the scores in place, which usually needs fewer iterations.
 	"""
 
-	def __cinit__(self, Graph G, double damp=0.85, double tol=1e-9):
+	def __cinit__(self, Graph G, double damp=0.85, double tol=1e-9, bool gaussSeidel=False):
 		self._G = G
-		self._this = new _PageRank(G._this, damp, tol)
+		self._this = new _PageRank(G._this, damp, tol, gaussSeidel)
 
 
 
@@ -8095,12 +8227,28 @@ cdef class GraphCoarsening(Algorithm):
 
 cdef extern from "cpp/coarsening/ParallelPartitionCoarsening.h":
 	cdef cppclass _ParallelPartitionCoarsening "NetworKit::ParallelPartitionCoarsening"(_GraphCoarsening):
-		_ParallelPartitionCoarsening(_Graph, _Partition, bool) except +
+		_ParallelPartitionCoarsening(_Graph, _Partition) except +
 
 
 cdef class ParallelPartitionCoarsening(GraphCoarsening):
-	def __cinit__(self, Graph G not None, Partition zeta not None, useGraphBuilder = True):
-		self._this = new _ParallelPartitionCoarsening(G._this, zeta._this, useGraphBuilder)
+	"""Contracts every subset of a partition into a supernode.
+
+	ParallelPartitionCoarsening(G, zeta)
+
+	Parameters
+	----------
+	G : Graph
+		The graph to coarsen.
+	zeta : Partition
+		The partition whose subsets become the supernodes.
+	useGraphBuilder : bool, optional
+		DEPRECATED: Without effect, all coarse graphs are built from the aggregated edges of the supernodes.
+	"""
+	def __cinit__(self, Graph G not None, Partition zeta not None, useGraphBuilder = None):
+		if useGraphBuilder is not None:
+			from warnings import warn
+			warn("The parameter useGraphBuilder of ParallelPartitionCoarsening is deprecated and has no effect.", DeprecationWarning)
+		self._this = new _ParallelPartitionCoarsening(G._this, zeta._this)
 
 cdef extern from "cpp/coarsening/MatchingCoarsening.h":
 	cdef cppclass _MatchingCoarsening "NetworKit::MatchingCoarsening"(_GraphCoarsening):
@@ -8156,6 +8304,37 @@ cdef class PageRankNibble:
 		"""
 		return self._this.run(seeds)
 
+cdef extern from "cpp/scd/BatchApproximatePageRank.h":
+	cdef cppclass _BatchApproximatePageRank "NetworKit::BatchApproximatePageRank"(_Algorithm):
+		_BatchApproximatePageRank(_Graph G, vector[node] seeds, double alpha, double epsilon, count k) except +
+		vector[vector[pair[node, double]]] getTopNodes() except +
+
+cdef class BatchApproximatePageRank(Algorithm):
+	"""
+	Computes the approximate PageRank vectors of many seeds in parallel and keeps the k nodes with the
+	highest approximate PageRank of every seed.
+
+	Parameters:
+	-----------
+	G : graph for which the approximate PageRank vectors are computed.
+	seeds : the seed node ids.
+	alpha : Loop probability of random walk.
+	epsilon: Tolerance threshold for approximation of PageRank vectors
+	k : Number of nodes to keep per seed.
+	"""
+	cdef Graph _G
+
+	def __cinit__(self, Graph G not None, vector[node] seeds, double alpha, double epsilon=1e-12, count k=10):
+		self._G = G
+		self._this = new _BatchApproximatePageRank(G._this, seeds, alpha, epsilon, k)
+
+	def getTopNodes(self):
+		"""
+		Returns, for every seed in the order of the seeds, a list of (node, approximate PageRank) pairs of
+		the at most k nodes with the highest positive approximate PageRank, in decreasing order of it.
+		"""
+		return (<_BatchApproximatePageRank*>(self._this)).getTopNodes()
+
 cdef extern from "cpp/scd/GCE.h":
 	cdef cppclass _GCE "NetworKit::GCE":
 		_GCE(_Graph G, string quality) except +
@@ -25,12 +25,21 @@ namespace NetworKit {
 #endif
 	typedef uint64_t count; // more expressive name for an integer quantity
 	typedef ttmath::Big<TTMATH_BITS(64),TTMATH_BITS(64)> bigfloat;	// big floating point number
+#ifdef NETWORKIT_NODE32
+	// node indices are 0-based, 32 bit ids halve the size of adjacency arrays and of Partition;
+	// the subset ids of Cover are indices and stay 64 bit
+	typedef uint32_t node;
+#else
 	typedef index node; // node indices are 0-based
+#endif
 	typedef double edgeweight; // edge weight type
 	typedef index edgeid;	// edge id
 
 	/** Constants **/
-	constexpr index none = std::numeric_limits<index>::max(); // value for not existing nodes/edges
+	// value for not existing nodes
+	constexpr node none = std::numeric_limits<node>::max();
+	// value for not existing edge ids, subset ids and other indices; differs from none for 32 bit node ids
+	constexpr index noneIndex = std::numeric_limits<index>::max();
 	constexpr edgeweight defaultEdgeWeight = 1.0;
 	constexpr edgeweight nullWeight = 0.0;
 }
@@ -0,0 +1,88 @@
+/*
+ * AtomicBitmap.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef ATOMICBITMAP_H_
+#define ATOMICBITMAP_H_
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "../Globals.h"
+
+namespace Aux {
+
+/**
+ * Bitmap over the elements [0, n) whose bits can be set by many threads at once. claim() is cheap if
+ * the bit is already set, since it only does the atomic read-modify-write otherwise. All operations are
+ * relaxed, so the bitmap only decides which thread claims an element; it does not order other data.
+ */
+class AtomicBitmap {
+public:
+	/**
+	 * Creates a bitmap of @a n cleared bits.
+	 */
+	explicit AtomicBitmap(uint64_t n = 0) : words((n + 63) / 64) {
+		for (auto& word : words) {
+			word.store(0, std::memory_order_relaxed);
+		}
+	}
+
+	/**
+	 * Sets the bit of @a i.
+	 * @return true if the bit of @a i was not set before, i.e. exactly one of the threads that claim
+	 * @a i at the same time gets true.
+	 */
+	bool claim(uint64_t i) {
+		const uint64_t bit = uint64_t(1) << (i % 64);
+		std::atomic<uint64_t>& word = words[i / 64];
+		if (word.load(std::memory_order_relaxed) & bit) {
+			return false;
+		}
+		return !(word.fetch_or(bit, std::memory_order_relaxed) & bit);
+	}
+
+	/**
+	 * @return true if the bit of @a i is set.
+	 */
+	bool test(uint64_t i) const {
+		return (words[i / 64].load(std::memory_order_relaxed) >> (i % 64)) & 1;
+	}
+
+	/**
+	 * Clears the whole words containing the bits of @a elements in parallel; the other bits of these
+	 * words have to be cleared as well, e.g. because only @a elements have been claimed.
+	 */
+	template<typename T>
+	void clearWordsOf(const std::vector<T>& elements) {
+		#pragma omp parallel for
+		for (NetworKit::omp_index i = 0; i < static_cast<NetworKit::omp_index>(elements.size()); ++i) {
+			words[elements[i] / 64].store(0, std::memory_order_relaxed);
+		}
+	}
+
+	/**
+	 * @return The number of words of 64 bits, bit b of word w belongs to element 64 * w + b.
+	 */
+	uint64_t numberOfWords() const {
+		return words.size();
+	}
+
+	uint64_t loadWord(uint64_t w) const {
+		return words[w].load(std::memory_order_relaxed);
+	}
+
+	void storeWord(uint64_t w, uint64_t value) {
+		words[w].store(value, std::memory_order_relaxed);
+	}
+
+private:
+	std::vector<std::atomic<uint64_t> > words;
+};
+
+} // namespace Aux
+
+#endif /* ATOMICBITMAP_H_ */
@@ -0,0 +1,97 @@
+/*
+ * ConcurrentWorklist.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef CONCURRENTWORKLIST_H_
+#define CONCURRENTWORKLIST_H_
+
+#include <omp.h>
+#include <vector>
+
+#include "AtomicBitmap.h"
+
+namespace Aux {
+
+/**
+ * Worklist of elements in [0, n) that are processed in rounds, e.g. the active nodes of label propagation.
+ * While the elements of the current round are processed in parallel, the threads collect the elements of
+ * the next round in local buffers. pushOnce() claims the elements in a bitmap first, so every element is
+ * inserted into the next round at most once.
+ */
+template<typename T>
+class ConcurrentWorklist {
+public:
+	/**
+	 * @param n Upper bound of the elements, may be 0 if only push() is used.
+	 * @param threads Maximum number of threads that insert elements.
+	 */
+	ConcurrentWorklist(uint64_t n, int threads = omp_get_max_threads()) : queued(n), next(threads) {
+	}
+
+	/**
+	 * @return The elements of the current round; they may also be modified, e.g. to insert the elements of the first round.
+	 */
+	std::vector<T>& current() {
+		return items;
+	}
+
+	const std::vector<T>& current() const {
+		return items;
+	}
+
+	bool empty() const {
+		return items.empty();
+	}
+
+	/**
+	 * Prepares the worklist for up to @a threads threads that insert elements.
+	 */
+	void setNumberOfThreads(int threads) {
+		next.resize(threads);
+	}
+
+	/**
+	 * Inserts @a v into the next round; must be called by OpenMP thread omp_get_thread_num().
+	 */
+	void push(T v) {
+		next[omp_get_thread_num()].push_back(v);
+	}
+
+	/**
+	 * Inserts @a v into the next round unless it is already part of it.
+	 * @return true if @a v has been inserted.
+	 */
+	bool pushOnce(T v) {
+		if (queued.claim(v)) {
+			push(v);
+			return true;
+		}
+		return false;
+	}
+
+	/**
+	 * Makes the next round the current one; must not be called concurrently with the other methods.
+	 */
+	void advance() {
+		items.clear();
+		for (std::vector<T>& local : next) {
+			items.insert(items.end(), local.begin(), local.end());
+			local.clear();
+		}
+		// only the elements of the new round can have been claimed, so their words can be cleared entirely
+		if (queued.numberOfWords() > 0) {
+			queued.clearWordsOf(items);
+		}
+	}
+
+private:
+	AtomicBitmap queued; //!< elements of the next round inserted by pushOnce()
+	std::vector<T> items;
+	std::vector<std::vector<T> > next;
+};
+
+} // namespace Aux
+
+#endif /* CONCURRENTWORKLIST_H_ */
@@ -0,0 +1,254 @@
+/*
+ * DAryHeap.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef DARYHEAP_H_
+#define DARYHEAP_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Aux {
+
+/**
+ * Addressable d-ary min-heap with extract-min and change-key.
+ * The type Value takes on integer values between 0 and capacity-1; a position map
+ * of that size locates each value in the heap, so no memory is allocated per operation.
+ * O(log_D n) for insert/decrease-key, O(D log_D n) for extract-min and increase-key.
+ * Elements are ordered by (key, value) like in Aux::PrioQueue, so ties are broken identically
+ * and the heap is a drop-in replacement for it.
+ */
+template<class Key, class Value, unsigned D = 4>
+class DAryHeap {
+	static_assert(D >= 2, "D has to be at least 2");
+
+private:
+	typedef std::pair<Key, Value> ElemType;
+
+	std::vector<ElemType> heap;
+	std::vector<uint64_t> position; //!< position[v] is the index of value v in heap or absent
+
+	static constexpr uint64_t absent = std::numeric_limits<uint64_t>::max();
+
+	void siftUp(uint64_t i);
+	void siftDown(uint64_t i);
+
+	void place(uint64_t i, const ElemType& elem) {
+		heap[i] = elem;
+		position[elem.second] = i;
+	}
+
+public:
+
+	/**
+	 * Builds priority queue from the vector @a keys, values are indices
+	 * of @a keys. Runs in linear time.
+	 */
+	DAryHeap(const std::vector<Key>& keys);
+
+	/**
+	 * Builds priority queue of the specified capacity @a capacity.
+	 */
+	DAryHeap(uint64_t capacity);
+
+	/**
+	 * Inserts key-value pair; @a value must not be in the queue yet.
+	 */
+	void insert(Key key, Value value);
+
+	/**
+	 * Returns the element with minimum key without removing it.
+	 */
+	const ElemType& peekMin() const {
+		assert(!heap.empty());
+		return heap.front();
+	}
+
+	/**
+	 * Removes the element with minimum key and returns it.
+	 */
+	ElemType extractMin();
+
+	/**
+	 * Modifies entry with value @a value.
+	 * The entry is then set to @a newKey with the same value.
+	 * If the corresponding key is not present, the element will be inserted.
+	 */
+	void changeKey(Key newKey, Value value);
+
+	/**
+	 * Removes key-value pair given by value @a value (if present).
+	 */
+	void remove(Value value);
+
+	/**
+	 * @return True if @a value is currently in the queue.
+	 */
+	bool contains(Value value) const {
+		return value < position.size() && position[value] != absent;
+	}
+
+	/**
+	 * @return Key of @a value which has to be in the queue.
+	 */
+	Key getKey(Value value) const {
+		assert(contains(value));
+		return heap[position[value]].first;
+	}
+
+	/**
+	 * @return Number of elements in PQ.
+	 */
+	uint64_t size() const {
+		return heap.size();
+	}
+
+	bool empty() const {
+		return heap.empty();
+	}
+
+	/**
+	 * Removes all elements in time proportional to the number of elements; the capacity is kept.
+	 */
+	void clear();
+};
+
+template<class Key, class Value, unsigned D>
+constexpr uint64_t DAryHeap<Key, Value, D>::absent;
+
+template<class Key, class Value, unsigned D>
+DAryHeap<Key, Value, D>::DAryHeap(const std::vector<Key>& keys) : position(keys.size()) {
+	heap.reserve(keys.size());
+	for (uint64_t i = 0; i < keys.size(); ++i) {
+		heap.emplace_back(keys[i], i);
+		position[i] = i;
+	}
+	if (heap.size() > 1) {
+		for (uint64_t i = (heap.size() - 2) / D + 1; i-- > 0;) {
+			siftDown(i);
+		}
+	}
+}
+
+template<class Key, class Value, unsigned D>
+DAryHeap<Key, Value, D>::DAryHeap(uint64_t capacity) : position(capacity, absent) {
+}
+
+template<class Key, class Value, unsigned D>
+inline void DAryHeap<Key, Value, D>::siftUp(uint64_t i) {
+	ElemType elem = heap[i];
+	while (i > 0) {
+		uint64_t parent = (i - 1) / D;
+		if (!(elem < heap[parent])) {
+			break;
+		}
+		place(i, heap[parent]);
+		i = parent;
+	}
+	place(i, elem);
+}
+
+template<class Key, class Value, unsigned D>
+inline void DAryHeap<Key, Value, D>::siftDown(uint64_t i) {
+	ElemType elem = heap[i];
+	const uint64_t n = heap.size();
+	while (true) {
+		uint64_t first = D * i + 1;
+		if (first >= n) {
+			break;
+		}
+		uint64_t last = std::min<uint64_t>(first + D, n);
+		uint64_t best = first;
+		for (uint64_t c = first + 1; c < last; ++c) {
+			if (heap[c] < heap[best]) {
+				best = c;
+			}
+		}
+		if (!(heap[best] < elem)) {
+			break;
+		}
+		place(i, heap[best]);
+		i = best;
+	}
+	place(i, elem);
+}
+
+template<class Key, class Value, unsigned D>
+inline void DAryHeap<Key, Value, D>::insert(Key key, Value value) {
+	if (value >= position.size()) {
+		position.resize(std::max<uint64_t>(value + 1, 2 * position.size()), absent);
+	}
+	assert(position[value] == absent);
+	heap.emplace_back(key, value);
+	position[value] = heap.size() - 1;
+	siftUp(heap.size() - 1);
+}
+
+template<class Key, class Value, unsigned D>
+inline std::pair<Key, Value> DAryHeap<Key, Value, D>::extractMin() {
+	assert(!heap.empty());
+	ElemType elem = heap.front();
+	position[elem.second] = absent;
+	if (heap.size() > 1) {
+		place(0, heap.back());
+		heap.pop_back();
+		siftDown(0);
+	} else {
+		heap.pop_back();
+	}
+	return elem;
+}
+
+template<class Key, class Value, unsigned D>
+inline void DAryHeap<Key, Value, D>::changeKey(Key newKey, Value value) {
+	if (!contains(value)) {
+		insert(newKey, value);
+		return;
+	}
+	uint64_t i = position[value];
+	Key oldKey = heap[i].first;
+	heap[i].first = newKey;
+	if (newKey < oldKey) {
+		siftUp(i);
+	} else if (oldKey < newKey) {
+		siftDown(i);
+	}
+}
+
+template<class Key, class Value, unsigned D>
+inline void DAryHeap<Key, Value, D>::remove(Value value) {
+	if (!contains(value)) {
+		return;
+	}
+	uint64_t i = position[value];
+	position[value] = absent;
+	if (i + 1 == heap.size()) {
+		heap.pop_back();
+		return;
+	}
+	ElemType removed = heap[i];
+	place(i, heap.back());
+	heap.pop_back();
+	if (heap[i] < removed) {
+		siftUp(i);
+	} else {
+		siftDown(i);
+	}
+}
+
+template<class Key, class Value, unsigned D>
+inline void DAryHeap<Key, Value, D>::clear() {
+	for (const ElemType& elem : heap) {
+		position[elem.second] = absent;
+	}
+	heap.clear();
+}
+
+} /* namespace Aux */
+#endif /* DARYHEAP_H_ */
@@ -0,0 +1,268 @@
+/*
+ * PairingHeap.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef PAIRINGHEAP_H_
+#define PAIRINGHEAP_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Aux {
+
+/**
+ * Addressable pairing heap with extract-min and change-key.
+ * The type Value takes on integer values between 0 and capacity-1. The heap nodes are
+ * stored in arrays indexed by value, so no memory is allocated per operation.
+ * O(1) insert and (amortized, in practice) decrease-key, O(log n) amortized extract-min.
+ */
+template<class Key, class Value>
+class PairingHeap {
+private:
+	typedef std::pair<Key, Value> ElemType;
+
+	static constexpr uint64_t nil = std::numeric_limits<uint64_t>::max();
+
+	std::vector<Key> keys;
+	std::vector<uint64_t> child; //!< leftmost child
+	std::vector<uint64_t> sibling; //!< right sibling
+	std::vector<uint64_t> prev; //!< left sibling or parent if leftmost child, nil for the root
+	std::vector<bool> inHeap;
+
+	uint64_t root;
+	uint64_t numElements;
+
+	std::vector<uint64_t> pass; //!< buffer for the two-pass pairing, reused between operations
+
+	uint64_t meld(uint64_t a, uint64_t b);
+	uint64_t mergePairs(uint64_t first);
+	void cut(uint64_t v);
+	void grow(uint64_t capacity);
+
+public:
+
+	/**
+	 * Builds priority queue from the vector @a keys, values are indices
+	 * of @a keys.
+	 */
+	PairingHeap(const std::vector<Key>& keys);
+
+	/**
+	 * Builds priority queue of the specified capacity @a capacity.
+	 */
+	PairingHeap(uint64_t capacity);
+
+	/**
+	 * Inserts key-value pair; @a value must not be in the queue yet.
+	 */
+	void insert(Key key, Value value);
+
+	/**
+	 * Returns the element with minimum key without removing it.
+	 */
+	ElemType peekMin() const {
+		assert(numElements > 0);
+		return std::make_pair(keys[root], static_cast<Value>(root));
+	}
+
+	/**
+	 * Removes the element with minimum key and returns it.
+	 */
+	ElemType extractMin();
+
+	/**
+	 * Modifies entry with value @a value.
+	 * The entry is then set to @a newKey with the same value.
+	 * If the corresponding key is not present, the element will be inserted.
+	 */
+	void changeKey(Key newKey, Value value);
+
+	/**
+	 * Removes key-value pair given by value @a value (if present).
+	 */
+	void remove(Value value);
+
+	/**
+	 * @return True if @a value is currently in the queue.
+	 */
+	bool contains(Value value) const {
+		return value < inHeap.size() && inHeap[value];
+	}
+
+	/**
+	 * @return Number of elements in PQ.
+	 */
+	uint64_t size() const {
+		return numElements;
+	}
+
+	bool empty() const {
+		return numElements == 0;
+	}
+
+	/**
+	 * Removes all elements in time proportional to the number of elements; the capacity is kept.
+	 */
+	void clear();
+};
+
+template<class Key, class Value>
+constexpr uint64_t PairingHeap<Key, Value>::nil;
+
+template<class Key, class Value>
+PairingHeap<Key, Value>::PairingHeap(const std::vector<Key>& keys) : root(nil), numElements(0) {
+	grow(keys.size());
+	for (uint64_t i = 0; i < keys.size(); ++i) {
+		insert(keys[i], i);
+	}
+}
+
+template<class Key, class Value>
+PairingHeap<Key, Value>::PairingHeap(uint64_t capacity) : root(nil), numElements(0) {
+	grow(capacity);
+}
+
+template<class Key, class Value>
+void PairingHeap<Key, Value>::grow(uint64_t capacity) {
+	keys.resize(capacity);
+	child.resize(capacity, nil);
+	sibling.resize(capacity, nil);
+	prev.resize(capacity, nil);
+	inHeap.resize(capacity, false);
+}
+
+template<class Key, class Value>
+inline uint64_t PairingHeap<Key, Value>::meld(uint64_t a, uint64_t b) {
+	if (a == nil) return b;
+	if (b == nil) return a;
+	if (keys[b] < keys[a]) {
+		std::swap(a, b);
+	}
+	// b becomes leftmost child of a
+	sibling[b] = child[a];
+	if (child[a] != nil) {
+		prev[child[a]] = b;
+	}
+	prev[b] = a;
+	child[a] = b;
+	sibling[a] = nil;
+	prev[a] = nil;
+	return a;
+}
+
+template<class Key, class Value>
+inline uint64_t PairingHeap<Key, Value>::mergePairs(uint64_t first) {
+	// first pass: meld pairs from left to right
+	pass.clear();
+	while (first != nil) {
+		uint64_t a = first;
+		uint64_t b = sibling[a];
+		if (b == nil) {
+			sibling[a] = nil;
+			prev[a] = nil;
+			pass.push_back(a);
+			break;
+		}
+		first = sibling[b];
+		sibling[a] = sibling[b] = nil;
+		prev[a] = prev[b] = nil;
+		pass.push_back(meld(a, b));
+	}
+	// second pass: meld from right to left
+	uint64_t result = nil;
+	for (auto it = pass.rbegin(); it != pass.rend(); ++it) {
+		result = meld(*it, result);
+	}
+	return result;
+}
+
+template<class Key, class Value>
+inline void PairingHeap<Key, Value>::cut(uint64_t v) {
+	assert(v != root);
+	uint64_t p = prev[v];
+	if (child[p] == v) {
+		child[p] = sibling[v];
+	} else {
+		sibling[p] = sibling[v];
+	}
+	if (sibling[v] != nil) {
+		prev[sibling[v]] = p;
+	}
+	sibling[v] = nil;
+	prev[v] = nil;
+}
+
+template<class Key, class Value>
+inline void PairingHeap<Key, Value>::insert(Key key, Value value) {
+	if (value >= keys.size()) {
+		grow(std::max<uint64_t>(value + 1, 2 * keys.size()));
+	}
+	assert(!inHeap[value]);
+	keys[value] = key;
+	child[value] = sibling[value] = prev[value] = nil;
+	inHeap[value] = true;
+	++numElements;
+	root = meld(root, value);
+}
+
+template<class Key, class Value>
+inline std::pair<Key, Value> PairingHeap<Key, Value>::extractMin() {
+	assert(numElements > 0);
+	uint64_t min = root;
+	root = mergePairs(child[min]);
+	child[min] = nil;
+	inHeap[min] = false;
+	--numElements;
+	return std::make_pair(keys[min], static_cast<Value>(min));
+}
+
+template<class Key, class Value>
+inline void PairingHeap<Key, Value>::changeKey(Key newKey, Value value) {
+	if (!contains(value)) {
+		insert(newKey, value);
+		return;
+	}
+	if (newKey < keys[value]) {
+		keys[value] = newKey;
+		if (value != root) {
+			cut(value);
+			root = meld(root, value);
+		}
+	} else if (keys[value] < newKey) {
+		remove(value);
+		insert(newKey, value);
+	}
+}
+
+template<class Key, class Value>
+inline void PairingHeap<Key, Value>::remove(Value value) {
+	if (!contains(value)) {
+		return;
+	}
+	if (value == root) {
+		extractMin();
+		return;
+	}
+	cut(value);
+	uint64_t subtree = mergePairs(child[value]);
+	child[value] = nil;
+	inHeap[value] = false;
+	--numElements;
+	root = meld(root, subtree);
+}
+
+template<class Key, class Value>
+inline void PairingHeap<Key, Value>::clear() {
+	while (numElements > 0) {
+		extractMin();
+	}
+}
+
+} /* namespace Aux */
+#endif /* PAIRINGHEAP_H_ */
@@ -0,0 +1,157 @@
+/*
+ * RadixPrioQueue.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef RADIXPRIOQUEUE_H_
+#define RADIXPRIOQUEUE_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "RadixHeap.h"
+
+namespace Aux {
+
+/**
+ * Monotone priority queue with extract-min and decrease-key on top of Aux::radixheap.
+ * Keys have to be non-negative (integers or floating point numbers) and no key smaller
+ * than the last extracted one may be inserted, which holds e.g. for Dijkstra's algorithm
+ * with non-negative edge weights. Decrease-key inserts a new entry and the outdated one
+ * is skipped on extraction.
+ * The type Value takes on integer values between 0 and capacity-1.
+ */
+template<class Key, class Value, unsigned Radix = 8>
+class RadixPrioQueue {
+private:
+	typedef std::pair<Key, Value> ElemType;
+	typedef std::pair<uint64_t, Value> RankedElem;
+
+	struct RankExtract {
+		uint64_t operator()(const RankedElem& elem) const {
+			return elem.first;
+		}
+	};
+
+	radixheap<RankedElem, RankExtract, uint64_t, Radix> heap;
+	std::vector<Key> keys; //!< current key of each value
+	std::vector<bool> inQueue;
+	uint64_t numElements;
+
+	/**
+	 * Maps a non-negative key to an unsigned integer of the same order.
+	 * For IEEE floating point numbers the bit pattern of non-negative values is monotone.
+	 */
+	static uint64_t rank(Key key, std::true_type /* floating point */) {
+		assert(key >= 0);
+		double d = static_cast<double>(key) + 0.0; // normalize -0.0
+		uint64_t r;
+		std::memcpy(&r, &d, sizeof(r));
+		return r;
+	}
+
+	static uint64_t rank(Key key, std::false_type /* integral */) {
+		assert(key >= 0);
+		return static_cast<uint64_t>(key);
+	}
+
+	static uint64_t rank(Key key) {
+		return rank(key, std::is_floating_point<Key>());
+	}
+
+public:
+
+	/**
+	 * Builds priority queue of the specified capacity @a capacity.
+	 */
+	RadixPrioQueue(uint64_t capacity) : keys(capacity), inQueue(capacity, false), numElements(0) {
+	}
+
+	/**
+	 * Inserts key-value pair; @a value must not be in the queue yet.
+	 */
+	void insert(Key key, Value value) {
+		if (value >= keys.size()) {
+			keys.resize(std::max<uint64_t>(value + 1, 2 * keys.size()));
+			inQueue.resize(keys.size(), false);
+		}
+		assert(!inQueue[value]);
+		keys[value] = key;
+		inQueue[value] = true;
+		++numElements;
+		heap.push(RankedElem(rank(key), value));
+	}
+
+	/**
+	 * Removes the element with minimum key and returns it.
+	 */
+	ElemType extractMin() {
+		assert(numElements > 0);
+		while (true) {
+			RankedElem top = heap.top();
+			heap.pop();
+			if (inQueue[top.second] && rank(keys[top.second]) == top.first) {
+				inQueue[top.second] = false;
+				--numElements;
+				return ElemType(keys[top.second], top.second);
+			}
+			// outdated entry of a decreased key, skip it
+		}
+	}
+
+	/**
+	 * Sets the key of @a value to @a newKey which must not be larger than its current key.
+	 * If the corresponding key is not present, the element will be inserted.
+	 */
+	void changeKey(Key newKey, Value value) {
+		if (!contains(value)) {
+			insert(newKey, value);
+			return;
+		}
+		assert(!(keys[value] < newKey));
+		if (newKey < keys[value]) {
+			keys[value] = newKey;
+			heap.push(RankedElem(rank(newKey), value));
+		}
+	}
+
+	/**
+	 * @return True if @a value is currently in the queue.
+	 */
+	bool contains(Value value) const {
+		return value < inQueue.size() && inQueue[value];
+	}
+
+	/**
+	 * @return Number of elements in PQ.
+	 */
+	uint64_t size() const {
+		return numElements;
+	}
+
+	bool empty() const {
+		return numElements == 0;
+	}
+
+	/**
+	 * Removes all elements and resets the insertion limit.
+	 */
+	void clear() {
+		while (!heap.empty()) {
+			inQueue[heap.top().second] = false;
+			heap.pop();
+		}
+		heap.clear();
+		numElements = 0;
+	}
+};
+
+} /* namespace Aux */
+#endif /* RADIXPRIOQUEUE_H_ */
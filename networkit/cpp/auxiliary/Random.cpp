@@ -61,6 +61,14 @@ std::mt19937_64& getURNG() {
 	return generator;
 }
 
+std::mt19937_64 getStreamURNG(uint64_t seed, uint64_t stream) {
+	std::seed_seq seq{
+		static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32),
+		static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32)
+	};
+	return std::mt19937_64(seq);
+}
+
 uint64_t integer() {
 	AUX_THREAD_LOCAL static std::uniform_int_distribution<uint64_t> dist{};
 	return dist(getURNG());
@@ -41,6 +41,14 @@ uint64_t getSeed();
  */
 std::mt19937_64& getURNG();
 
+/**
+ * @returns an URNG for the random stream with index @a stream derived from @a seed.
+ * Different streams are independent of each other, so e.g. chunks of a parallel
+ * computation can draw from their own stream and get the same numbers regardless
+ * of the number of threads and the scheduling.
+ */
+std::mt19937_64 getStreamURNG(uint64_t seed, uint64_t stream);
+
 
 /**
  * @returns an integer distributed uniformly in an inclusive range;
@@ -0,0 +1,94 @@
+/*
+ * WeightAccumulator.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef WEIGHTACCUMULATOR_H_
+#define WEIGHTACCUMULATOR_H_
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace Aux {
+
+/**
+ * Sums up weights per key in an open addressing table, e.g. the edge weights per cluster in the
+ * neighborhood of a node. The table is meant to be reused for many neighborhoods: reset() only
+ * clears the occupied slots and the memory is kept, so once the table has grown to the largest
+ * neighborhood no more memory is allocated. Unlike a dense accumulator its size is proportional to
+ * the number of distinct keys, not to the key range.
+ */
+class WeightAccumulator {
+public:
+	/**
+	 * Empties the table and prepares it for at most @a maxKeys distinct keys.
+	 */
+	void reset(uint64_t maxKeys) {
+		for (uint64_t slot : used) {
+			keys[slot] = empty();
+		}
+		used.clear();
+
+		// at most half of the slots are occupied
+		shift = 64 - 4;
+		while ((uint64_t(1) << (64 - shift)) < 2 * maxKeys) {
+			--shift;
+		}
+		mask = (uint64_t(1) << (64 - shift)) - 1;
+		if (keys.size() <= mask) {
+			keys.assign(mask + 1, empty());
+			weights.resize(mask + 1);
+		}
+	}
+
+	/**
+	 * Adds @a weight to the weight of @a key.
+	 */
+	void add(uint64_t key, double weight) {
+		uint64_t slot = (key * 0x9E3779B97F4A7C15ull) >> shift;
+		while (keys[slot] != key) {
+			if (keys[slot] == empty()) {
+				keys[slot] = key;
+				weights[slot] = weight;
+				used.push_back(slot);
+				return;
+			}
+			slot = (slot + 1) & mask;
+		}
+		weights[slot] += weight;
+	}
+
+	/**
+	 * @return The number of distinct keys added since the last reset.
+	 */
+	uint64_t size() const {
+		return used.size();
+	}
+
+	/**
+	 * Calls @a handle(key, weight) for every key in the order in which the keys were added first.
+	 */
+	template<typename L>
+	void forEntries(L handle) const {
+		for (uint64_t slot : used) {
+			handle(keys[slot], weights[slot]);
+		}
+	}
+
+private:
+	static constexpr uint64_t empty() {
+		return std::numeric_limits<uint64_t>::max();
+	}
+
+	std::vector<uint64_t> keys;
+	std::vector<double> weights;
+	std::vector<uint64_t> used; //!< occupied slots in insertion order
+	uint64_t shift = 64 - 4;
+	uint64_t mask = 0;
+};
+
+} // namespace Aux
+
+#endif /* WEIGHTACCUMULATOR_H_ */
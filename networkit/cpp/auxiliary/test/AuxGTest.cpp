@@ -22,6 +22,9 @@
 #include "../Timer.h"
 #include "../MissingMath.h"
 #include "../PrioQueue.h"
+#include "../DAryHeap.h"
+#include "../PairingHeap.h"
+#include "../RadixPrioQueue.h"
 #include "../PrioQueueForInts.h"
 #include "../BucketPQ.h"
 #include "../StringTools.h"
@@ -30,6 +33,7 @@
 #include "../NumberParsing.h"
 #include "../Enforce.h"
 #include "../BloomFilter.h"
+#include "../ConcurrentWorklist.h"
 
 
 TEST_F(AuxGTest, produceRandomIntegers) {
@@ -183,6 +187,102 @@ TEST_F(AuxGTest, testPriorityQueue) {
 	EXPECT_EQ(pq.size(), vec.size() - 5);
 }
 
+/**
+ * Runs a random sequence of insert/decrease-key/extract-min operations on @a pq and
+ * compares every extracted element with a std::set reference.
+ */
+template<class PQ>
+static void checkAddressableQueue(PQ& pq, bool monotone) {
+	const uint64_t n = 500;
+	Aux::Random::setSeed(42, false);
+	std::set<std::pair<double, uint64_t>> reference;
+	std::vector<double> key(n, -1.0);
+	double lastExtracted = 0.0;
+
+	for (uint64_t round = 0; round < 5000; ++round) {
+		uint64_t v = Aux::Random::integer(n - 1);
+		double r = Aux::Random::real(10.0);
+		if (key[v] < 0) {
+			double k = lastExtracted + r;
+			pq.insert(k, v);
+			reference.emplace(k, v);
+			key[v] = k;
+		} else if (r < 5.0) {
+			double k = std::max(lastExtracted, key[v] - r);
+			pq.changeKey(k, v);
+			reference.erase(std::make_pair(key[v], v));
+			reference.emplace(k, v);
+			key[v] = k;
+		} else if (!reference.empty()) {
+			std::pair<double, uint64_t> expected = *reference.begin();
+			std::pair<double, uint64_t> actual = pq.extractMin();
+			EXPECT_EQ(expected.first, actual.first);
+			EXPECT_EQ(1u, reference.erase(actual));
+			key[actual.second] = -1.0;
+			if (monotone) {
+				lastExtracted = actual.first;
+			}
+		}
+		ASSERT_EQ(reference.size(), pq.size());
+	}
+
+	while (!reference.empty()) {
+		EXPECT_EQ(reference.begin()->first, pq.extractMin().first);
+		reference.erase(reference.begin());
+	}
+	EXPECT_TRUE(pq.empty());
+}
+
+TEST_F(AuxGTest, testDAryHeap) {
+	std::vector<double> vec = {0.5, 3.5, 4.5, 2.5, 0.75, 1.5, 8.5, 3.25, 4.75, 5.0, 11.5, 0.25};
+	Aux::DAryHeap<double, uint64_t> heap(vec);
+	EXPECT_EQ(vec.size(), heap.size());
+	EXPECT_EQ(std::make_pair(0.25, uint64_t{11}), heap.extractMin());
+	heap.changeKey(0.1, 6);
+	EXPECT_EQ(std::make_pair(0.1, uint64_t{6}), heap.extractMin());
+	heap.changeKey(20.0, 0);
+	heap.remove(4);
+	EXPECT_EQ(std::make_pair(1.5, uint64_t{5}), heap.extractMin());
+	EXPECT_FALSE(heap.contains(4));
+	EXPECT_EQ(vec.size() - 4, heap.size());
+
+	Aux::DAryHeap<double, uint64_t, 4> quaternary(10);
+	checkAddressableQueue(quaternary, false);
+	Aux::DAryHeap<double, uint64_t, 2> binary(10);
+	checkAddressableQueue(binary, false);
+}
+
+TEST_F(AuxGTest, testPairingHeap) {
+	std::vector<double> vec = {0.5, 3.5, 4.5, 2.5, 0.75, 1.5, 8.5, 3.25, 4.75, 5.0, 11.5, 0.25};
+	Aux::PairingHeap<double, uint64_t> heap(vec);
+	EXPECT_EQ(vec.size(), heap.size());
+	EXPECT_EQ(std::make_pair(0.25, uint64_t{11}), heap.extractMin());
+	heap.changeKey(0.1, 6);
+	EXPECT_EQ(std::make_pair(0.1, uint64_t{6}), heap.extractMin());
+	heap.changeKey(20.0, 0);
+	heap.remove(4);
+	EXPECT_EQ(std::make_pair(1.5, uint64_t{5}), heap.extractMin());
+	EXPECT_FALSE(heap.contains(4));
+	EXPECT_EQ(vec.size() - 4, heap.size());
+
+	Aux::PairingHeap<double, uint64_t> pq(10);
+	checkAddressableQueue(pq, false);
+}
+
+TEST_F(AuxGTest, testRadixPrioQueue) {
+	Aux::RadixPrioQueue<double, uint64_t> pq(10);
+	checkAddressableQueue(pq, true);
+
+	Aux::RadixPrioQueue<uint64_t, uint64_t> ints(4);
+	ints.insert(7, 0);
+	ints.insert(3, 1);
+	ints.insert(5, 2);
+	ints.changeKey(1, 0);
+	EXPECT_EQ(std::make_pair(uint64_t{1}, uint64_t{0}), ints.extractMin());
+	EXPECT_EQ(std::make_pair(uint64_t{3}, uint64_t{1}), ints.extractMin());
+	EXPECT_EQ(1u, ints.size());
+}
+
 TEST_F(AuxGTest, testPrioQueueForIntsWithEmptiness) {
 	// fill vector with priorities
 	std::vector<int64_t> vec = {17, 4, 1, 5, 3, 11, 9, 19, -9, 1, 4, 20, 8, 8};
@@ -557,4 +657,37 @@ TEST_F(AuxGTest, testBloomFilter) {
 	}
 }
 
+TEST_F(AuxGTest, testConcurrentWorklist) {
+	const uint64_t n = 1000;
+	Aux::ConcurrentWorklist<uint64_t> worklist(n);
+	for (uint64_t i = 0; i < n; i += 3) {
+		worklist.current().push_back(i);
+	}
+
+	for (int round = 0; round < 3; ++round) {
+		// every element is pushed by several threads, the next round contains it once
+		const std::vector<uint64_t>& current = worklist.current();
+		#pragma omp parallel for
+		for (NetworKit::omp_index i = 0; i < static_cast<NetworKit::omp_index>(current.size()); ++i) {
+			for (uint64_t d = 0; d < 4; ++d) {
+				worklist.pushOnce((current[i] + d) % n);
+			}
+		}
+		const std::set<uint64_t> expected = [&]() {
+			std::set<uint64_t> elements;
+			for (uint64_t v : current) {
+				for (uint64_t d = 0; d < 4; ++d) {
+					elements.insert((v + d) % n);
+				}
+			}
+			return elements;
+		}();
+		worklist.advance();
+
+		std::vector<uint64_t> next = worklist.current();
+		std::sort(next.begin(), next.end());
+		EXPECT_EQ(std::vector<uint64_t>(expected.begin(), expected.end()), next);
+	}
+}
+
 #endif /*NOGTEST */
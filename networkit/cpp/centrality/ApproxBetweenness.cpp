@@ -9,9 +9,7 @@
 #include "../auxiliary/Random.h"
 #include "../distance/Diameter.h"
 #include "../graph/Sampling.h"
-#include "../distance/Dijkstra.h"
-#include "../distance/BFS.h"
-#include "../distance/SSSP.h"
+#include "../distance/SSSPWorkspace.h"
 #include "../auxiliary/Log.h"
 #include "../auxiliary/SignalHandling.h"
 
@@ -26,6 +24,43 @@ ApproxBetweenness::ApproxBetweenness(const Graph& G, const double epsilon, const
 
 }
 
+namespace {
+
+/**
+ * Samples a shortest path from u to v uniformly at random, walking backwards from v,
+ * and adds @a increment to the scores of its inner nodes.
+ */
+struct PathSampler {
+	node u;
+	node v;
+	double increment;
+	std::vector<double>& scores;
+	std::vector<std::pair<node, double> >& choices; //!< buffer reused between samples
+
+	template<class PathCount>
+	void operator()(const PathCountingSSSP<PathCount>& sssp) {
+		if (sssp.distance(v) == std::numeric_limits<edgeweight>::infinity()) {
+			return; // no path between {u, v} exists
+		}
+		DEBUG("updating estimate for path ", u, " <-> ", v);
+		node t = v;
+		while (t != u)  {
+			// sample z in P_u(t) with probability sigma_uz / sigma_ut
+			choices.clear();
+			sssp.forPredecessorsOf(t, [&](node z, edgeid) {
+				choices.emplace_back(z, sssp.pathRatio(z, t));
+			});
+			node z = Aux::Random::weightedChoice(choices);
+			if (z != u) {
+				scores[z] += increment;
+			}
+			t = z;
+		}
+	}
+};
+
+} /* namespace */
+
 
 void ApproxBetweenness::run() {
 	Aux::SignalHandler handler;
@@ -52,6 +87,9 @@ void ApproxBetweenness::run() {
 	DEBUG("max threads: ", maxThreads);
 	std::vector<std::vector<double> > scorePerThread(maxThreads, std::vector<double>(G.upperNodeIdBound()));
 	DEBUG("score per thread size: ", scorePerThread.size());
+	// thread-local search state, allocated on first use by each thread
+	std::vector<std::unique_ptr<SSSPWorkspace> > workspacePerThread(maxThreads);
+	std::vector<std::vector<std::pair<node, double> > > choicesPerThread(maxThreads);
 	handler.assureRunning();
 	#pragma omp parallel for
 	for (omp_index i = 1; i <= static_cast<omp_index>(r); i++) {
@@ -66,40 +104,14 @@ void ApproxBetweenness::run() {
 			v = Sampling::randomNode(G);
 		} while (v == u);
 
-		// runs faster for unweighted graphs
-		std::unique_ptr<SSSP> sssp;
-		if (G.isWeighted()) {
-			sssp.reset(new Dijkstra(G, u, true, false, v));
-		} else {
-			sssp.reset(new BFS(G, u, true, false, v));
-		}
-		DEBUG("running shortest path algorithm for node ", u);
 		if (!handler.isRunning()) continue;
-		sssp->run();
-		if (!handler.isRunning()) continue;
-		if (sssp->numberOfPaths(v) > 0) { // at least one path between {u, v} exists
-			DEBUG("updating estimate for path ", u, " <-> ", v);
-			// random path sampling and estimation update
-			// node s = v;
-			node t = v;
-			while (t != u)  {
-				// sample z in P_u(t) with probability sigma_uz / sigma_us
-				std::vector<std::pair<node, double> > choices;
-				for (node z : sssp->getPredecessors(t)) {
-					bigfloat tmp = sssp->numberOfPaths(z) / sssp->numberOfPaths(t);
-					double weight;
-					tmp.ToDouble(weight);
-					choices.emplace_back(z, weight); 	// sigma_uz / sigma_us
-				}
-				node z = Aux::Random::weightedChoice(choices);
-				assert (z <= G.upperNodeIdBound());
-				if (z != u) {
-					scorePerThread[thread][z] += 1 / (double) r;
-				}
-				// s = t;
-				t = z;
-			}
+		if (!workspacePerThread[thread]) {
+			workspacePerThread[thread].reset(new SSSPWorkspace(G));
 		}
+		DEBUG("running shortest path algorithm for node ", u);
+		// random path sampling and estimation update
+		PathSampler sampler{u, v, 1 / (double) r, scorePerThread[thread], choicesPerThread[thread]};
+		workspacePerThread[thread]->run(u, sampler, v);
 	}
 	handler.assureRunning();
 
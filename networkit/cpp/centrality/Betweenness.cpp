@@ -5,19 +5,15 @@
  *      Author: cls, ebergamini
  */
 
-#include <stack>
-#include <queue>
 #include <memory>
+#include <stdexcept>
 #include <omp.h>
 
 
 #include "Betweenness.h"
-#include "../auxiliary/PrioQueue.h"
 #include "../auxiliary/Log.h"
 #include "../auxiliary/SignalHandling.h"
-#include "../distance/SSSP.h"
-#include "../distance/Dijkstra.h"
-#include "../distance/BFS.h"
+#include "../distance/SSSPWorkspace.h"
 
 namespace NetworKit {
 
@@ -25,6 +21,42 @@ Betweenness::Betweenness(const Graph& G, bool normalized, bool computeEdgeCentra
 
 }
 
+namespace {
+
+/**
+ * Adds the dependencies of the source s on all other nodes to @a scores (and to @a edgeScores
+ * if not null). @a dependency has to be zero everywhere and is zero again afterwards.
+ */
+struct DependencyAccumulator {
+	node s;
+	std::vector<double>& dependency;
+	std::vector<double>& scores;
+	std::vector<double>* edgeScores;
+
+	template<class PathCount>
+	void operator()(const PathCountingSSSP<PathCount>& sssp) {
+		// compute dependencies for nodes in order of decreasing distance from s
+		const std::vector<node>& sorted = sssp.getNodesSortedByDistance();
+		for (auto it = sorted.rbegin(); it != sorted.rend(); ++it) {
+			node t = *it;
+			const double factor = 1 + dependency[t];
+			sssp.forPredecessorsOf(t, [&](node p, edgeid eid) {
+				double c = sssp.pathRatio(p, t) * factor;
+				dependency[p] += c;
+				if (edgeScores) {
+					(*edgeScores)[eid] += c;
+				}
+			});
+			if (t != s) {
+				scores[t] += dependency[t];
+			}
+			dependency[t] = 0.0;
+		}
+	}
+};
+
+} /* namespace */
+
 void Betweenness::run() {
 	Aux::SignalHandler handler;
 	count z = G.upperNodeIdBound();
@@ -43,46 +75,27 @@ void Betweenness::run() {
 	DEBUG("G.upperEdgeIdBound(): ", G.upperEdgeIdBound());
 	std::vector<std::vector<double> > edgeScorePerThread;
 	if (computeEdgeCentrality) {
+		if (!G.hasEdgeIds()) {
+			throw std::runtime_error("edges have not been indexed - call indexEdges first");
+		}
 		edgeScorePerThread.resize(maxThreads, std::vector<double>(G.upperEdgeIdBound()));
 	}
 	DEBUG("edge score per thread: ", edgeScorePerThread.size());
 
-	auto computeDependencies = [&](node s) {
+	// thread-local search state, allocated on first use by each thread
+	std::vector<std::vector<double> > dependencyPerThread(maxThreads);
+	std::vector<std::unique_ptr<SSSPWorkspace> > workspacePerThread(maxThreads);
 
-		std::vector<double> dependency(z, 0.0);
-
-		// run SSSP algorithm and keep track of everything
-		std::unique_ptr<SSSP> sssp;
-		if (G.isWeighted()) {
-			sssp.reset(new Dijkstra(G, s, true, true));
-		} else {
-			sssp.reset(new BFS(G, s, true, true));
-		}
-		if (!handler.isRunning()) return;
-		sssp->run();
+	auto computeDependencies = [&](node s) {
 		if (!handler.isRunning()) return;
-		// compute dependencies for nodes in order of decreasing distance from s
-		std::vector<node> stack = sssp->getNodesSortedByDistance();
-		while (!stack.empty()) {
-			node t = stack.back();
-			stack.pop_back();
-			for (node p : sssp->getPredecessors(t)) {
-				// workaround for integer overflow in large graphs
-				bigfloat tmp = sssp->numberOfPaths(p) / sssp->numberOfPaths(t);
-				double weight;
-				tmp.ToDouble(weight);
-				double c= weight * (1 + dependency[t]);
-				dependency[p] += c;
-				if (computeEdgeCentrality) {
-					edgeScorePerThread[omp_get_thread_num()][G.edgeId(p,t)] += c;
-				}
-
-
-			}
-			if (t != s) {
-				scorePerThread[omp_get_thread_num()][t] += dependency[t];
-			}
+		const index thread = omp_get_thread_num();
+		if (!workspacePerThread[thread]) {
+			workspacePerThread[thread].reset(new SSSPWorkspace(G));
+			dependencyPerThread[thread].assign(z, 0.0);
 		}
+		DependencyAccumulator accumulator{s, dependencyPerThread[thread], scorePerThread[thread],
+			computeEdgeCentrality ? &edgeScorePerThread[thread] : nullptr};
+		workspacePerThread[thread]->run(s, accumulator);
 	};
 	handler.assureRunning();
 	G.balancedParallelForNodes(computeDependencies);
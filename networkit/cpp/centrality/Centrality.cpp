@@ -7,10 +7,13 @@
 
 #include "Centrality.h"
 #include "../auxiliary/Parallel.h"
+#include "../graph/StaticGraph.h"
+#include "../graph/CompressedGraph.h"
 
 namespace NetworKit {
 
-Centrality::Centrality(const Graph &G, bool normalized,
+template <typename GraphType>
+BasicCentrality<GraphType>::BasicCentrality(const GraphType &G, bool normalized,
                        bool computeEdgeCentrality)
     : Algorithm(), G(G), normalized(normalized),
       computeEdgeCentrality(computeEdgeCentrality) {
@@ -20,13 +23,15 @@ Centrality::Centrality(const Graph &G, bool normalized,
   }
 }
 
-double Centrality::score(node v) {
+template <typename GraphType>
+double BasicCentrality<GraphType>::score(node v) {
   if (!hasRun)
     throw std::runtime_error("Call run method first");
   return scoreData.at(v);
 }
 
-std::vector<std::pair<node, double>> Centrality::ranking() {
+template <typename GraphType>
+std::vector<std::pair<node, double>> BasicCentrality<GraphType>::ranking() {
   if (!hasRun)
     throw std::runtime_error("Call run method first");
   std::vector<std::pair<node, double>> ranking;
@@ -41,25 +46,29 @@ std::vector<std::pair<node, double>> Centrality::ranking() {
   return ranking;
 }
 
-std::vector<double> Centrality::scores(bool moveOut) {
+template <typename GraphType>
+std::vector<double> BasicCentrality<GraphType>::scores(bool moveOut) {
   if (!hasRun)
     throw std::runtime_error("Call run method first");
   hasRun = !moveOut;
   return moveOut ? std::move(scoreData) : scoreData;
 }
 
-std::vector<double> Centrality::edgeScores() {
+template <typename GraphType>
+std::vector<double> BasicCentrality<GraphType>::edgeScores() {
   if (!hasRun)
     throw std::runtime_error("Call run method first");
   return edgeScoreData;
 }
 
-double Centrality::maximum() {
+template <typename GraphType>
+double BasicCentrality<GraphType>::maximum() {
   throw std::runtime_error("Not implemented: Compute the maximum centrality "
                            "score in the respective centrality subclass.");
 }
 
-double Centrality::centralization() {
+template <typename GraphType>
+double BasicCentrality<GraphType>::centralization() {
   if (!hasRun)
     throw std::runtime_error("Call run method first");
   double centerScore = 0.0;
@@ -79,4 +88,8 @@ double Centrality::centralization() {
   return diff1 / diff2;
 }
 
+template class BasicCentrality<Graph>;
+template class BasicCentrality<StaticGraph>;
+template class BasicCentrality<CompressedGraph>;
+
 } /* namespace NetworKit */
@@ -15,9 +15,11 @@ namespace NetworKit {
 
 /**
  * @ingroup centrality
- * Abstract base class for centrality measures.
+ * Abstract base class for centrality measures on graphs of type @a GraphType, which is Graph,
+ * StaticGraph or CompressedGraph. Centrality is the base class for centrality measures on a Graph.
  */
-class Centrality : public Algorithm {
+template<typename GraphType>
+class BasicCentrality : public Algorithm {
 public:
 	/**
 	 * Constructs the Centrality class for the given Graph @a G. If the centrality scores should be normalized,
@@ -27,10 +29,10 @@ public:
 	 * @param normalized If set to @c true the scores are normalized in the interval [0,1].
 	 * @param computeEdgeCentrality		If true, compute also edge centralities (for algorithms where this is applicable)
 	 */
-	Centrality(const Graph& G, bool normalized=false, bool computeEdgeCentrality=false);
+	BasicCentrality(const GraphType& G, bool normalized=false, bool computeEdgeCentrality=false);
 
 	/** Default destructor */
-	virtual ~Centrality() = default;
+	virtual ~BasicCentrality() = default;
 
 	/**
 	 * Computes centrality scores on the graph passed in constructor.
@@ -88,7 +90,7 @@ public:
 
 protected:
 
-	const Graph& G;
+	const GraphType& G;
 	std::vector<double> scoreData;
 	std::vector<double> edgeScoreData;
 	bool normalized; // true if scores should be normalized in the interval [0,1]
@@ -96,6 +98,8 @@ protected:
 
 };
 
+typedef BasicCentrality<Graph> Centrality;
+
 } /* namespace NetworKit */
 
 #endif /* CENTRALITY_H_ */
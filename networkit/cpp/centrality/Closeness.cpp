@@ -5,16 +5,12 @@
  *      Author: nemes
  */
 
-#include <stack>
-#include <queue>
 #include <memory>
+#include <omp.h>
 
 #include "Closeness.h"
-#include "../auxiliary/PrioQueue.h"
 #include "../auxiliary/Log.h"
-#include "../distance/SSSP.h"
-#include "../distance/Dijkstra.h"
-#include "../distance/BFS.h"
+#include "../distance/SSSPWorkspace.h"
 #include "../components/ConnectedComponents.h"
 
 
@@ -35,24 +31,21 @@ void Closeness::run() {
 	count z = G.upperNodeIdBound();
 	scoreData.clear();
 	scoreData.resize(z);
-	edgeweight infDist = std::numeric_limits<edgeweight>::max();
+
+	// thread-local search state, allocated on first use by each thread
+	std::vector<std::unique_ptr<SSSPWorkspace> > workspacePerThread(omp_get_max_threads());
 
 	G.parallelForNodes([&](node s) {
-		std::unique_ptr<SSSP> sssp;
-		if (G.isWeighted()) {
-			sssp.reset(new Dijkstra(G, s, true, true));
-		} else {
-			sssp.reset(new BFS(G, s, true, true));
+		std::unique_ptr<SSSPWorkspace>& workspace = workspacePerThread[omp_get_thread_num()];
+		if (!workspace) {
+			workspace.reset(new SSSPWorkspace(G));
 		}
-		sssp->run();
-
-		std::vector<edgeweight> distances = sssp->getDistances();
+		const auto& sssp = workspace->runDistances(s);
 
+		// only the reached nodes have a finite distance
 		double sum = 0;
-		for (auto dist : distances) {
-			if (dist != infDist ) {
-				sum += dist;
-			}
+		for (node u : sssp.getNodesSortedByDistance()) {
+			sum += sssp.distance(u);
 		}
 		scoreData[s] = 1 / sum;
 
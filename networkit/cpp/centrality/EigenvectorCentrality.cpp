@@ -11,15 +11,14 @@
 namespace NetworKit {
 
 EigenvectorCentrality::EigenvectorCentrality(const Graph& G, double tol):
-		Centrality(G, true), tol(tol)
+		IterativeCentrality(G, true), tol(tol)
 {
 
 }
 
 void EigenvectorCentrality::run() {
-	count z = G.upperNodeIdBound();
-	std::vector<double> values(z, 1.0);
-	scoreData = values;
+	buildTransposedMatrix();
+	initializeScores(1.0);
 
 	double length = 0.0;
 	double oldLength = 0.0;
@@ -32,41 +31,23 @@ void EigenvectorCentrality::run() {
 	do {
 		oldLength = length;
 
-		// iterate matrix-vector product
-		G.parallelForNodes([&](node u) {
-			values[u] = 0.0;
-			G.forInEdgesOf(u, [&](node u, node v, edgeweight ew) {
-				values[u] += ew * scoreData[v];
-			});
-		});
-
-//		// set everything very small to zero
-//		G.parallelForNodes([&](node u) {
-//			if (values[u] < 1e-16) {
-//				values[u] = 0.0;
-//			}
-//		});
-
-		// normalize values
-		length = 0.0;
-		length = G.parallelSumForNodes([&](node u) {
-			return (values[u] * values[u]);
-		});
-		length = sqrt(length);
+		// iterate matrix-vector product, the previous values are normalized on the fly
+		double squaredLength;
+		iterate(oldLength == 0.0 ? 1.0 : 1.0 / oldLength, [](node) {
+			return 0.0;
+		}, squaredLength);
+		length = sqrt(squaredLength);
 
 //		TRACE("length: ", length);
-//		TRACE(values);
 
 		assert(! Aux::NumericTools::equal(length, 1e-16));
-		G.parallelForNodes([&](node u) {
-			values[u] /= length;
-		});
-
-//		TRACE(values);
-
-		scoreData = values;
 	} while (! converged(length, oldLength));
 
+	// normalize values
+	G.parallelForNodes([&](node u) {
+		scoreData[u] /= length;
+	});
+
 	// check sign and correct if necessary
 	if (scoreData[0] < 0) {
 		G.parallelForNodes([&](node u) {
@@ -8,7 +8,7 @@
 #ifndef EIGENVECTORCENTRALITY_H_
 #define EIGENVECTORCENTRALITY_H_
 
-#include "Centrality.h"
+#include "IterativeCentrality.h"
 
 namespace NetworKit {
 
@@ -17,7 +17,7 @@ namespace NetworKit {
  * Computes the leading eigenvector of the graph's adjacency matrix (normalized in 2-norm).
  * Interpreted as eigenvector centrality score.
  */
-class EigenvectorCentrality: public Centrality {
+class EigenvectorCentrality: public IterativeCentrality {
 protected:
 	double tol; // error tolerance
 
@@ -7,9 +7,7 @@
 
 
 #include "EstimateBetweenness.h"
-#include "../distance/BFS.h"
-#include "../distance/Dijkstra.h"
-#include "../distance/SSSP.h"
+#include "../distance/SSSPWorkspace.h"
 #include "../auxiliary/SignalHandling.h"
 #include "../auxiliary/Parallelism.h"
 
@@ -22,6 +20,40 @@ namespace NetworKit {
 EstimateBetweenness::EstimateBetweenness(const Graph& G, count nSamples, bool normalized, bool parallel_flag) : Centrality(G, normalized), nSamples(nSamples), parallel_flag(parallel_flag) {
 }
 
+namespace {
+
+/**
+ * Adds the dependencies of the sampled source s, scaled by the relative distance of the
+ * predecessors, to @a scores. @a dependency has to be zero everywhere and is zero again afterwards.
+ */
+struct ScaledDependencyAccumulator {
+	node s;
+	std::vector<double>& dependency;
+	std::vector<double>& scores;
+
+	template<class PathCount>
+	void operator()(const PathCountingSSSP<PathCount>& sssp) {
+		// nodes in non-decreasing order of distance
+		const std::vector<node>& sorted = sssp.getNodesSortedByDistance();
+		for (auto it = sorted.rbegin(); it != sorted.rend(); ++it) {
+			node t = *it;
+			if (t == s) {
+				dependency[t] = 0.0;
+				continue;
+			}
+			const double factor = 1 + dependency[t];
+			sssp.forPredecessorsOf(t, [&](node p, edgeid) {
+				// TODO: make weighting factor configurable
+				dependency[p] += (double(sssp.distance(p)) / sssp.distance(t)) * sssp.pathRatio(p, t) * factor;
+			});
+			scores[t] += dependency[t];
+			dependency[t] = 0.0;
+		}
+	}
+};
+
+} /* namespace */
+
 void EstimateBetweenness::run() {
 	hasRun = false;
 
@@ -42,41 +74,20 @@ void EstimateBetweenness::run() {
 	std::vector<std::vector<double> > scorePerThread(maxThreads, std::vector<double>(G.upperNodeIdBound()));
 
 
+	// thread-local search state, allocated on first use by each thread
+	std::vector<std::vector<double> > dependencyPerThread(maxThreads);
+	std::vector<std::unique_ptr<SSSPWorkspace> > workspacePerThread(maxThreads);
+
 	auto computeDependencies = [&](node s){
-		// run single-source shortest path algorithm
-		std::unique_ptr<SSSP> sssp;
-		if (G.isWeighted()) {
-			sssp.reset(new Dijkstra(G, s, true, true));
-		} else {
-			sssp.reset(new BFS(G, s, true, true));
-		}
 		if (!handler.isRunning()) return;
-		sssp->run();
-		if (!handler.isRunning()) return;
-
-
-		// create stack of nodes in non-decreasing order of distance
-		std::vector<node> stack = sssp->getNodesSortedByDistance(true);
-
-		// compute dependencies and add the contributions to the centrality score
-		std::vector<double> dependency(G.upperNodeIdBound(), 0.0);
-		for (auto it = stack.rbegin(); it != stack.rend(); ++it) {
-			node t = *it;
-			if (t == s){
-				continue;
-			}
-			for (node p : sssp->getPredecessors(t)) {
-				// TODO: make weighting factor configurable
-
-				// workaround for integer overflow in large graphs
-				bigfloat tmp = sssp->numberOfPaths(p) / sssp->numberOfPaths(t);
-				double weight;
-				tmp.ToDouble(weight);
-
-				dependency[p] += (double(sssp->distance(p)) / sssp->distance(t)) * weight * (1 + dependency[t]);
-			}
-			scorePerThread[omp_get_thread_num()][t] += dependency[t];
+		const index thread = omp_get_thread_num();
+		if (!workspacePerThread[thread]) {
+			workspacePerThread[thread].reset(new SSSPWorkspace(G));
+			dependencyPerThread[thread].assign(G.upperNodeIdBound(), 0.0);
 		}
+		// compute dependencies and add the contributions to the centrality score
+		ScaledDependencyAccumulator accumulator{s, dependencyPerThread[thread], scorePerThread[thread]};
+		workspacePerThread[thread]->run(s, accumulator);
 	};
 
 
@@ -0,0 +1,66 @@
+/*
+ * IterativeCentrality.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include "IterativeCentrality.h"
+#include "../graph/StaticGraph.h"
+#include "../graph/CompressedGraph.h"
+
+namespace NetworKit {
+
+template<typename GraphType>
+BasicIterativeCentrality<GraphType>::BasicIterativeCentrality(const GraphType& G, bool normalized) : BasicCentrality<GraphType>(G, normalized) {
+}
+
+template<typename GraphType>
+void BasicIterativeCentrality<GraphType>::buildTransposedMatrix(std::vector<double> scale) {
+	const count z = G.upperNodeIdBound();
+
+	offsets.assign(z + 1, 0);
+	G.parallelForNodes([&](node u) {
+		offsets[u + 1] = G.degreeIn(u);
+	});
+	for (node u = 0; u < z; ++u) {
+		offsets[u + 1] += offsets[u];
+	}
+
+	columns.resize(offsets[z]);
+	values.resize(G.isWeighted() ? offsets[z] : 0);
+	G.balancedParallelForNodes([&](node u) {
+		index i = offsets[u];
+		G.forInEdgesOf(u, [&](node, node v, edgeweight ew) {
+			columns[i] = v;
+			if (!values.empty()) {
+				values[i] = ew;
+			}
+			++i;
+		});
+	});
+
+	columnScale = std::move(scale);
+	sharedScores.reset();
+	nextScores.resize(z);
+	if (!columnScale.empty()) {
+		scaledScores.resize(z);
+		nextScaledScores.resize(z);
+	}
+}
+
+template<typename GraphType>
+void BasicIterativeCentrality<GraphType>::initializeScores(double value) {
+	scoreData.assign(G.upperNodeIdBound(), 0.0);
+	G.parallelForNodes([&](node u) {
+		scoreData[u] = value;
+		if (!columnScale.empty()) {
+			scaledScores[u] = value * columnScale[u];
+		}
+	});
+}
+
+template class BasicIterativeCentrality<Graph>;
+template class BasicIterativeCentrality<StaticGraph>;
+template class BasicIterativeCentrality<CompressedGraph>;
+
+} /* namespace NetworKit */
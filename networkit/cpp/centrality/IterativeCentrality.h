@@ -0,0 +1,179 @@
+/*
+ * IterativeCentrality.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef ITERATIVECENTRALITY_H_
+#define ITERATIVECENTRALITY_H_
+
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <utility>
+
+#include "Centrality.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup centrality
+ * Abstract base class for centralities that iterate x = factor * A^T x + offset until convergence, where A is the
+ * adjacency matrix of the graph, e.g. PageRank, eigenvector and Katz centrality.
+ *
+ * A^T is stored in CSR format, so an iteration streams over the in-edges of every node without the
+ * indirections of the graph. The columns of A^T can be scaled, e.g. by the inverse out-degrees for PageRank;
+ * the scaled scores are kept next to the scores, so there is no division per edge and unweighted graphs
+ * need no value per edge. An iteration computes the L1 distance to the previous scores and the squared
+ * L2 norm of the new scores in the same pass.
+ *
+ * @a GraphType is Graph, StaticGraph or CompressedGraph, IterativeCentrality is the base class for centralities on a Graph.
+ */
+template<typename GraphType>
+class BasicIterativeCentrality : public BasicCentrality<GraphType> {
+public:
+	/**
+	 * @param G The graph.
+	 * @param normalized If set to @c true the scores are normalized in the interval [0,1].
+	 */
+	BasicIterativeCentrality(const GraphType& G, bool normalized = false);
+
+protected:
+	using BasicCentrality<GraphType>::G;
+	using BasicCentrality<GraphType>::scoreData;
+
+	/**
+	 * Stores the transposed adjacency matrix of G, column v of it is multiplied by @a scale[v] if @a scale is
+	 * not empty.
+	 */
+	void buildTransposedMatrix(std::vector<double> scale = std::vector<double>());
+
+	/**
+	 * Sets the score of every node to @a value, the scores of deleted nodes to 0.
+	 */
+	void initializeScores(double value);
+
+	/**
+	 * Replaces the scores x by factor * A^T x + rowOffset(u) in one synchronous (Jacobi) iteration; the new scores
+	 * are written to a second buffer, which is swapped with the scores afterwards.
+	 *
+	 * @param[out] squaredNorm The squared L2 norm of the new scores.
+	 * @return The L1 distance between the new and the previous scores.
+	 */
+	template<typename F>
+	double iterate(double factor, F rowOffset, double& squaredNorm);
+
+	/**
+	 * Like iterate(), but updates the scores in place (Gauss-Seidel), so every row already uses the new scores
+	 * of the rows processed before it. The threads update the scores asynchronously: the scores the rows read
+	 * are kept in relaxed atomics, so a row reads either the previous or the new score of a row of another
+	 * thread, and the result may differ between runs with more than one thread.
+	 *
+	 * @return The L1 distance between the new and the previous scores.
+	 */
+	template<typename F>
+	double iterateInPlace(double factor, F rowOffset);
+
+	/**
+	 * @return The product of row @a u of the transposed matrix and the vector whose entries are returned by @a x.
+	 */
+	template<typename X>
+	double rowProduct(node u, X x) const {
+		double sum = 0.0;
+		if (values.empty()) {
+			for (index i = offsets[u]; i < offsets[u + 1]; ++i) {
+				sum += x(columns[i]);
+			}
+		} else {
+			for (index i = offsets[u]; i < offsets[u + 1]; ++i) {
+				sum += values[i] * x(columns[i]);
+			}
+		}
+		return sum;
+	}
+
+private:
+	std::vector<index> offsets; //!< start of the row of every node
+	std::vector<node> columns; //!< in-neighbors of the nodes
+	std::vector<double> values; //!< edge weights, empty for unweighted graphs
+	std::vector<double> columnScale; //!< factor of every column, empty if the columns are not scaled
+
+	std::vector<double> nextScores;
+	std::vector<double> scaledScores;
+	std::vector<double> nextScaledScores;
+	std::unique_ptr<std::atomic<double>[]> sharedScores; //!< the scores the rows read in iterateInPlace()
+};
+
+typedef BasicIterativeCentrality<Graph> IterativeCentrality;
+
+template<typename GraphType>
+template<typename F>
+double BasicIterativeCentrality<GraphType>::iterate(double factor, F rowOffset, double& squaredNorm) {
+	const count z = G.upperNodeIdBound();
+	const bool scaled = !columnScale.empty();
+	const std::vector<double>& source = scaled ? scaledScores : scoreData;
+
+	double distance = 0.0;
+	double squares = 0.0;
+	#pragma omp parallel for schedule(guided) reduction(+:distance,squares)
+	for (omp_index i = 0; i < static_cast<omp_index>(z); ++i) {
+		const node u = i;
+		if (!G.hasNode(u)) {
+			continue;
+		}
+		const double x = factor * rowProduct(u, [&](node v) { return source[v]; }) + rowOffset(u);
+		distance += std::abs(x - scoreData[u]);
+		squares += x * x;
+		nextScores[u] = x;
+		if (scaled) {
+			nextScaledScores[u] = x * columnScale[u];
+		}
+	}
+
+	std::swap(scoreData, nextScores);
+	if (scaled) {
+		std::swap(scaledScores, nextScaledScores);
+	}
+	squaredNorm = squares;
+	return distance;
+}
+
+template<typename GraphType>
+template<typename F>
+double BasicIterativeCentrality<GraphType>::iterateInPlace(double factor, F rowOffset) {
+	const count z = G.upperNodeIdBound();
+	const bool scaled = !columnScale.empty();
+	const std::vector<double>& source = scaled ? scaledScores : scoreData;
+
+	if (!sharedScores) {
+		sharedScores.reset(new std::atomic<double>[z]);
+	}
+	#pragma omp parallel for
+	for (omp_index i = 0; i < static_cast<omp_index>(z); ++i) {
+		sharedScores[i].store(source[i], std::memory_order_relaxed);
+	}
+
+	double distance = 0.0;
+	#pragma omp parallel for schedule(guided) reduction(+:distance)
+	for (omp_index i = 0; i < static_cast<omp_index>(z); ++i) {
+		const node u = i;
+		if (!G.hasNode(u)) {
+			continue;
+		}
+		const double x = factor * rowProduct(u, [&](node v) { return sharedScores[v].load(std::memory_order_relaxed); }) + rowOffset(u);
+		distance += std::abs(x - scoreData[u]);
+		scoreData[u] = x;
+		sharedScores[u].store(scaled ? x * columnScale[u] : x, std::memory_order_relaxed);
+	}
+
+	if (scaled) {
+		#pragma omp parallel for
+		for (omp_index i = 0; i < static_cast<omp_index>(z); ++i) {
+			scaledScores[i] = sharedScores[i].load(std::memory_order_relaxed);
+		}
+	}
+	return distance;
+}
+
+} /* namespace NetworKit */
+#endif /* ITERATIVECENTRALITY_H_ */
@@ -44,6 +44,9 @@ void KPathCentrality::run() {
 	count t = 2 * k * k * pow(n, 1 - 2 * alpha) * log(n);
 	std::stack<node> stack;
 	node v;
+	// candidates of the current step, reused between steps
+	std::vector<node> neighbours;
+	std::vector<edgeweight> weights;
 
 	for (index i = 1; i <= t; i++) { // FIXME: int -> count
 		node s = G.randomNode();
@@ -54,9 +57,7 @@ void KPathCentrality::run() {
 
 		while (j <= l) {
 			edgeweight sum = 0;
-			std::vector<node> neighbours;
 			neighbours.clear();
-			std::vector<edgeweight> weights;
 			weights.clear();
 			G.forNeighborsOf(s, [&](node u, edgeweight ew) {
 				if (!explored[u]) {
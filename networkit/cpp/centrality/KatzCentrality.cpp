@@ -11,18 +11,29 @@
 namespace NetworKit {
 
 KatzCentrality::KatzCentrality(const Graph& G, double alpha, double beta, double tol):
-		Centrality(G, true), alpha(alpha), beta(beta), tol(tol)
+		IterativeCentrality(G, true), alpha(alpha), beta(beta), tol(tol)
 {
 
 }
 
 void KatzCentrality::run() {
 	count z = G.upperNodeIdBound();
-	std::vector<double> values(z, 1.0);
-	scoreData = values;
+	buildTransposedMatrix();
+	initializeScores(1.0);
 	double length = 0.0;
 	double oldLength = 0.0;
 
+	// note: inconsistency in definition in Newman's book (Ch. 7) regarding directed graphs
+	// we follow the verbal description, which requires to sum over the incoming edges;
+	// the sum of ew * alpha * (1 + scoreData[v]) splits into a constant per node and a matrix-vector product
+	std::vector<double> offset(z, 0.0);
+	G.parallelForNodes([&](node u) {
+		G.forInEdgesOf(u, [&](node, edgeweight ew) {
+			offset[u] += ew * alpha;
+		});
+		offset[u] += beta;
+	});
+
 	auto converged([&](double val, double other) {
 		// compute residual
 		return (Aux::NumericTools::equal(val, other, tol));
@@ -32,28 +43,14 @@ void KatzCentrality::run() {
 		oldLength = length;
 
 		// iterate matrix-vector product
-		G.parallelForNodes([&](node u) {
-			values[u] = 0.0;
-			// note: inconsistency in definition in Newman's book (Ch. 7) regarding directed graphs
-			// we follow the verbal description, which requires to sum over the incoming edges
-			G.forInEdgesOf(u, [&](node v, edgeweight ew) {
-				values[u] += ew * alpha * (1 + scoreData[v]);
-			});
-//			values[u] *= alpha;
-			values[u] += beta;
-		});
-
-		// normalize values
-		length = 0.0;
-		length = G.parallelSumForNodes([&](node u) {
-			return (values[u] * values[u]);
-		});
-		length = sqrt(length);
+		double squaredLength;
+		iterate(alpha, [&](node u) {
+			return offset[u];
+		}, squaredLength);
+		length = sqrt(squaredLength);
 
 //		TRACE("length: ", length);
-//		TRACE(values);
 
-		scoreData = values;
 		INFO("oldLength: ", oldLength, ", length: ", length);
 	} while (! converged(length, oldLength));
 	
@@ -8,7 +8,7 @@
 #ifndef KATZCENTRALITY_H_
 #define KATZCENTRALITY_H_
 
-#include "Centrality.h"
+#include "IterativeCentrality.h"
 
 namespace NetworKit {
 
@@ -19,7 +19,7 @@ namespace NetworKit {
  * directed graphs; we follow the verbal description, which requires to sum over the incoming
  * edges (as opposed to outgoing ones).
  */
-class KatzCentrality: public Centrality {
+class KatzCentrality: public IterativeCentrality {
 protected:
 	double alpha; // damping
 	double beta; // constant centrality amount
@@ -8,54 +8,55 @@
 #include "PageRank.h"
 #include "../auxiliary/NumericTools.h"
 #include "../auxiliary/SignalHandling.h"
+#include "../graph/StaticGraph.h"
+#include "../graph/CompressedGraph.h"
 
 namespace NetworKit {
 
-NetworKit::PageRank::PageRank(const Graph& G, double damp, double tol):
-		Centrality(G, true), damp(damp), tol(tol)
+template<typename GraphType>
+BasicPageRank<GraphType>::BasicPageRank(const GraphType& G, double damp, double tol, bool gaussSeidel):
+		BasicIterativeCentrality<GraphType>(G, true), damp(damp), tol(tol), gaussSeidel(gaussSeidel)
 {
 
 }
 
-void NetworKit::PageRank::run() {
+template<typename GraphType>
+void BasicPageRank<GraphType>::run() {
 	Aux::SignalHandler handler;
 	count n = G.numberOfNodes();
 	count z = G.upperNodeIdBound();
 	double oneOverN = 1.0 / (double) n;
 	double teleportProb = (1.0 - damp) / (double) n;
-	scoreData.resize(z, oneOverN);
-	std::vector<double> pr = scoreData;
-	bool isConverged = false;
 
-	std::vector<double> deg(z, 0.0);
+	// note: inconsistency in definition in Newman's book (Ch. 7) regarding directed graphs
+	// we follow the verbal description, which requires to sum over the incoming edges,
+	// every node v contributes w / deg[v] of its score over an edge of weight w
+	std::vector<double> inverseDeg(z, 0.0);
 	G.parallelForNodes([&](node u) {
-		deg[u] = (double) G.weightedDegree(u);
+		double deg = G.weightedDegree(u);
+		if (deg != 0.0) {
+			inverseDeg[u] = 1.0 / deg;
+		}
 	});
+	this->buildTransposedMatrix(std::move(inverseDeg));
+	this->initializeScores(oneOverN);
+
+	auto teleport = [&](node) {
+		return teleportProb;
+	};
 
+	bool isConverged = false;
 	while (! isConverged) {
 		handler.assureRunning();
-		G.balancedParallelForNodes([&](node u) {
-			pr[u] = 0.0;
-			G.forInEdgesOf(u, [&](node u, node v, edgeweight w) {
-				// note: inconsistency in definition in Newman's book (Ch. 7) regarding directed graphs
-				// we follow the verbal description, which requires to sum over the incoming edges
-				pr[u] += scoreData[v] * w / deg[v];
-			});
-			pr[u] *= damp;
-			pr[u] += teleportProb;
-		});
-
-		auto converged([&]() {
-			double diff = G.parallelSumForNodes([&](node u) {
-				double d = scoreData[u] - pr[u];
-				return d * d;
-			});
-//			TRACE("sqrt(diff): ", sqrt(diff));
-			return (sqrt(diff) <= tol);
-		});
-
-		isConverged = converged();
-		scoreData = pr;
+		double diff;
+		if (gaussSeidel) {
+			diff = this->iterateInPlace(damp, teleport);
+		} else {
+			double squaredNorm;
+			diff = this->iterate(damp, teleport, squaredNorm);
+		}
+//		TRACE("diff: ", diff);
+		isConverged = (diff <= tol);
 	}
 	handler.assureRunning();
 	// make sure scoreData sums up to 1
@@ -70,8 +71,13 @@ void NetworKit::PageRank::run() {
 	hasRun = true;
 }
 
-double PageRank::maximum() {
+template<typename GraphType>
+double BasicPageRank<GraphType>::maximum() {
 	return 1.0;	// upper bound, could be tighter by assuming e.g. a star graph with n nodes
 }
 
+template class BasicPageRank<Graph>;
+template class BasicPageRank<StaticGraph>;
+template class BasicPageRank<CompressedGraph>;
+
 } /* namespace NetworKit */
@@ -8,7 +8,7 @@
 #ifndef PAGERANK_H_
 #define PAGERANK_H_
 
-#include "Centrality.h"
+#include "IterativeCentrality.h"
 
 namespace NetworKit {
 
@@ -18,11 +18,18 @@ namespace NetworKit {
  * NOTE: There is an inconsistency in the definition in Newman's book (Ch. 7) regarding
  * directed graphs; we follow the verbal description, which requires to sum over the incoming
  * edges (as opposed to outgoing ones).
+ * BasicPageRank also runs on the graph snapshots, see StaticGraph.
  */
-class PageRank: public NetworKit::Centrality {
+template<typename GraphType>
+class BasicPageRank: public NetworKit::BasicIterativeCentrality<GraphType> {
 protected:
+	using BasicIterativeCentrality<GraphType>::G;
+	using BasicIterativeCentrality<GraphType>::scoreData;
+	using BasicIterativeCentrality<GraphType>::hasRun;
+
 	double damp;
 	double tol;
+	bool gaussSeidel;
 
 public:
 	/**
@@ -30,9 +37,14 @@ public:
 	 *
 	 * @param[in] G Graph to be processed.
 	 * @param[in] damp Damping factor of the PageRank algorithm.
-	 * @param[in] tol Error tolerance for PageRank iteration.
+	 * @param[in] tol Error tolerance for PageRank iteration: the iteration stops once the L1 distance between two
+	 * consecutive score vectors is at most @a tol. Before, @a tol bounded the L2 distance, which needs fewer iterations
+	 * for the same @a tol.
+	 * @param[in] gaussSeidel Update the scores in place, so that every node already uses the new scores of the
+	 * nodes processed before it. This usually needs fewer iterations, but the scores depend on the order in
+	 * which the threads process the nodes.
 	 */
-	PageRank(const Graph& G, double damp=0.85, double tol = 1e-8);
+	BasicPageRank(const GraphType& G, double damp=0.85, double tol = 1e-8, bool gaussSeidel = false);
 
 	/**
 	 * Computes page rank on the graph passed in constructor.
@@ -45,5 +57,7 @@ public:
 	virtual double maximum();
 };
 
+typedef BasicPageRank<Graph> PageRank;
+
 } /* namespace NetworKit */
 #endif /* PAGERANK_H_ */
@@ -12,7 +12,7 @@
 #include <stack>
 
 #include "../auxiliary/Log.h"
-#include "../auxiliary/PrioQueue.h"
+#include "../auxiliary/DAryHeap.h"
 #include "../auxiliary/PrioQueueForInts.h"
 #include "../components/ConnectedComponents.h"
 #include "../components/StronglyConnectedComponents.h"
@@ -420,7 +420,7 @@ double TopCloseness::BFScut(node v, double x, bool *visited, count *distances,
 
 void TopCloseness::run() {
   init();
-  Aux::PrioQueue<double, node> top(n); // like in Crescenzi
+  Aux::DAryHeap<double, node> top(n); // like in Crescenzi
   std::vector<bool> toAnalyze(n, true);
   omp_lock_t lock;
   omp_init_lock(&lock);
@@ -442,7 +442,7 @@ void TopCloseness::run() {
       farness[u] = -((double)G.degreeOut(u));
     }
   });
-  Aux::PrioQueue<double, node> Q(farness);
+  Aux::DAryHeap<double, node> Q(farness);
   DEBUG("Done filling the queue");
 
   double kth = std::numeric_limits<double>::max(); // like in Crescenzi
@@ -549,7 +549,7 @@ void TopCloseness::run() {
               trail = 0;
               nMaxFarness = 1;
               if (k > 1) {
-                Aux::PrioQueue<double, node> tmp(n);
+                Aux::DAryHeap<double, node> tmp(n);
                 auto last = top.extractMin();
                 auto next = top.extractMin();
                 maxFarness = last.first;
@@ -473,6 +473,29 @@ TEST_F(CentralityGTest, testPageRankDirected) {
 	EXPECT_NEAR(pr_ranking[0].second, 0.00432, tol);
 }
 
+TEST_F(CentralityGTest, testPageRankGaussSeidel) {
+	SNAPGraphReader reader;
+	Graph G = reader.read("input/wiki-Vote.txt");
+	G.removeNode(G.upperNodeIdBound() - 1);
+
+	PageRank jacobi(G);
+	jacobi.run();
+	std::vector<double> expected = jacobi.scores();
+
+	PageRank gaussSeidel(G, 0.85, 1e-8, true);
+	gaussSeidel.run();
+	std::vector<double> cen = gaussSeidel.scores();
+
+	ASSERT_EQ(expected.size(), cen.size());
+	double sum = 0.0;
+	G.forNodes([&](node u) {
+		EXPECT_NEAR(expected[u], cen[u], 1e-7);
+		sum += cen[u];
+	});
+	EXPECT_NEAR(1.0, sum, 1e-9);
+	EXPECT_EQ(0.0, cen[G.upperNodeIdBound() - 1]);
+}
+
 TEST_F(CentralityGTest, testEigenvectorCentrality) {
 	/* Graph:
 	 0    3   6
@@ -708,6 +731,32 @@ TEST_F(CentralityGTest, testEdgeBetweennessCentrality) {
 	EXPECT_NEAR(6.0, bc[5], tol);
 }
 
+TEST_F(CentralityGTest, testBetweennessManyShortestPaths) {
+	// chain of k diamonds s_0 - {a_1, b_1} - s_1 - ... - s_k, the number of
+	// shortest paths exceeds both 64 bit integers and doubles
+	count k = 1100;
+	Graph G(3 * k + 1);
+	for (index i = 0; i < k; ++i) {
+		node s = 3 * i;
+		G.addEdge(s, s + 1);
+		G.addEdge(s, s + 2);
+		G.addEdge(s + 1, s + 3);
+		G.addEdge(s + 2, s + 3);
+	}
+
+	Betweenness centrality(G);
+	centrality.run();
+	std::vector<double> bc = centrality.scores();
+
+	// s_i separates 3i from 3(k-i) nodes and lies on one of the two shortest paths
+	// between a_i and b_i as well as between a_{i+1} and b_{i+1}
+	for (index i : {1, 500, 1050}) {
+		double separated = 3.0 * i * 3.0 * (k - i);
+		EXPECT_NEAR(2 * (separated + 1), bc[3 * i], 1e-9 * separated);
+		EXPECT_NEAR(bc[3 * i + 1], bc[3 * i + 2], 1e-9 * separated);
+	}
+}
+
 TEST_F(CentralityGTest, debugEdgeBetweennessCentrality) {
 	auto path = "input/PGPgiantcompo.graph";
 	METISGraphReader reader;
@@ -5,7 +5,12 @@
  *      Author: Christian Staudt (christian.staudt@kit.edu)
  */
 
+#include <algorithm>
+#include <omp.h>
+
 #include "GraphCoarsening.h"
+#include "../graph/GraphBuilder.h"
+#include "../auxiliary/WeightAccumulator.h"
 
 namespace NetworKit {
 
@@ -20,6 +25,63 @@ Graph GraphCoarsening::getCoarseGraph() const {
 	return Gcoarsened;
 }
 
+void GraphCoarsening::contract(count numberOfSuperNodes, bool noSelfLoops) {
+	// counting sort of the nodes by supernode, the nodes of a supernode are in increasing order
+	std::vector<index> offsets(numberOfSuperNodes + 1, 0);
+	G.forNodes([&](node u) {
+		assert(nodeMapping[u] < numberOfSuperNodes);
+		++offsets[nodeMapping[u] + 1];
+	});
+	for (index su = 0; su < numberOfSuperNodes; ++su) {
+		offsets[su + 1] += offsets[su];
+	}
+	std::vector<node> members(offsets[numberOfSuperNodes]);
+	{
+		std::vector<index> position(offsets.begin(), offsets.end() - 1);
+		G.forNodes([&](node u) {
+			members[position[nodeMapping[u]]++] = u;
+		});
+	}
+
+	GraphBuilder builder(numberOfSuperNodes, true, false);
+	std::vector<Aux::WeightAccumulator> weights(omp_get_max_threads());
+
+	#pragma omp parallel for schedule(guided)
+	for (omp_index su = 0; su < static_cast<omp_index>(numberOfSuperNodes); ++su) {
+		Aux::WeightAccumulator& superWeights = weights[omp_get_thread_num()];
+		count volume = 0;
+		for (index i = offsets[su]; i < offsets[su + 1]; ++i) {
+			volume += G.degree(members[i]);
+		}
+		superWeights.reset(std::min(volume, numberOfSuperNodes));
+
+		for (index i = offsets[su]; i < offsets[su + 1]; ++i) {
+			const node u = members[i];
+			G.forNeighborsOf(u, [&](node v, edgeweight ew) {
+				const node sv = nodeMapping[v];
+				// edges within su are seen from both ends, count them once
+				if (sv != static_cast<node>(su) || (u >= v && !noSelfLoops)) {
+					superWeights.add(sv, ew);
+				}
+			});
+		}
+
+		std::vector<node> neighbors;
+		std::vector<edgeweight> neighborWeights;
+		neighbors.reserve(superWeights.size());
+		neighborWeights.reserve(superWeights.size());
+		bool selfLoop = false;
+		superWeights.forEntries([&](uint64_t sv, double ew) {
+			neighbors.push_back(sv);
+			neighborWeights.push_back(ew);
+			selfLoop = selfLoop || sv == static_cast<uint64_t>(su);
+		});
+		builder.swapNeighborhood(su, neighbors, neighborWeights, selfLoop);
+	}
+
+	Gcoarsened = builder.toGraph(false);
+}
+
 std::vector<node> GraphCoarsening::getFineToCoarseNodeMapping() const {
 	if(!hasRun) {
 		throw std::runtime_error("Call run()-method first.");
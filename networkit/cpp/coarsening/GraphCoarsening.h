@@ -40,6 +40,17 @@ public:
 	std::map<node, std::vector<node> > getCoarseToFineNodeMapping() const;
 
 protected:
+	/**
+	 * Sets Gcoarsened to the weighted graph in which every node u of G is contracted into the supernode
+	 * nodeMapping[u] < @a numberOfSuperNodes. The weights of the edges between two supernodes are summed
+	 * up, edges within a supernode become a self-loop unless @a noSelfLoops is set.
+	 *
+	 * The supernodes are processed in parallel, each one sums up the edges of its nodes in a hash table of
+	 * the thread, so the memory does not grow with the number of threads and high degree supernodes take
+	 * linear time. The result does not depend on the number of threads.
+	 */
+	void contract(count numberOfSuperNodes, bool noSelfLoops = false);
+
 	const Graph& G;
 	Graph Gcoarsened;
 	std::vector<node> nodeMapping;
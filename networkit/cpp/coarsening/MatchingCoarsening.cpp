@@ -17,7 +17,6 @@ void MatchingCoarsening::run() {
 	count n = G.numberOfNodes();
 	index z = G.upperNodeIdBound();
 	count cn = n - M.size(G);
-	Graph cG(cn, true);
 
 	// compute map: old ID -> new coarse ID
 	index idx = 0;
@@ -39,18 +38,8 @@ void MatchingCoarsening::run() {
 		assert(mapFineToCoarse[v] < cn);
 	});
 
-	G.forNodes([&](node v) { // TODO: difficult in parallel
-		G.forNeighborsOf(v, [&](node u, edgeweight ew) {
-			node cv = mapFineToCoarse[v];
-			node cu = mapFineToCoarse[u];
-			if ((v <= u) && (! noSelfLoops || (cv != cu))) {
-				cG.increaseWeight(cv, cu, ew);
-			}
-		});
-	});
-
-	Gcoarsened = std::move(cG);
 	nodeMapping = std::move(mapFineToCoarse);
+	contract(cn, noSelfLoops);
 
 	hasRun = true;
 }
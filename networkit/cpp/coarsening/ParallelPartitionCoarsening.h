@@ -16,16 +16,27 @@ namespace NetworKit {
 
 /**
  * @ingroup coarsening
+ * Contracts every subset of a partition into a supernode, @see GraphCoarsening::contract.
  */
 class ParallelPartitionCoarsening: public NetworKit::GraphCoarsening {
 public:
-	ParallelPartitionCoarsening(const Graph& G, const Partition& zeta, bool useGraphBuilder = true);
+	/**
+	 * @param G The graph to coarsen.
+	 * @param zeta The partition whose subsets become the supernodes.
+	 */
+	ParallelPartitionCoarsening(const Graph& G, const Partition& zeta);
+
+	/**
+	 * DEPRECATED: @a useGraphBuilder has no effect, all coarse graphs are built from the aggregated edges
+	 * of the supernodes. Use ParallelPartitionCoarsening(G, zeta) instead.
+	 */
+	// [[deprecated("Deprecated: useGraphBuilder has no effect")]]
+	ParallelPartitionCoarsening(const Graph& G, const Partition& zeta, bool useGraphBuilder);
 
 	virtual void run();
 
 private:
 	const Partition& zeta;
-	bool useGraphBuilder;
 };
 
 } /* namespace NetworKit */
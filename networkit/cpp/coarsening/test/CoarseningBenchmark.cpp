@@ -21,38 +21,28 @@ namespace NetworKit {
 
 TEST_F(CoarseningBenchmark, benchmarkCoarsening) {
 	count n = 10000;
-	count redF = 100; // reduction factor
-	count k = n/redF;
 	DEBUG("generating graph with ", n, " nodes");
 	auto gen = ErdosRenyiGenerator(n, 0.05);
 	Graph G = gen.generate();
 
-	DEBUG("generating random partition");
-	ClusteringGenerator clusteringGen;
-	Partition zeta = clusteringGen.makeRandomClustering(G, k);
-
-	//count k = zeta.numberOfSubsets();
-	DEBUG("number of subsets: ", k);
-
-	Aux::Timer timer;
-	INFO("parallel coarsening");
-	timer.start();
-	ParallelPartitionCoarsening coarsening(G, zeta, false);
-	coarsening.run();
-	timer.stop();
-	Graph Gc2 = coarsening.getCoarseGraph();
-	INFO("parallel coarsening: ", timer.elapsedTag());
-	EXPECT_EQ(k, Gc2.numberOfNodes());
-
-	INFO("parallel coarsening using GraphBuilder");
-	timer.start();
-	ParallelPartitionCoarsening gbCoarsening(G, zeta, true);
-	gbCoarsening.run();
-	timer.stop();
-	Graph Gc3 = gbCoarsening.getCoarseGraph();
-	INFO("parallel coarsening: ", timer.elapsedTag());
-	EXPECT_EQ(k, Gc3.numberOfNodes());
-
+	// fine levels as in the first rounds of PLM and coarse levels with high degree supernodes
+	for (count redF : {2, 10, 100}) { // reduction factor
+		count k = n / redF;
+		DEBUG("generating random partition");
+		ClusteringGenerator clusteringGen;
+		Partition zeta = clusteringGen.makeRandomClustering(G, k);
+
+		DEBUG("number of subsets: ", k);
+
+		Aux::Timer timer;
+		timer.start();
+		ParallelPartitionCoarsening coarsening(G, zeta);
+		coarsening.run();
+		timer.stop();
+		Graph Gc = coarsening.getCoarseGraph();
+		INFO("parallel coarsening to ", k, " supernodes: ", timer.elapsedTag());
+		EXPECT_EQ(zeta.numberOfSubsets(), Gc.numberOfNodes());
+	}
 }
 
 
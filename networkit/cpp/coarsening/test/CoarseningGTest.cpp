@@ -7,9 +7,12 @@
 
 #ifndef NOGTEST
 
+#include <map>
+
 #include "CoarseningGTest.h"
 
 #include "../../auxiliary/Log.h"
+#include "../../auxiliary/Random.h"
 #include "../../community/ClusteringGenerator.h"
 #include "../../coarsening/ClusteringProjector.h"
 #include "../../community/GraphClusteringTools.h"
@@ -18,6 +21,7 @@
 #include "../../io/METISGraphReader.h"
 #include "../../matching/LocalMaxMatcher.h"
 #include "../MatchingCoarsening.h"
+#include "../../graph/test/GraphTestUtils.h"
 
 namespace NetworKit {
 
@@ -115,7 +119,7 @@ TEST_F(CoarseningGTest, testParallelPartitionCoarseningOnErdosRenyiWithGraphBuil
 
 
 	DEBUG("coarsening on singleton partition");
-	ParallelPartitionCoarsening coarsening(G, singleton); // uses graph builder by default
+	ParallelPartitionCoarsening coarsening(G, singleton);
 	coarsening.run();
 	Graph Gcon = coarsening.getCoarseGraph();
 
@@ -229,6 +233,57 @@ TEST_F(CoarseningGTest, testParallelPartitionCoarseningOnRealGraphWithGraphBuild
 	});
 }
 
+TEST_F(CoarseningGTest, testParallelPartitionCoarseningEdgeWeights) {
+	Aux::Random::setSeed(42, false);
+	count n = 500;
+	count k = 20;
+	Graph G(n, true);
+	G.forNodes([&](node u) {
+		G.forNodes([&](node v) {
+			if (u <= v && Aux::Random::probability() < 0.05) {
+				G.addEdge(u, v, Aux::Random::probability());
+			}
+		});
+	});
+	ClusteringGenerator clusteringGen;
+	Partition zeta = clusteringGen.makeRandomClustering(G, k);
+
+	ParallelPartitionCoarsening sequential(G, zeta);
+	GraphTestUtils::withThreads(1, [&]() { sequential.run(); });
+	ParallelPartitionCoarsening parallel(G, zeta);
+	GraphTestUtils::withThreads(4, [&]() { parallel.run(); });
+
+	Graph Gseq = sequential.getCoarseGraph();
+	Graph Gpar = parallel.getCoarseGraph();
+	std::vector<node> mapping = parallel.getFineToCoarseNodeMapping();
+	ASSERT_EQ(k, Gpar.numberOfNodes());
+	EXPECT_TRUE(Gpar.checkConsistency());
+	EXPECT_NEAR(G.totalEdgeWeight(), Gpar.totalEdgeWeight(), 1e-9);
+
+	std::map<std::pair<node, node>, edgeweight> expected;
+	G.forEdges([&](node u, node v, edgeweight ew) {
+		node su = std::min(mapping[u], mapping[v]);
+		node sv = std::max(mapping[u], mapping[v]);
+		expected[std::make_pair(su, sv)] += ew;
+	});
+	EXPECT_EQ(expected.size(), Gpar.numberOfEdges());
+	for (auto e : expected) {
+		EXPECT_NEAR(e.second, Gpar.weight(e.first.first, e.first.second), 1e-9);
+	}
+
+	// the result does not depend on the number of threads
+	Gseq.forNodes([&](node u) {
+		std::vector<std::pair<node, edgeweight>> seqEdges, parEdges;
+		Gseq.forNeighborsOf(u, [&](node v, edgeweight ew) {
+			seqEdges.emplace_back(v, ew);
+		});
+		Gpar.forNeighborsOf(u, [&](node v, edgeweight ew) {
+			parEdges.emplace_back(v, ew);
+		});
+		EXPECT_EQ(seqEdges, parEdges);
+	});
+}
+
 TEST_F(CoarseningGTest, testMatchingContractor) {
 	METISGraphReader reader;
 	Graph G = reader.read("input/celegans_metabolic.graph");
@@ -145,8 +145,8 @@ void PLM::run() {
 			return delta;
 		};
 
-		index best = none;
-		index C = none;
+		index best = noneIndex;
+		index C = noneIndex;
 		double deltaBest = -1;
 
 		C = zeta[u];
@@ -184,7 +184,7 @@ void PLM::run() {
 
 		// TRACE("deltaBest=" , deltaBest);
 		if (deltaBest > 0) { // if modularity improvement possible
-			assert (best != C && best != none);// do not "move" to original cluster
+			assert (best != C && best != noneIndex);// do not "move" to original cluster
 
 			zeta[u] = best; // move to best cluster
 			// TRACE("node " , u , " moved");
@@ -12,6 +12,8 @@
 #include "../auxiliary/Log.h"
 #include "../auxiliary/Timer.h"
 #include "../auxiliary/Random.h"
+#include "../auxiliary/WeightAccumulator.h"
+#include "../auxiliary/ConcurrentWorklist.h"
 
 namespace NetworKit {
 
@@ -19,7 +21,7 @@ PLP::PLP(const Graph& G, count theta, count maxIterations) : CommunityDetectionA
 }
 
 
-PLP::PLP(const Graph& G, const Partition baseClustering, count theta) : CommunityDetectionAlgorithm(G, baseClustering), updateThreshold(theta) {
+PLP::PLP(const Graph& G, const Partition baseClustering, count theta) : CommunityDetectionAlgorithm(G, baseClustering), updateThreshold(theta), maxIterations(none) {
 }
 
 void PLP::run() {
@@ -58,15 +60,27 @@ void PLP::run() {
 	 *
 	 * The published termination criterion is: All nodes have got the label of the majority of their neighbors.
 	 * In general this does not work. It was changed to: No label was changed in last iteration.
+	 *
+	 * == Active nodes ==
+	 *
+	 * A node stays active until it has kept its label in an iteration; the neighbors of an updated node become
+	 * active. Every iteration processes a worklist of the active nodes instead of scanning all nodes, see
+	 * Aux::ConcurrentWorklist.
 	 */
 
-	std::vector<bool> activeNodes(z); // record if node must be processed
-	activeNodes.assign(z, true);
+	Aux::ConcurrentWorklist<node> activeNodes(z); // nodes to process in the current iteration
+	G.forNodes([&](node v) {
+		if (G.degree(v) > 0) {
+			activeNodes.current().push_back(v);
+		}
+	});
+
+	std::vector<Aux::WeightAccumulator> labelWeights(omp_get_max_threads());
 
 	Aux::Timer runtime;
 
 	// propagate labels
-	while ((nUpdated > this->updateThreshold)  && (nIterations < maxIterations)) { // as long as a label has changed... or maximum iterations reached
+	while ((nUpdated > this->updateThreshold)  && (nIterations < maxIterations) && !activeNodes.empty()) { // as long as a label has changed... or maximum iterations reached
 		runtime.start();
 		nIterations += 1;
 		DEBUG("[BEGIN] LabelPropagation: iteration #" , nIterations);
@@ -74,37 +88,43 @@ void PLP::run() {
 		// reset updated
 		nUpdated = 0;
 
-		G.balancedParallelForNodes([&](node v){
-			if ((activeNodes[v]) && (G.degree(v) > 0)) {
+		#pragma omp parallel reduction(+:nUpdated)
+		{
+			Aux::WeightAccumulator& weights = labelWeights[omp_get_thread_num()];
+			const std::vector<node>& active = activeNodes.current();
 
-				std::map<label, double> labelWeights; // neighborLabelCounts maps label -> frequency in the neighbors
+			#pragma omp for schedule(guided)
+			for (omp_index i = 0; i < static_cast<omp_index>(active.size()); ++i) {
+				const node v = active[i];
 
 				// weigh the labels in the neighborhood of v
+				weights.reset(G.degree(v));
 				G.forNeighborsOf(v, [&](node w, edgeweight weight) {
-					label lw = result.subsetOf(w);
-					labelWeights[lw] += weight; // add weight of edge {v, w}
+					weights.add(result.subsetOf(w), weight); // add weight of edge {v, w}
 				});
 
-				// get heaviest label
-				label heaviest = std::max_element(labelWeights.begin(),
-								labelWeights.end(),
-								[](const std::pair<label, edgeweight>& p1, const std::pair<label, edgeweight>& p2) {
-									return p1.second < p2.second;})->first;
+				// get heaviest label, the smallest one on ties
+				label heaviest = noneIndex;
+				edgeweight heaviestWeight = 0.0;
+				weights.forEntries([&](label l, edgeweight weight) {
+					if (heaviest == noneIndex || weight > heaviestWeight || (weight == heaviestWeight && l < heaviest)) {
+						heaviest = l;
+						heaviestWeight = weight;
+					}
+				});
 
 				if (result.subsetOf(v) != heaviest) { // UPDATE
-					result.moveToSubset(heaviest,v); //result[v] = heaviest;
-					nUpdated += 1; // TODO: atomic update?
+					result.moveToSubset(heaviest, v); //result[v] = heaviest;
+					nUpdated += 1;
+					activeNodes.pushOnce(v);
 					G.forNeighborsOf(v, [&](node u) {
-						activeNodes[u] = true;
+						activeNodes.pushOnce(u);
 					});
-				} else {
-					activeNodes[v] = false;
 				}
-
-			} else {
-				// node is isolated
 			}
-		});
+		}
+
+		activeNodes.advance();
 
 		// for each while loop iteration...
 
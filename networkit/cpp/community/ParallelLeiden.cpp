@@ -0,0 +1,372 @@
+/*
+ * ParallelLeiden.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include "ParallelLeiden.h"
+#include "PLM.h"
+#include <atomic>
+#include <omp.h>
+#include "../auxiliary/Log.h"
+#include "../auxiliary/Timer.h"
+#include "../auxiliary/SignalHandling.h"
+#include "../auxiliary/ConcurrentWorklist.h"
+
+#include <sstream>
+
+namespace NetworKit {
+
+namespace {
+
+// states of the nodes in the refinement phase
+const uint8_t singleton = 0;	// the node is alone in its subcommunity and may join another one
+const uint8_t joined = 1;		// other nodes have joined the subcommunity of the node, it stays there
+const uint8_t left = 2;			// the node has left its subcommunity, which is empty now
+
+/**
+ * Reads @a x that other threads may write at the same time.
+ */
+template<typename T>
+inline T atomicRead(const T& x) {
+	T value;
+	#pragma omp atomic read
+	value = x;
+	return value;
+}
+
+} // namespace
+
+ParallelLeiden::ParallelLeiden(const Graph& G, double gamma, count iterations, count maxIter) : CommunityDetectionAlgorithm(G), gamma(gamma), iterations(iterations), maxIter(maxIter), total(0.0) {
+
+}
+
+void ParallelLeiden::run() {
+	Aux::SignalHandler handler;
+	DEBUG("calling run method on " , G.toString());
+
+	const count z = G.upperNodeIdBound();
+
+	// init communities to singletons
+	result = Partition(z);
+	result.setUpperBound(z);
+	G.parallelForNodes([&](node u) {
+		result[u] = u;
+	});
+
+	total = G.totalEdgeWeight();
+	affinities.resize(omp_get_max_threads());
+	Aux::Timer timer;
+
+	for (count iteration = 0; iteration < iterations && total > 0; ++iteration) {
+		bool change = false; // indicates whether any node has been moved on any level
+
+		// the graph and communities of the current level and the supernode of every node of G in it
+		const Graph* H = &G;
+		Graph coarse;
+		Partition zeta = result;
+		std::vector<node> superNode(z, none);
+		G.parallelForNodes([&](node u) {
+			superNode[u] = u;
+		});
+
+		while (true) {
+			handler.assureRunning();
+
+			std::vector<double> volNode(H->upperNodeIdBound(), 0.0);
+			H->parallelForNodes([&](node u) {
+				volNode[u] = H->weightedDegree(u) + H->weight(u, u); // consider self-loop twice
+			});
+			std::vector<double> volCommunity(zeta.upperBound(), 0.0);
+			H->parallelForNodes([&](node u) {
+				const double volN = volNode[u];
+				#pragma omp atomic
+				volCommunity[zeta[u]] += volN;
+			});
+
+			timer.start();
+			change = movePhase(*H, zeta, volNode, volCommunity) || change;
+			timer.stop();
+			timing["move"].push_back(timer.elapsedMilliseconds());
+
+			// done once every community is a single node
+			if (zeta.numberOfSubsets() == H->numberOfNodes()) {
+				break;
+			}
+
+			timer.start();
+			Partition refined = refinePhase(*H, zeta, volNode, volCommunity);
+			timer.stop();
+			timing["refine"].push_back(timer.elapsedMilliseconds());
+
+			if (refined.numberOfSubsets() == H->numberOfNodes()) {
+				// no community has well-connected parts to contract, so the levels end here; splitting the
+				// communities into their connected components does not decrease the modularity
+				DEBUG("refinement merged no nodes, splitting the communities into connected components");
+				zeta = splitIntoComponents(*H, zeta);
+				break;
+			}
+
+			timer.start();
+			std::pair<Graph, std::vector<node>> coarsened = PLM::coarsen(*H, refined);
+			const std::vector<node>& mapping = coarsened.second;
+
+			// every supernode starts in the community of its nodes
+			Partition coarseZeta(coarsened.first.upperNodeIdBound());
+			coarseZeta.setUpperBound(zeta.upperBound());
+			H->forNodes([&](node u) {
+				coarseZeta[mapping[u]] = zeta[u];
+			});
+			coarseZeta.compact(true);
+
+			#pragma omp parallel for
+			for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+				if (superNode[u] != none) {
+					superNode[u] = mapping[superNode[u]];
+				}
+			}
+
+			// the graph of the previous level is no longer needed
+			zeta = std::move(coarseZeta);
+			coarse = std::move(coarsened.first);
+			H = &coarse;
+			timer.stop();
+			timing["coarsen"].push_back(timer.elapsedMilliseconds());
+			DEBUG("coarse graph has ", coarse.numberOfNodes(), " nodes and ", coarse.numberOfEdges(), " edges");
+		}
+
+		// unpack the communities of the last level onto G
+		Partition zetaFine(z);
+		zetaFine.setUpperBound(zeta.upperBound());
+		G.parallelForNodes([&](node u) {
+			zetaFine[u] = zeta[superNode[u]];
+		});
+		result = std::move(zetaFine);
+
+		if (!change) {
+			break;
+		}
+	}
+
+	result.compact(true);
+	hasRun = true;
+}
+
+bool ParallelLeiden::movePhase(const Graph& H, Partition& zeta, const std::vector<double>& volNode, std::vector<double>& volCommunity) {
+	const count z = H.upperNodeIdBound();
+	const edgeweight divisor = (2 * total * total); // needed in modularity calculation
+
+	// only the neighbors of moved nodes can move in the next round
+	Aux::ConcurrentWorklist<node> activeNodes(z, affinities.size());
+	activeNodes.current().reserve(H.numberOfNodes());
+	H.forNodes([&](node u) {
+		activeNodes.current().push_back(u);
+	});
+
+	bool moved = false;
+	count iter = 0;
+	while (!activeNodes.empty() && iter < maxIter) {
+		bool movedInRound = false;
+		#pragma omp parallel reduction(||:movedInRound)
+		{
+			Aux::WeightAccumulator& affinity = affinities[omp_get_thread_num()];
+			const std::vector<node>& active = activeNodes.current();
+
+			#pragma omp for schedule(guided)
+			for (omp_index i = 0; i < static_cast<omp_index>(active.size()); ++i) {
+				const node u = active[i];
+				const index C = zeta[u];
+
+				// collect edge weight to neighbor clusters, the own cluster comes first
+				affinity.reset(H.degree(u) + 1);
+				affinity.add(C, 0.0);
+				H.forNeighborsOf(u, [&](node v, edgeweight weight) {
+					if (u != v) {
+						affinity.add(zeta[v], weight);
+					}
+				});
+
+				const double volN = volNode[u];
+				const double volCMinusNode = volCommunity[C] - volN;
+				edgeweight affinityC = 0.0;
+				index best = noneIndex;
+				double deltaBest = 0.0;
+				affinity.forEntries([&](index D, edgeweight affinityD) {
+					if (D == C) {
+						affinityC = affinityD;
+						return;
+					}
+					double delta = (affinityD - affinityC) / total + this->gamma * ((volCMinusNode - volCommunity[D]) * volN) / divisor;
+					if (delta > deltaBest) {
+						deltaBest = delta;
+						best = D;
+					}
+				});
+
+				if (best != noneIndex) { // if modularity improvement possible
+					zeta[u] = best;
+					#pragma omp atomic
+					volCommunity[C] -= volN;
+					#pragma omp atomic
+					volCommunity[best] += volN;
+					movedInRound = true;
+
+					H.forNeighborsOf(u, [&](node v) {
+						if (zeta[v] != best) {
+							activeNodes.pushOnce(v);
+						}
+					});
+				}
+			}
+		}
+
+		activeNodes.advance();
+
+		moved = moved || movedInRound;
+		iter += 1;
+	}
+	if (!activeNodes.empty()) {
+		WARN("move phase aborted after ", maxIter, " iterations");
+	}
+	DEBUG("iterations in move phase: ", iter);
+	return moved;
+}
+
+Partition ParallelLeiden::refinePhase(const Graph& H, const Partition& zeta, const std::vector<double>& volNode, const std::vector<double>& volCommunity) {
+	const count z = H.upperNodeIdBound();
+	const double scale = gamma / (2 * total); // modularity gains are compared times the total edge weight
+
+	// every subcommunity is named after the node it started with
+	Partition refined(z);
+	refined.setUpperBound(z);
+	std::vector<double> volRefined(z, 0.0);
+	std::vector<edgeweight> cutRefined(z, 0.0); // weight of the edges from a subcommunity to the rest of its community
+	std::vector<std::atomic<uint8_t> > state(z);
+
+	H.parallelForNodes([&](node u) {
+		refined[u] = u;
+		volRefined[u] = volNode[u];
+		state[u].store(singleton);
+		H.forNeighborsOf(u, [&](node v, edgeweight weight) {
+			if (u != v && zeta[v] == zeta[u]) {
+				cutRefined[u] += weight;
+			}
+		});
+	});
+
+	// A node only joins a subcommunity that one of its neighbors belongs to, and it only leaves its own
+	// subcommunity if no other node has joined it. The states make both decisions atomic, so that the
+	// subcommunities stay connected while they are built in parallel. The subcommunities, their volumes
+	// and cuts change while they are read, so they are accessed atomically; a value that is outdated
+	// when it is used only leads to a worse choice of the target, or to an aborted move if the target
+	// node has left its subcommunity.
+	#pragma omp parallel
+	{
+		Aux::WeightAccumulator& affinity = affinities[omp_get_thread_num()];
+
+		#pragma omp for schedule(guided)
+		for (omp_index i = 0; i < static_cast<omp_index>(z); ++i) {
+			const node u = i;
+			if (!H.hasNode(u) || state[u].load() != singleton) {
+				continue;
+			}
+
+			// only nodes which are well-connected to the rest of their community are merged
+			const index C = zeta[u];
+			const double volN = volNode[u];
+			if (atomicRead(cutRefined[u]) < scale * volN * (volCommunity[C] - volN)) {
+				continue;
+			}
+
+			affinity.reset(H.degree(u));
+			H.forNeighborsOf(u, [&](node v, edgeweight weight) {
+				if (u != v && zeta[v] == C) {
+					affinity.add(atomicRead(refined[v]), weight);
+				}
+			});
+
+			index best = noneIndex;
+			edgeweight affinityBest = 0.0;
+			double deltaBest = 0.0;
+			affinity.forEntries([&](index D, edgeweight affinityD) {
+				const double volD = atomicRead(volRefined[D]);
+				// the target has to be well-connected as well
+				if (D == u || atomicRead(cutRefined[D]) < scale * volD * (volCommunity[C] - volD)) {
+					return;
+				}
+				const double delta = affinityD - scale * volD * volN;
+				if (delta >= 0 && (best == noneIndex || delta > deltaBest)) {
+					best = D;
+					affinityBest = affinityD;
+					deltaBest = delta;
+				}
+			});
+			if (best == noneIndex) {
+				continue;
+			}
+
+			// leave the own subcommunity unless another node has joined it in the meantime
+			uint8_t expected = singleton;
+			if (!state[u].compare_exchange_strong(expected, left)) {
+				continue;
+			}
+			// join the target unless its node has left it in the meantime
+			uint8_t target = state[best].load();
+			while (target == singleton && !state[best].compare_exchange_weak(target, joined)) {
+			}
+			if (target == left) {
+				state[u].store(singleton);
+				continue;
+			}
+
+			node& subcommunity = refined[u];
+			#pragma omp atomic write
+			subcommunity = best;
+			#pragma omp atomic
+			volRefined[best] += volN;
+			const edgeweight cutChange = atomicRead(cutRefined[u]) - 2 * affinityBest;
+			#pragma omp atomic
+			cutRefined[best] += cutChange;
+		}
+	}
+
+	return refined;
+}
+
+Partition ParallelLeiden::splitIntoComponents(const Graph& H, const Partition& zeta) {
+	Partition components(H.upperNodeIdBound());
+	index next = 0;
+	std::vector<node> stack;
+	H.forNodes([&](node s) {
+		if (components[s] != none) {
+			return;
+		}
+		components[s] = next;
+		stack.push_back(s);
+		while (!stack.empty()) {
+			const node u = stack.back();
+			stack.pop_back();
+			H.forNeighborsOf(u, [&](node v) {
+				if (components[v] == none && zeta[v] == zeta[s]) {
+					components[v] = next;
+					stack.push_back(v);
+				}
+			});
+		}
+		++next;
+	});
+	components.setUpperBound(next);
+	return components;
+}
+
+std::string ParallelLeiden::toString() const {
+	std::stringstream stream;
+	stream << "ParallelLeiden(" << gamma << "," << iterations << ")";
+	return stream.str();
+}
+
+std::map<std::string, std::vector<count> > ParallelLeiden::getTiming() {
+	return timing;
+}
+
+} /* namespace NetworKit */
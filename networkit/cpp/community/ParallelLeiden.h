@@ -0,0 +1,88 @@
+/*
+ * ParallelLeiden.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef PARALLELLEIDEN_H_
+#define PARALLELLEIDEN_H_
+
+#include "CommunityDetectionAlgorithm.h"
+#include "../auxiliary/WeightAccumulator.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup community
+ * Parallel Leiden method - a multi-level modularity maximizer that, unlike PLM, only contracts
+ * well-connected communities.
+ *
+ * Every level moves nodes between communities like PLM, then refines every community: starting from
+ * singletons, nodes of the community merge into subcommunities of their neighbors. The graph is contracted
+ * by the refined subcommunities, and the next level starts from the communities of the move phase.
+ * The subcommunities are connected, so the resulting communities are connected as well.
+ *
+ * The levels are processed in a loop that keeps only the graph of the current level and the supernode of
+ * every node of the input graph, the affinities are summed up in a hash table per thread.
+ */
+class ParallelLeiden: public NetworKit::CommunityDetectionAlgorithm {
+
+public:
+	/**
+	 * @param[in]	G	input graph
+	 * @param[in]	gamma	multi-resolution modularity parameter:
+	 * 							1.0 -> standard modularity
+	 * 							0.0 -> one community
+	 * 							2m 	-> singleton communities
+	 * @param[in]	iterations	maximum number of passes over all levels, every pass starts from the communities of the previous one
+	 * @param[in]	maxIter	maximum number of iterations for move phase
+	 */
+	ParallelLeiden(const Graph& G, double gamma = 1.0, count iterations = 3, count maxIter = 32);
+
+	/**
+	 * Get string representation.
+	 *
+	 * @return String representation of this algorithm.
+	 */
+	std::string toString() const override;
+
+	/**
+	 * Detect communities.
+	 */
+	void run() override;
+
+	/**
+	 * Returns fine-grained running time measurements for algorithm engineering purposes: one entry per
+	 * level for "move", "refine" and "coarsen".
+	 */
+	std::map<std::string, std::vector<count> > getTiming();
+
+private:
+	/**
+	 * Moves the nodes of @a H to the neighboring community with the highest modularity gain until no node
+	 * moves or @a maxIter rounds have passed.
+	 * @return true if any node has been moved.
+	 */
+	bool movePhase(const Graph& H, Partition& zeta, const std::vector<double>& volNode, std::vector<double>& volCommunity);
+
+	/**
+	 * Splits every community of @a zeta into well-connected subcommunities.
+	 */
+	Partition refinePhase(const Graph& H, const Partition& zeta, const std::vector<double>& volNode, const std::vector<double>& volCommunity);
+
+	/**
+	 * @return The connected components of the subgraphs of @a H induced by the communities of @a zeta.
+	 */
+	static Partition splitIntoComponents(const Graph& H, const Partition& zeta);
+
+	double gamma;
+	count iterations;
+	count maxIter;
+	edgeweight total; //!< total edge weight, the same on all levels
+	std::vector<Aux::WeightAccumulator> affinities; //!< affinity to neighboring communities, one table per thread
+	std::map<std::string, std::vector<count> > timing;	 // fine-grained running time measurement
+};
+
+} /* namespace NetworKit */
+
+#endif /* PARALLELLEIDEN_H_ */
@@ -9,6 +9,7 @@
 
 #include "../PLP.h"
 #include "../PLM.h"
+#include "../ParallelLeiden.h"
 #include "../ParallelAgglomerativeClusterer.h"
 #include "../../community/Modularity.h"
 #include "../../community/EdgeCut.h"
@@ -149,6 +150,25 @@ TEST_F(CommunityGTest, testLabelPropagationOnManySmallClusters) {
 
 
 
+TEST_F(CommunityGTest, testLabelPropagationFromBaseClustering) {
+	count n = 1000;
+	count k = 10;
+	ClusteredRandomGraphGenerator graphGen(n, k, 0.5, 0.001);
+	Graph G = graphGen.generate();
+	Partition reference = graphGen.getCommunities();
+
+	// the reference clustering is stable, so no label changes and PLP stops after one iteration
+	PLP lp(G, reference, 0);
+	lp.run();
+	Partition zeta = lp.getPartition();
+
+	EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, zeta));
+	EXPECT_TRUE(GraphClusteringTools::equalClusterings(zeta, reference, G));
+	EXPECT_EQ(1u, lp.numberOfIterations());
+}
+
+
+
 /*
 TEST_F(CommunityGTest, testLouvainParallel2Naive) {
 	count n = 1000;
@@ -225,6 +245,60 @@ TEST_F(CommunityGTest, testDeletedNodesPLM) {
 
 }
 
+TEST_F(CommunityGTest, testParallelLeiden) {
+	METISGraphReader reader;
+	Modularity modularity;
+	Graph G = reader.read("input/PGPgiantcompo.graph");
+
+	G.forNeighborsOf(10, [&](node v) {
+		G.removeEdge(10, v);
+	});
+	G.removeNode(10);
+
+	ParallelLeiden leiden(G);
+	leiden.run();
+	Partition zeta = leiden.getPartition();
+
+	DEBUG("number of clusters: " , zeta.numberOfSubsets());
+	DEBUG("modularity: " , modularity.getQuality(zeta, G));
+	EXPECT_TRUE(GraphClusteringTools::isProperClustering(G, zeta));
+
+	PLM plm(G, false, 1.0);
+	plm.run();
+	EXPECT_GE(modularity.getQuality(zeta, G), modularity.getQuality(plm.getPartition(), G) - 0.01);
+
+	// every community is connected: a search within the community reaches all of its nodes
+	std::vector<count> sizes(zeta.upperBound(), 0);
+	G.forNodes([&](node u) {
+		sizes[zeta[u]]++;
+	});
+	std::vector<bool> visited(G.upperNodeIdBound(), false);
+	G.forNodes([&](node s) {
+		if (visited[s]) {
+			return;
+		}
+		count reached = 1;
+		std::vector<node> stack = {s};
+		visited[s] = true;
+		while (!stack.empty()) {
+			node u = stack.back();
+			stack.pop_back();
+			G.forNeighborsOf(u, [&](node v) {
+				if (!visited[v] && zeta[v] == zeta[s]) {
+					visited[v] = true;
+					reached++;
+					stack.push_back(v);
+				}
+			});
+		}
+		EXPECT_EQ(sizes[zeta[s]], reached);
+	});
+
+	auto timing = leiden.getTiming();
+	EXPECT_GT(timing["move"].size(), 1u);
+	EXPECT_GE(timing["refine"].size(), timing["coarsen"].size());
+}
+
 TEST_F(CommunityGTest, testModularity) {
 
 	count n = 100;
@@ -10,6 +10,7 @@
 #include "ConnectedComponents.h"
 #include "../structures/Partition.h"
 #include "../auxiliary/Log.h"
+#include "../graph/DirectionOptimizingBFS.h"
 
 namespace NetworKit {
 
@@ -24,30 +25,63 @@ void ConnectedComponents::run() {
 	component = Partition(G.upperNodeIdBound(), none);
 	numComponents = 0;
 
+	// the component of a node of maximum degree is most likely the giant one, find it with a parallel
+	// breadth-first search
+	node hub = none;
+	G.forNodes([&](node u) {
+		if (hub == none || G.degree(u) > G.degree(hub)) {
+			hub = u;
+		}
+	});
+	if (hub == none) {
+		hasRun = true;
+		return;
+	}
+	DirectionOptimizingBFS bfs(G);
+	bfs.run(hub);
+	index hubComponent = noneIndex;
+
 	std::queue<node> q;
 
-	// perform breadth-first searches
+	// perform breadth-first searches on the remaining components; the components are numbered in the
+	// order of their smallest nodes, also the one of the hub
 	G.forNodes([&](node u) {
-		if (component[u] == none) {
-			component.setUpperBound(numComponents+1);
-			index c = numComponents;
-
-			q.push(u);
-			component[u] = c;
-
-			do {
-				node u = q.front();
-				q.pop();
-				// enqueue neighbors, set component
-				G.forNeighborsOf(u, [&](node v) {
-					if (component[v] == none) {
-						q.push(v);
-						component[v] = c;
-					}
-				});
-			} while (!q.empty());
-
-			++numComponents;
+		if (component[u] != none) {
+			return;
+		}
+		if (bfs.distance(u) != none) {
+			if (hubComponent == noneIndex) {
+				hubComponent = numComponents;
+				component.setUpperBound(numComponents+1);
+				++numComponents;
+			}
+			return;
+		}
+
+		component.setUpperBound(numComponents+1);
+		index c = numComponents;
+
+		q.push(u);
+		component[u] = c;
+
+		do {
+			node u = q.front();
+			q.pop();
+			// enqueue neighbors, set component
+			G.forNeighborsOf(u, [&](node v) {
+				if (component[v] == none) {
+					q.push(v);
+					component[v] = c;
+				}
+			});
+		} while (!q.empty());
+
+		++numComponents;
+	});
+
+	G.parallelForNodes([&](node u) {
+		if (bfs.distance(u) != none) {
+			component[u] = hubComponent;
 		}
 	});
 
@@ -165,7 +165,7 @@ namespace NetworKit {
 		std::fill(tmpDistances.begin(), tmpDistances.end(), none);
 		index nextId = nextAvailableComponentId(false);
 
-		std::vector<node> newCmp(components);
+		std::vector<index> newCmp(components);
 		newCmp[u] = nextId;
 		count newCmpSize = 0;
 
@@ -208,7 +208,7 @@ namespace NetworKit {
 
         index nextId = nextAvailableComponentId(false);
 
-        std::vector<node> newCmp(components);
+        std::vector<index> newCmp(components);
         newCmp[u] = nextId;
         count newCmpSize = 1;
 
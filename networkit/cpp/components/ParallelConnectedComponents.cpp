@@ -58,7 +58,7 @@ void ParallelConnectedComponents::run() {
 				// get smallest
 				index smallest = component[u];
 				G.forNeighborsOf(u, [&](node v) {
-					smallest = std::min(smallest, component[v]);
+					smallest = std::min<index>(smallest, component[v]);
 				});
 
 				if (component[u] != smallest) {
@@ -128,7 +128,7 @@ void ParallelConnectedComponents::runSequential() {
 				// get smallest
 				index smallest = component[u];
 				G.forNeighborsOf(u, [&](node v) {
-					smallest = std::min(smallest, component[v]);
+					smallest = std::min<index>(smallest, component[v]);
 				});
 
 				if (component[u] != smallest) {
@@ -152,7 +152,7 @@ void ParallelConnectedComponents::runSequential() {
 	}
 	if (coarsening && numIterations == 8) { // TODO: externalize constant
 		// coarsen and make recursive call
-		ParallelPartitionCoarsening con(G, component, false);
+		ParallelPartitionCoarsening con(G, component);
 		con.run();
 		auto Gcon = con.getCoarseGraph();
 		ParallelConnectedComponents cc(Gcon);
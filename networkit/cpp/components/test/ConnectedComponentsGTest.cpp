@@ -22,6 +22,7 @@
 #include "../../io/KONECTGraphReader.h"
 #include "../../generators/HavelHakimiGenerator.h"
 #include "../../auxiliary/Log.h"
+#include "../../auxiliary/Random.h"
 #include "../../generators/DorogovtsevMendesGenerator.h"
 
 namespace NetworKit {
@@ -63,6 +64,49 @@ namespace NetworKit {
     }
 
 
+    TEST_F(ConnectedComponentsGTest, testConnectedComponentsNumbering) {
+        // the components are numbered in the order of their smallest nodes, also the one of
+        // the node of maximum degree that is searched in parallel
+        Graph g(12);
+        g.addEdge(0,1);
+        g.addEdge(2,4);
+        g.addEdge(5,4);
+        g.addEdge(7,5);
+        g.addEdge(5,8);
+        g.addEdge(5,10);
+        g.addEdge(9,11);
+        g.removeNode(3);
+
+        ConnectedComponents ccs(g);
+        ccs.run();
+
+        std::vector<index> expected = {0, 0, 1, none, 1, 1, 2, 1, 1, 3, 1, 3};
+        EXPECT_EQ(4u, ccs.numberOfComponents());
+        EXPECT_EQ(4u, ccs.getPartition().upperBound());
+        g.forNodes([&](node u) {
+            EXPECT_EQ(expected[u], ccs.componentOfNode(u));
+        });
+
+        Aux::Random::setSeed(42, false);
+        Graph G = ErdosRenyiGenerator(3000, 0.0005).generate();
+        ConnectedComponents cc(G);
+        cc.run();
+        index next = 0;
+        std::vector<index> reference(G.upperNodeIdBound(), none);
+        G.forNodes([&](node s) {
+            if (reference[s] == none) {
+                G.BFSfrom(s, [&](node u, count) {
+                    reference[u] = next;
+                });
+                ++next;
+            }
+        });
+        EXPECT_EQ(next, cc.numberOfComponents());
+        G.forNodes([&](node u) {
+            EXPECT_EQ(reference[u], cc.componentOfNode(u));
+        });
+    }
+
     TEST_F(ConnectedComponentsGTest, testConnectedComponents) {
         // construct graph
         METISGraphReader reader;
@@ -6,15 +6,28 @@
  */
 
 #include <queue>
+#include <type_traits>
 #include "BFS.h"
+#include "../graph/DirectionOptimizingBFS.h"
+#include "../graph/StaticGraph.h"
+#include "../graph/CompressedGraph.h"
 
 namespace NetworKit {
 
-BFS::BFS(const Graph& G, node source, bool storePaths, bool storeNodesSortedByDistance, node target) : SSSP(G, source, storePaths, storeNodesSortedByDistance, target) {
+template<typename GraphType>
+BasicBFS<GraphType>::BasicBFS(const GraphType& G, node source, bool storePaths, bool storeNodesSortedByDistance, node target, bool directionOptimizing) : BasicSSSP<GraphType>(G, source, storePaths, storeNodesSortedByDistance, target), directionOptimizing(directionOptimizing) {
+	if (directionOptimizing && !std::is_same<GraphType, Graph>::value) {
+		throw std::runtime_error("the direction-optimizing BFS is only available for a Graph");
+	}
 }
 
 
-void BFS::run() {
+template<typename GraphType>
+void BasicBFS<GraphType>::run() {
+	if (directionOptimizing && !storePaths && target == none) {
+		runDirectionOptimizing();
+		return;
+	}
 	edgeweight infDist = std::numeric_limits<edgeweight>::max();
 	count z = G.upperNodeIdBound();
 	distances.clear();
@@ -75,4 +88,41 @@ void BFS::run() {
 	}
 }
 
+template<typename GraphType>
+void BasicBFS<GraphType>::runDirectionOptimizing() {
+	// rejected by the constructor
+}
+
+template<>
+void BasicBFS<Graph>::runDirectionOptimizing() {
+	DirectionOptimizingBFS bfs(G);
+	bfs.run(source);
+
+	const std::vector<count>& levels = bfs.getDistances();
+	const count z = G.upperNodeIdBound();
+	distances.resize(z);
+	#pragma omp parallel for
+	for (omp_index v = 0; v < static_cast<omp_index>(z); ++v) {
+		distances[v] = levels[v] == none ? std::numeric_limits<edgeweight>::max() : levels[v];
+	}
+
+	if (storeNodesSortedByDistance) {
+		// counting sort of the reached nodes by distance
+		std::vector<index> offset(bfs.maxDistance() + 2, 0);
+		for (index d = 0; d + 1 < offset.size(); ++d) {
+			offset[d + 1] = offset[d] + bfs.getLevelSizes()[d];
+		}
+		nodesSortedByDistance.resize(bfs.numberOfReachedNodes());
+		for (node v = 0; v < z; ++v) {
+			if (levels[v] != none) {
+				nodesSortedByDistance[offset[levels[v]]++] = v;
+			}
+		}
+	}
+}
+
+template class BasicBFS<Graph>;
+template class BasicBFS<StaticGraph>;
+template class BasicBFS<CompressedGraph>;
+
 } /* namespace NetworKit */
@@ -16,8 +16,10 @@ namespace NetworKit {
 /**
  * @ingroup distance
  * The BFS class is used to do a breadth-first search on a Graph from a given source node.
+ * BasicBFS also runs on the graph snapshots, see StaticGraph.
  */
-class BFS : public SSSP {
+template<typename GraphType>
+class BasicBFS : public BasicSSSP<GraphType> {
 
 friend class DynBFS;
 
@@ -30,8 +32,11 @@ public:
 	 * @param storePaths Paths are reconstructable and the number of paths is stored.
 	 * @param storeNodesSortedByDistance Store a vector of nodes ordered in increasing distance from the source.
 	 * @param target The target node.
+	 * @param directionOptimizing Use the parallel DirectionOptimizingBFS if neither paths nor a target are requested;
+	 * it pays off on large graphs with a small diameter. The nodes of the same distance are then sorted by id.
+	 * Only available for a Graph.
 	 */
-	BFS(const Graph& G, node source, bool storePaths=true, bool storeNodesSortedByDistance=false, node target = none);
+	BasicBFS(const GraphType& G, node source, bool storePaths=true, bool storeNodesSortedByDistance=false, node target = none, bool directionOptimizing = false);
 
 	/**
 	 * Breadth-first search from @a source.
@@ -40,7 +45,25 @@ public:
 	 */
 	virtual void run();
 
+protected:
+	using BasicSSSP<GraphType>::G;
+	using BasicSSSP<GraphType>::source;
+	using BasicSSSP<GraphType>::target;
+	using BasicSSSP<GraphType>::distances;
+	using BasicSSSP<GraphType>::previous;
+	using BasicSSSP<GraphType>::npaths;
+	using BasicSSSP<GraphType>::nodesSortedByDistance;
+	using BasicSSSP<GraphType>::storePaths;
+	using BasicSSSP<GraphType>::storeNodesSortedByDistance;
+
+private:
+	bool directionOptimizing;
+
+	void runDirectionOptimizing();
+
 };
 
+typedef BasicBFS<Graph> BFS;
+
 } /* namespace NetworKit */
 #endif /* BFS_H_ */
@@ -9,6 +9,7 @@
 
 #include "Diameter.h"
 #include "Eccentricity.h"
+#include "../graph/DirectionOptimizingBFS.h"
 #include "../distance/BFS.h"
 #include "../distance/Dijkstra.h"
 #include "../components/ConnectedComponents.h"
@@ -110,24 +111,31 @@ std::pair<edgeweight, edgeweight> Diameter::estimatedDiameterRange(const NetworK
 	std::vector<count> distances(G.upperNodeIdBound(), 0);
 
 	count numBFS = 0;
+	DirectionOptimizingBFS bfs(G);
 
 	auto runBFS = [&](const std::vector<node> &startNodes) {
 		++numBFS;
 		distFirst.clear();
-		distFirst.resize(numberOfComponents, 0);
-		std::vector<bool> foundFirstDeg2Node(numberOfComponents, false);
+		distFirst.resize(numberOfComponents, none);
 
-		G.BFSfrom(startNodes, [&](node v, count dist) {
+		bfs.run(startNodes);
+		G.forNodes([&](node v) {
+			count dist = bfs.distance(v);
 			distances[v] = dist;
 
 			index c = comp.componentOfNode(v);
 			ecc[c] = std::max(dist, ecc[c]);
 
-			if (!foundFirstDeg2Node[c] && G.degree(v) > 1) {
-				foundFirstDeg2Node[c] = true;
-				distFirst[c] = dist;
+			// distance of the first node of degree > 1 in breadth-first order
+			if (G.degree(v) > 1) {
+				distFirst[c] = std::min(dist, distFirst[c]);
 			}
 		});
+		for (count& dist : distFirst) {
+			if (dist == none) {
+				dist = 0;
+			}
+		}
 
 		G.forNodes([&](node u) {
 			if (finished[u]) return;
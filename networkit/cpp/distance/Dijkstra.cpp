@@ -6,16 +6,44 @@
  */
 
 #include "Dijkstra.h"
+#include "../auxiliary/DAryHeap.h"
+#include "../auxiliary/PairingHeap.h"
+#include "../auxiliary/PrioQueue.h"
+#include "../auxiliary/RadixPrioQueue.h"
+#include "../graph/StaticGraph.h"
+#include "../graph/CompressedGraph.h"
 
 #include <algorithm>
 
 namespace NetworKit {
 
-Dijkstra::Dijkstra(const Graph &G, node source, bool storePaths,
+template<typename GraphType>
+BasicDijkstra<GraphType>::BasicDijkstra(const GraphType &G, node source, bool storePaths,
 									 bool storeNodesSortedByDistance, node target)
-		: SSSP(G, source, storePaths, storeNodesSortedByDistance, target) {}
+		: BasicSSSP<GraphType>(G, source, storePaths, storeNodesSortedByDistance, target),
+		  queueType(QueueType::FOUR_ARY_HEAP) {}
 
-void Dijkstra::run() {
+template<typename GraphType>
+void BasicDijkstra<GraphType>::run() {
+	switch (queueType) {
+	case QueueType::FOUR_ARY_HEAP:
+		runWithQueue<Aux::DAryHeap<edgeweight, node, 4>>();
+		break;
+	case QueueType::PAIRING_HEAP:
+		runWithQueue<Aux::PairingHeap<edgeweight, node>>();
+		break;
+	case QueueType::RADIX_HEAP:
+		runWithQueue<Aux::RadixPrioQueue<edgeweight, node>>();
+		break;
+	case QueueType::BALANCED_TREE:
+		runWithQueue<Aux::PrioQueue<edgeweight, node>>();
+		break;
+	}
+}
+
+template<typename GraphType>
+template<class PQ>
+void BasicDijkstra<GraphType>::runWithQueue() {
 
 	TRACE("initializing Dijkstra data structures");
 	// init distances
@@ -35,9 +63,10 @@ void Dijkstra::run() {
 		std::swap(nodesSortedByDistance, empty);
 	}
 
-	// priority queue with distance-node pairs
+	// priority queue with distance-node pairs; only reached nodes are inserted
 	distances[source] = 0;
-	Aux::PrioQueue<edgeweight, node> pq(distances);
+	PQ pq(G.upperNodeIdBound());
+	pq.insert(0, source);
 
 	auto relax([&](node u, node v, edgeweight w) {
 		if (distances[v] > distances[u] + w) {
@@ -47,9 +76,7 @@ void Dijkstra::run() {
 				npaths[v] = npaths[u];
 			}
 			TRACE("Decreasing key of ", v);
-			TRACE("pq size: ", pq.size());
 			pq.changeKey(distances[v], v);
-			TRACE("pq size: ", pq.size());
 		} else if (storePaths && (distances[v] == distances[u] + w)) {
 			previous[v].push_back(u); // additional predecessor
 			npaths[v] += npaths[u];   // all the shortest paths to u are
@@ -63,9 +90,7 @@ void Dijkstra::run() {
 		TRACE("pq size: ", pq.size());
 		node current = pq.extractMin().second;
 		TRACE("current node in Dijkstra: ", current);
-		TRACE("pq size: ", pq.size());
-		if ((breakWhenFound && target == current) ||
-				distances[current] == infDist) {
+		if (breakWhenFound && target == current) {
 			break;
 		}
 
@@ -77,4 +102,8 @@ void Dijkstra::run() {
 	}
 }
 
+template class BasicDijkstra<Graph>;
+template class BasicDijkstra<StaticGraph>;
+template class BasicDijkstra<CompressedGraph>;
+
 } /* namespace NetworKit */
@@ -8,7 +8,6 @@
 #ifndef DIJKSTRA_H_
 #define DIJKSTRA_H_
 
-#include "../auxiliary/PrioQueue.h"
 #include "../graph/Graph.h"
 #include "SSSP.h"
 
@@ -16,14 +15,29 @@ namespace NetworKit {
 
 /**
  * @ingroup distance
- * Dijkstra's SSSP algorithm.
+ * Dijkstra's SSSP algorithm. BasicDijkstra also runs on the graph snapshots, see StaticGraph.
  */
-class Dijkstra : public SSSP {
+template<typename GraphType>
+class BasicDijkstra : public BasicSSSP<GraphType> {
 
 	friend class DynDijkstra;
 	friend class DynDijkstra2;
 
 public:
+	/**
+	 * Priority queue used to order the nodes by tentative distance.
+	 * FOUR_ARY_HEAP: addressable 4-ary heap with position map (default).
+	 * PAIRING_HEAP: addressable pairing heap, O(1) decrease-key.
+	 * RADIX_HEAP: monotone radix heap; requires non-negative edge weights, which Dijkstra assumes anyway.
+	 * BALANCED_TREE: Aux::PrioQueue, i.e. a std::set; allocates a tree node per operation.
+	 */
+	enum class QueueType {
+		FOUR_ARY_HEAP,
+		PAIRING_HEAP,
+		RADIX_HEAP,
+		BALANCED_TREE
+	};
+
 	/**
 	 * Creates the Dijkstra class for @a G and the source node @a source.
 	 *
@@ -35,7 +49,7 @@ public:
 	 *		  increasing distance from the source.
 	 * @param target The target node.
 	 */
-	Dijkstra(const Graph &G, node source, bool storePaths = true,
+	BasicDijkstra(const GraphType &G, node source, bool storePaths = true,
 					 bool storeNodesSortedByDistance = false, node target = none);
 
 	/**
@@ -43,7 +57,33 @@ public:
 	 * constructor.
 	 */
 	virtual void run();
+
+	/**
+	 * Selects the priority queue used by subsequent calls of run().
+	 */
+	void setQueueType(QueueType type) { queueType = type; }
+
+	QueueType getQueueType() const { return queueType; }
+
+protected:
+	using BasicSSSP<GraphType>::G;
+	using BasicSSSP<GraphType>::source;
+	using BasicSSSP<GraphType>::target;
+	using BasicSSSP<GraphType>::distances;
+	using BasicSSSP<GraphType>::previous;
+	using BasicSSSP<GraphType>::npaths;
+	using BasicSSSP<GraphType>::nodesSortedByDistance;
+	using BasicSSSP<GraphType>::storePaths;
+	using BasicSSSP<GraphType>::storeNodesSortedByDistance;
+
+private:
+	QueueType queueType;
+
+	template<class PQ>
+	void runWithQueue();
 };
 
+typedef BasicDijkstra<Graph> Dijkstra;
+
 } /* namespace NetworKit */
 #endif /* DIJKSTRA_H_ */
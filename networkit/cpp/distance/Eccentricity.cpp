@@ -6,18 +6,14 @@
  */
 
 #include "Eccentricity.h"
-#include "BFS.h"
+#include "../graph/DirectionOptimizingBFS.h"
 
 namespace NetworKit {
 
 std::pair<node, count> Eccentricity::getValue(const Graph& G, node u) {
-	count ecc = 0;
-	node res;
-	G.BFSfrom(u, [&](node v, count dist) {
-		ecc = dist;
-		res = v;
-	});
-	return {res, ecc}; // pair.first is argmax node
+	DirectionOptimizingBFS bfs(G);
+	bfs.run(u);
+	return {bfs.farthestNode(), bfs.maxDistance()}; // pair.first is argmax node
 }
 
 
@@ -7,6 +7,7 @@
 
 #include "EffectiveDiameter.h"
 #include "../components/ConnectedComponents.h"
+#include "../graph/DirectionOptimizingBFS.h"
 #include "../auxiliary/Random.h"
 
 #include <math.h>
@@ -25,64 +26,26 @@ EffectiveDiameter::EffectiveDiameter(const Graph& G, const double ratio) : Algor
 }
 
 void EffectiveDiameter::run() {
-	count z = G.upperNodeIdBound();
-	// saves the reachable nodes of the current iteration
-	std::vector<std::vector<bool> > mCurr(z);
-	// saves the reachable nodes of the previous iteration
-	std::vector<std::vector<bool> > mPrev(z);
 	// sums over the number of edges needed to reach 90% of all other nodes
 	effectiveDiameter = 0;
-	// the current distance of the neighborhoods
-	count h = 1;
 	// number of nodes that need to be connected with all other nodes
 	count threshold = (uint64_t) (ceil(ratio * G.numberOfNodes()) + 0.5);
-	// nodes that are not connected to enough nodes yet
-	std::vector<node> activeNodes;
 
-	// initialize all nodes
-	G.forNodes([&](node v){
-		std::vector<bool> connectedNodes;
-		// initialize n entries with value 0
-		connectedNodes.assign(z, 0);
-		// the node is always connected to itself
-		connectedNodes[v] = 1;
-		mCurr[v] = connectedNodes;
-		mPrev[v] = connectedNodes;
-		activeNodes.push_back(v);
-	});
-
-	// as long as we need to connect more nodes
-	while (!activeNodes.empty()) {
-		for (count x = 0; x < activeNodes.size(); x++) {
-			node v = activeNodes[x];
-				mCurr[v] = mPrev[v];
-				G.forNeighborsOf(v, [&](node u) {
-					for (count i = 0; i < G.numberOfNodes(); i++) {
-						// add the current neighbor of u to the neighborhood of v
-						mCurr[v][i] = mCurr[v][i] || mPrev[u][i];
-					}
-				});
-
-				// compute the number of connected nodes
-				count numConnectedNodes = 0;
-				for (count i = 0; i < G.numberOfNodes(); i++) {
-					if (mCurr[v][i] == 1) {
-						numConnectedNodes++;
-					}
-				}
-
-				// when the number of connected nodes surpasses the threshold the node must no longer be considered
-				if (numConnectedNodes >= threshold) {
-					effectiveDiameter += h;
-					// remove the current node from future iterations
-					std::swap(activeNodes[x], activeNodes.back());
-					activeNodes.pop_back();
-					--x; //don't skip former activeNodes.back() that has been switched to activeNodes[x]
-				}
+	// the number of nodes within distance h of v is the sum of the first h + 1 BFS level sizes
+	DirectionOptimizingBFS bfs(G);
+	G.forNodes([&](node v) {
+		bfs.run(v);
+		const std::vector<count>& levelSizes = bfs.getLevelSizes();
+		count numConnectedNodes = levelSizes[0];
+		count h = 1;
+		for (; h < levelSizes.size(); ++h) {
+			numConnectedNodes += levelSizes[h];
+			if (numConnectedNodes >= threshold) {
+				break;
 			}
-			mPrev = mCurr;
-			h++;
-	}
+		}
+		effectiveDiameter += h;
+	});
 	effectiveDiameter /= G.numberOfNodes();
 	hasRun = true;
 }
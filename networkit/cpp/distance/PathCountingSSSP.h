@@ -0,0 +1,264 @@
+/*
+ * PathCountingSSSP.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef PATHCOUNTINGSSSP_H_
+#define PATHCOUNTINGSSSP_H_
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "../graph/Graph.h"
+#include "../auxiliary/DAryHeap.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup distance
+ * Exact number of shortest paths as 64 bit unsigned integer; adding detects overflows.
+ */
+struct IntegerPathCount {
+	typedef uint64_t type;
+
+	static type zero() { return 0; }
+	static type one() { return 1; }
+
+	/** Adds @a b to @a a; returns false if the result does not fit. */
+	static bool add(type& a, type b) {
+		if (a > std::numeric_limits<type>::max() - b) {
+			return false;
+		}
+		a += b;
+		return true;
+	}
+
+	/** @return The quotient @a a / @a b. */
+	static double ratio(type a, type b) {
+		return static_cast<double>(a) / static_cast<double>(b);
+	}
+
+	static double toDouble(type a) {
+		return static_cast<double>(a);
+	}
+};
+
+/**
+ * @ingroup distance
+ * Number of shortest paths as double; exact up to 2^53 and fails beyond the double range.
+ */
+struct DoublePathCount {
+	typedef double type;
+
+	static type zero() { return 0.0; }
+	static type one() { return 1.0; }
+
+	static bool add(type& a, type b) {
+		a += b;
+		return std::isfinite(a);
+	}
+
+	static double ratio(type a, type b) {
+		return a / b;
+	}
+
+	static double toDouble(type a) {
+		return a;
+	}
+};
+
+/**
+ * @ingroup distance
+ * Natural logarithm of the number of shortest paths; never overflows.
+ */
+struct LogPathCount {
+	typedef double type;
+
+	static type zero() { return -std::numeric_limits<double>::infinity(); }
+	static type one() { return 0.0; }
+
+	static bool add(type& a, type b) {
+		if (b > a) {
+			std::swap(a, b);
+		}
+		if (b != zero()) {
+			a += std::log1p(std::exp(b - a));
+		}
+		return true;
+	}
+
+	static double ratio(type a, type b) {
+		return std::exp(a - b);
+	}
+
+	static double toDouble(type a) {
+		return std::exp(a);
+	}
+};
+
+/**
+ * @ingroup distance
+ * Single-source shortest path search that counts shortest paths with the representation
+ * @a PathCount (IntegerPathCount, DoublePathCount or LogPathCount), meant to be run repeatedly
+ * from many sources as e.g. in Brandes' betweenness algorithm. All memory is allocated once in
+ * the constructor and each run only resets the entries of the nodes reached by the previous one.
+ * Predecessors are not stored: forPredecessorsOf() finds them by scanning the incoming edges,
+ * since p precedes t on a shortest path iff dist(p) + w(p, t) = dist(t).
+ * Unweighted graphs are searched by BFS, weighted ones by Dijkstra's algorithm.
+ */
+template<class PathCount>
+class PathCountingSSSP {
+public:
+	typedef typename PathCount::type PathCountType;
+
+	/**
+	 * Prepares the search on @a G; @a G must not change while this object is used.
+	 */
+	PathCountingSSSP(const Graph& G);
+
+	/**
+	 * Computes distances and numbers of shortest paths from @a source. If @a target is given,
+	 * the search stops as soon as the distance and the number of paths of @a target are final;
+	 * then only the nodes up to @a target are final as well.
+	 * @return False if the number of paths could not be represented by @a PathCount,
+	 * distances and the order of the nodes are still valid in this case.
+	 */
+	bool run(node source, node target = none);
+
+	/**
+	 * @return Distance from the source to @a t, infinity if @a t is unreachable.
+	 */
+	edgeweight distance(node t) const {
+		return distances[t];
+	}
+
+	/**
+	 * @return Number of shortest paths from the source to @a t in the representation of @a PathCount.
+	 */
+	PathCountType numberOfPaths(node t) const {
+		return sigma[t];
+	}
+
+	/**
+	 * @return Number of shortest paths to @a p divided by the number of shortest paths to @a t.
+	 */
+	double pathRatio(node p, node t) const {
+		return PathCount::ratio(sigma[p], sigma[t]);
+	}
+
+	/**
+	 * @return The nodes reachable from the source in order of non-decreasing distance;
+	 * after a run with a target only the prefix up to the target is sorted and final.
+	 */
+	const std::vector<node>& getNodesSortedByDistance() const {
+		return sorted;
+	}
+
+	/**
+	 * Calls @a handle(p, eid) for every predecessor p of @a t on a shortest path from the source,
+	 * once per parallel edge (p, t) with id eid (none if the edges are not indexed).
+	 */
+	template<typename L> void forPredecessorsOf(node t, L handle) const;
+
+private:
+	const Graph& G;
+	std::vector<edgeweight> distances;
+	std::vector<PathCountType> sigma;
+	std::vector<node> sorted;
+	Aux::DAryHeap<edgeweight, node> heap;
+
+	bool runBFS(node source, node target);
+	bool runDijkstra(node source, node target);
+};
+
+template<class PathCount>
+PathCountingSSSP<PathCount>::PathCountingSSSP(const Graph& G) :
+	G(G),
+	distances(G.upperNodeIdBound(), std::numeric_limits<edgeweight>::infinity()),
+	sigma(G.upperNodeIdBound(), PathCount::zero()),
+	heap(G.isWeighted() ? G.upperNodeIdBound() : 0) {
+	sorted.reserve(G.upperNodeIdBound());
+}
+
+template<class PathCount>
+bool PathCountingSSSP<PathCount>::run(node source, node target) {
+	for (node u : sorted) {
+		distances[u] = std::numeric_limits<edgeweight>::infinity();
+		sigma[u] = PathCount::zero();
+	}
+	sorted.clear();
+
+	distances[source] = 0;
+	sigma[source] = PathCount::one();
+	return G.isWeighted() ? runDijkstra(source, target) : runBFS(source, target);
+}
+
+template<class PathCount>
+bool PathCountingSSSP<PathCount>::runBFS(node source, node target) {
+	bool representable = true;
+	// sorted doubles as the BFS queue
+	sorted.push_back(source);
+	for (index i = 0; i < sorted.size(); ++i) {
+		node u = sorted[i];
+		if (u == target) {
+			break;
+		}
+		const edgeweight next = distances[u] + 1;
+		G.forNeighborsOf(u, [&](node v) {
+			if (distances[v] > next) {
+				distances[v] = next;
+				sigma[v] = sigma[u];
+				sorted.push_back(v);
+			} else if (distances[v] == next) {
+				representable &= PathCount::add(sigma[v], sigma[u]);
+			}
+		});
+	}
+	return representable;
+}
+
+template<class PathCount>
+bool PathCountingSSSP<PathCount>::runDijkstra(node source, node target) {
+	bool representable = true;
+	heap.insert(0, source);
+	while (!heap.empty()) {
+		node u = heap.extractMin().second;
+		sorted.push_back(u);
+		if (u == target) {
+			// move the remaining reached nodes to sorted so that they are reset by the next run
+			while (!heap.empty()) {
+				sorted.push_back(heap.extractMin().second);
+			}
+			break;
+		}
+		G.forEdgesOf(u, [&](node, node v, edgeweight w) {
+			const edgeweight dist = distances[u] + w;
+			if (distances[v] > dist) {
+				distances[v] = dist;
+				sigma[v] = sigma[u];
+				heap.changeKey(dist, v);
+			} else if (distances[v] == dist && v != u) {
+				representable &= PathCount::add(sigma[v], sigma[u]);
+			}
+		});
+	}
+	return representable;
+}
+
+template<class PathCount>
+template<typename L>
+inline void PathCountingSSSP<PathCount>::forPredecessorsOf(node t, L handle) const {
+	const edgeweight dist = distances[t];
+	G.forInEdgesOf(t, [&](node, node p, edgeweight w, edgeid eid) {
+		if (p != t && distances[p] + w == dist) {
+			handle(p, eid);
+		}
+	});
+}
+
+} /* namespace NetworKit */
+#endif /* PATHCOUNTINGSSSP_H_ */
@@ -7,11 +7,14 @@
 
 #include "SSSP.h"
 #include "../auxiliary/Log.h"
+#include "../graph/StaticGraph.h"
+#include "../graph/CompressedGraph.h"
 
 namespace NetworKit {
 
-	SSSP::SSSP (
-		const Graph& G,
+	template<typename GraphType>
+	BasicSSSP<GraphType>::BasicSSSP (
+		const GraphType& G,
 		node source,
 		bool storePaths,
 		bool storeNodesSortedByDistance,
@@ -24,11 +27,13 @@ namespace NetworKit {
 	storePaths(storePaths),
 	storeNodesSortedByDistance(storeNodesSortedByDistance) {}
 
-	std::vector<edgeweight> SSSP::getDistances(bool moveOut) {
+	template<typename GraphType>
+	std::vector<edgeweight> BasicSSSP<GraphType>::getDistances(bool moveOut) {
 		return (moveOut)?std::move(distances):distances;
 	}
 
-	std::vector<node> SSSP::getPath(node t, bool forward) const {
+	template<typename GraphType>
+	std::vector<node> BasicSSSP<GraphType>::getPath(node t, bool forward) const {
 		if (! storePaths) {
 			throw std::runtime_error("paths have not been stored");
 		}
@@ -50,7 +55,8 @@ namespace NetworKit {
 		return path;
 	}
 
-	std::set<std::vector<node>> SSSP::getPaths(node t, bool forward) const {
+	template<typename GraphType>
+	std::set<std::vector<node>> BasicSSSP<GraphType>::getPaths(node t, bool forward) const {
 
 		std::set<std::vector<node>> paths;
 		if (previous[t].empty()) { // t is not reachable from source
@@ -112,7 +118,8 @@ namespace NetworKit {
 		return paths;
 	}
 
-	std::vector<node> SSSP::getNodesSortedByDistance(bool moveOut) {
+	template<typename GraphType>
+	std::vector<node> BasicSSSP<GraphType>::getNodesSortedByDistance(bool moveOut) {
 		if (!storeNodesSortedByDistance) {
 			throw std::runtime_error("Nodes sorted by distance have not been stored. Set storeNodesSortedByDistance in the constructor to true to enable this behaviour.");
 		} else if (nodesSortedByDistance.empty()) {
@@ -127,8 +134,13 @@ namespace NetworKit {
 		return nodesSortedByDistance;
 	}
 
-	std::vector<node> SSSP::getStack(bool moveOut) {
+	template<typename GraphType>
+	std::vector<node> BasicSSSP<GraphType>::getStack(bool moveOut) {
 		return getNodesSortedByDistance(moveOut);
 	}
 
+	template class BasicSSSP<Graph>;
+	template class BasicSSSP<StaticGraph>;
+	template class BasicSSSP<CompressedGraph>;
+
 } /* namespace NetworKit */
@@ -19,9 +19,11 @@ namespace NetworKit {
 
 /**
  * @ingroup distance
- * Abstract base class for single-source shortest path algorithms.
+ * Abstract base class for single-source shortest path algorithms on graphs of type @a GraphType, which
+ * is Graph, StaticGraph or CompressedGraph. SSSP is the base class for algorithms on a Graph.
  */
-class SSSP: public Algorithm {
+template<typename GraphType>
+class BasicSSSP: public Algorithm {
 
 public:
 
@@ -34,9 +36,9 @@ public:
 	 * @param storeNodesSortedByDistance Store a vector of nodes ordered in increasing distance from the source.
 	 * @param target The target node.
 	 */
-	SSSP(const Graph& G, node source, bool storePaths=true, bool storeNodesSortedByDistance=false, node target = none);
+	BasicSSSP(const GraphType& G, node source, bool storePaths=true, bool storeNodesSortedByDistance=false, node target = none);
 
-	virtual ~SSSP() = default;
+	virtual ~BasicSSSP() = default;
 
 	/** Computes the shortest paths from the source to all other nodes. */
 	virtual void run() = 0;
@@ -125,7 +127,7 @@ public:
 
 protected:
 
-	const Graph& G;
+	const GraphType& G;
 	const node source;
 	node target;
 	std::vector<edgeweight> distances;
@@ -138,18 +140,23 @@ protected:
 	bool storeNodesSortedByDistance;	//!< if true, store a vector of nodes ordered in increasing distance from the source
 };
 
-inline edgeweight SSSP::distance(node t) const {
+typedef BasicSSSP<Graph> SSSP;
+
+template<typename GraphType>
+inline edgeweight BasicSSSP<GraphType>::distance(node t) const {
 	return distances[t];
 }
 
-inline bigfloat SSSP::numberOfPaths(node t) const {
+template<typename GraphType>
+inline bigfloat BasicSSSP<GraphType>::numberOfPaths(node t) const {
 	if (! storePaths) {
 		throw std::runtime_error("number of paths have not been stored");
 	}
 	return npaths[t];
 }
 
-inline double SSSP::_numberOfPaths(node t) const {
+template<typename GraphType>
+inline double BasicSSSP<GraphType>::_numberOfPaths(node t) const {
 	if (! storePaths) {
 		throw std::runtime_error("number of paths have not been stored");
 	}
@@ -162,14 +169,16 @@ inline double SSSP::_numberOfPaths(node t) const {
 	return res;
 }
 
-inline std::vector<node> SSSP::getPredecessors(node t) const {
+template<typename GraphType>
+inline std::vector<node> BasicSSSP<GraphType>::getPredecessors(node t) const {
 	if (! storePaths) {
 		throw std::runtime_error("predecessors have not been stored");
 	}
 	return previous[t];
 }
 
-inline bigfloat SSSP::getNumberOfPaths(node t) const {
+template<typename GraphType>
+inline bigfloat BasicSSSP<GraphType>::getNumberOfPaths(node t) const {
 	return npaths[t];
 }
 
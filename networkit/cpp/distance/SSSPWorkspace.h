@@ -0,0 +1,80 @@
+/*
+ * SSSPWorkspace.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef SSSPWORKSPACE_H_
+#define SSSPWORKSPACE_H_
+
+#include <memory>
+
+#include "PathCountingSSSP.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup distance
+ * Reusable state for algorithms that run many single-source shortest path searches,
+ * typically one workspace per thread. Runs from a source with 64 bit integer path counts
+ * and falls back to double and logarithmic path counts if the numbers of shortest paths
+ * do not fit. The searches for each representation are created on first use and keep
+ * their memory between runs, so a run costs time proportional to the part of the graph it reaches.
+ */
+class SSSPWorkspace {
+public:
+	/**
+	 * Creates the workspace for @a G; @a G must not change while the workspace is used.
+	 */
+	explicit SSSPWorkspace(const Graph& G) : G(G) {
+	}
+
+	/**
+	 * Runs the search from @a source (stopping early at @a target if given) and passes it
+	 * to @a visitor, which has to provide
+	 * template<class PathCount> void operator()(const PathCountingSSSP<PathCount>&).
+	 */
+	template<class Visitor>
+	void run(node source, Visitor& visitor, node target = none);
+
+	/**
+	 * Computes the distances from @a source without caring about the numbers of paths.
+	 * @return The search, valid until the next call on this workspace.
+	 */
+	const PathCountingSSSP<DoublePathCount>& runDistances(node source);
+
+private:
+	const Graph& G;
+	std::unique_ptr<PathCountingSSSP<IntegerPathCount> > integerSSSP;
+	std::unique_ptr<PathCountingSSSP<DoublePathCount> > doubleSSSP;
+	std::unique_ptr<PathCountingSSSP<LogPathCount> > logSSSP;
+
+	template<class PathCount>
+	PathCountingSSSP<PathCount>& get(std::unique_ptr<PathCountingSSSP<PathCount> >& sssp) {
+		if (!sssp) {
+			sssp.reset(new PathCountingSSSP<PathCount>(G));
+		}
+		return *sssp;
+	}
+};
+
+template<class Visitor>
+void SSSPWorkspace::run(node source, Visitor& visitor, node target) {
+	if (get(integerSSSP).run(source, target)) {
+		visitor(*integerSSSP);
+	} else if (get(doubleSSSP).run(source, target)) {
+		visitor(*doubleSSSP);
+	} else {
+		get(logSSSP).run(source, target);
+		visitor(*logSSSP);
+	}
+}
+
+inline const PathCountingSSSP<DoublePathCount>& SSSPWorkspace::runDistances(node source) {
+	// distances are valid even if the path counts overflow
+	get(doubleSSSP).run(source);
+	return *doubleSSSP;
+}
+
+} /* namespace NetworKit */
+#endif /* SSSPWORKSPACE_H_ */
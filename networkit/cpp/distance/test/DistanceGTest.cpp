@@ -236,6 +236,20 @@ TEST_F(DistanceGTest, testEffectiveDiameterExact) {
 		EXPECT_NEAR(5.619047, effective2, tol);
 }
 
+TEST_F(DistanceGTest, testEffectiveDiameterDeletedNodes) {
+	// path 0--1--2--4--5, node 3 is deleted; all 5 nodes have to be reached, so the
+	// effective diameter is the mean eccentricity (4+3+2+3+4) / 5
+	Graph G(6);
+	G.addEdge(0,1);
+	G.addEdge(1,2);
+	G.addEdge(2,4);
+	G.addEdge(4,5);
+	G.removeNode(3);
+	EffectiveDiameter ed(G, 1.0);
+	ed.run();
+	EXPECT_NEAR(3.2, ed.getEffectiveDiameter(), 1e-9);
+}
+
 TEST_F(DistanceGTest, testHopPlotApproximation) {
 	using namespace std;
 
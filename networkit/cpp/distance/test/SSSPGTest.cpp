@@ -10,9 +10,16 @@
 #include "../BFS.h"
 #include "../DynDijkstra.h"
 #include "../Dijkstra.h"
+#include "../PathCountingSSSP.h"
+#include "../SSSPWorkspace.h"
 #include "../../io/METISGraphReader.h"
+#include "../../generators/ErdosRenyiGenerator.h"
+#include "../../auxiliary/Random.h"
 #include "../../auxiliary/Log.h"
 
+#include <algorithm>
+#include <cmath>
+#include <memory>
 #include <stack>
 
 
@@ -156,6 +163,33 @@ TEST_F(SSSPGTest, testDirectedBFS) {
 	EXPECT_EQ(sssp.distance(7), 3);
 }
 
+TEST_F(SSSPGTest, testDirectionOptimizingBFS) {
+	Aux::Random::setSeed(42, false);
+	for (bool directed : {false, true}) {
+		Graph G = ErdosRenyiGenerator(2000, 0.003, directed).generate();
+		G.removeNode(7);
+
+		BFS classic(G, 0, false, true);
+		classic.run();
+		BFS directionOptimizing(G, 0, false, true, none, true);
+		directionOptimizing.run();
+
+		G.forNodes([&](node v) {
+			EXPECT_EQ(classic.distance(v), directionOptimizing.distance(v));
+		});
+		// the nodes of the same distance may be in a different order
+		std::vector<node> expected = classic.getNodesSortedByDistance();
+		std::vector<node> sorted = directionOptimizing.getNodesSortedByDistance();
+		ASSERT_EQ(expected.size(), sorted.size());
+		for (index i = 0; i < sorted.size(); ++i) {
+			EXPECT_EQ(classic.distance(expected[i]), directionOptimizing.distance(sorted[i]));
+		}
+		std::sort(expected.begin(), expected.end());
+		std::sort(sorted.begin(), sorted.end());
+		EXPECT_EQ(expected, sorted);
+	}
+}
+
 TEST_F(SSSPGTest, testDirectedDijkstra) {
 /* Graph:
          ________
@@ -192,4 +226,168 @@ TEST_F(SSSPGTest, testDirectedDijkstra) {
 	EXPECT_EQ(sssp.distance(6), 1);
 	EXPECT_EQ(sssp.distance(7), 3);
 }
+
+TEST_F(SSSPGTest, testDijkstraQueueTypes) {
+	Aux::Random::setSeed(42, false);
+	Graph G = ErdosRenyiGenerator(300, 0.02, true).generate();
+	Graph H(G, true, true);
+	H.forEdges([&](node u, node v) {
+		H.setWeight(u, v, Aux::Random::integer(1, 5) * 0.5);
+	});
+
+	Dijkstra reference(H, 0, true, true);
+	reference.setQueueType(Dijkstra::QueueType::BALANCED_TREE);
+	reference.run();
+
+	for (auto type : {Dijkstra::QueueType::FOUR_ARY_HEAP, Dijkstra::QueueType::PAIRING_HEAP, Dijkstra::QueueType::RADIX_HEAP}) {
+		Dijkstra sssp(H, 0, true, true);
+		sssp.setQueueType(type);
+		sssp.run();
+		H.forNodes([&](node v) {
+			EXPECT_EQ(reference.distance(v), sssp.distance(v));
+			EXPECT_EQ(reference.numberOfPaths(v), sssp.numberOfPaths(v));
+		});
+		EXPECT_EQ(reference.getNodesSortedByDistance(false).size(), sssp.getNodesSortedByDistance(false).size());
+	}
+}
+
+TEST_F(SSSPGTest, testPathCountingSSSP) {
+	Aux::Random::setSeed(42, false);
+	Graph G = ErdosRenyiGenerator(300, 0.02, true).generate();
+	Graph H(G, true, true);
+	H.forEdges([&](node u, node v) {
+		H.setWeight(u, v, Aux::Random::integer(1, 3));
+	});
+
+	for (const Graph* graph : {&G, &H}) {
+		PathCountingSSSP<IntegerPathCount> integerSSSP(*graph);
+		PathCountingSSSP<DoublePathCount> doubleSSSP(*graph);
+		PathCountingSSSP<LogPathCount> logSSSP(*graph);
+		// repeated runs must not be affected by the previous ones
+		for (node source : {0, 1, 0}) {
+			std::unique_ptr<SSSP> reference;
+			if (graph->isWeighted()) {
+				reference.reset(new Dijkstra(*graph, source, true, true));
+			} else {
+				reference.reset(new BFS(*graph, source, true, true));
+			}
+			reference->run();
+			ASSERT_TRUE(integerSSSP.run(source));
+			ASSERT_TRUE(doubleSSSP.run(source));
+			ASSERT_TRUE(logSSSP.run(source));
+			EXPECT_EQ(reference->getNodesSortedByDistance(false).size(), integerSSSP.getNodesSortedByDistance().size());
+
+			graph->forNodes([&](node v) {
+				if (reference->numberOfPaths(v) == 0) {
+					EXPECT_EQ(std::numeric_limits<edgeweight>::infinity(), integerSSSP.distance(v));
+					return;
+				}
+				EXPECT_EQ(reference->distance(v), integerSSSP.distance(v));
+				EXPECT_EQ(reference->_numberOfPaths(v), integerSSSP.numberOfPaths(v));
+				EXPECT_EQ(reference->_numberOfPaths(v), doubleSSSP.numberOfPaths(v));
+				EXPECT_NEAR(reference->_numberOfPaths(v), LogPathCount::toDouble(logSSSP.numberOfPaths(v)), 1e-6 * reference->_numberOfPaths(v));
+
+				std::vector<node> predecessors;
+				integerSSSP.forPredecessorsOf(v, [&](node p, edgeid) {
+					predecessors.push_back(p);
+				});
+				std::vector<node> expected = reference->getPredecessors(v);
+				std::sort(predecessors.begin(), predecessors.end());
+				std::sort(expected.begin(), expected.end());
+				EXPECT_EQ(expected, predecessors);
+			});
+		}
+	}
+}
+
+TEST_F(SSSPGTest, testPathCountingSSSPOverflow) {
+	// directed chain of k diamonds, the number of shortest paths doubles with every diamond
+	count k = 1100;
+	Graph G(3 * k + 1, false, true);
+	for (index i = 0; i < k; ++i) {
+		node s = 3 * i;
+		G.addEdge(s, s + 1);
+		G.addEdge(s, s + 2);
+		G.addEdge(s + 1, s + 3);
+		G.addEdge(s + 2, s + 3);
+	}
+	node target = 3 * k;
+
+	PathCountingSSSP<IntegerPathCount> integerSSSP(G);
+	EXPECT_FALSE(integerSSSP.run(0));
+	EXPECT_EQ(2 * k, integerSSSP.distance(target));
+	EXPECT_TRUE(integerSSSP.run(3 * (k - 63)));
+	EXPECT_EQ(uint64_t(1) << 63, integerSSSP.numberOfPaths(target));
+
+	PathCountingSSSP<DoublePathCount> doubleSSSP(G);
+	EXPECT_FALSE(doubleSSSP.run(0));
+	EXPECT_TRUE(doubleSSSP.run(3 * (k - 1000)));
+	EXPECT_EQ(std::ldexp(1.0, 1000), doubleSSSP.numberOfPaths(target));
+
+	PathCountingSSSP<LogPathCount> logSSSP(G);
+	EXPECT_TRUE(logSSSP.run(0));
+	EXPECT_NEAR(k * std::log(2.0), logSSSP.numberOfPaths(target), 1e-6);
+	EXPECT_NEAR(0.5, logSSSP.pathRatio(target - 1, target), 1e-9);
+}
+
+namespace {
+
+struct PathCountRecorder {
+	node target;
+	double paths;
+	double ratio;
+	edgeweight dist;
+
+	template<class PathCount>
+	void operator()(const PathCountingSSSP<PathCount>& sssp) {
+		paths = PathCount::toDouble(sssp.numberOfPaths(target));
+		ratio = sssp.pathRatio(target - 1, target);
+		dist = sssp.distance(target);
+	}
+};
+
+}
+
+TEST_F(SSSPGTest, testSSSPWorkspace) {
+	// directed chain of k diamonds, the number of shortest paths doubles with every diamond
+	count k = 1100;
+	Graph G(3 * k + 1, true, true);
+	for (index i = 0; i < k; ++i) {
+		node s = 3 * i;
+		G.addEdge(s, s + 1, 1.0);
+		G.addEdge(s, s + 2, 1.0);
+		G.addEdge(s + 1, s + 3, 0.5);
+		G.addEdge(s + 2, s + 3, 0.5);
+	}
+	SSSPWorkspace workspace(G);
+
+	// falls back to double and logarithmic path counts
+	for (count diamonds : {10, 100, 1100}) {
+		node target = 3 * diamonds;
+		PathCountRecorder recorder{target, 0, 0, 0};
+		workspace.run(0, recorder);
+		EXPECT_EQ(1.5 * diamonds, recorder.dist);
+		EXPECT_NEAR(0.5, recorder.ratio, 1e-9);
+		if (diamonds < 1000) {
+			// the full run exceeds the double range, so the logarithmic path counts are used
+			EXPECT_NEAR(std::ldexp(1.0, diamonds), recorder.paths, 1e-9 * recorder.paths);
+		}
+
+		// stopping at the target yields the same path count
+		PathCountRecorder early{target, 0, 0, 0};
+		workspace.run(0, early, target);
+		EXPECT_EQ(recorder.dist, early.dist);
+		EXPECT_NEAR(0.5, early.ratio, 1e-9);
+		if (diamonds < 1000) {
+			EXPECT_EQ(std::ldexp(1.0, diamonds), early.paths);
+		}
+	}
+
+	// runs after an early stop are not affected by it
+	const auto& sssp = workspace.runDistances(3);
+	EXPECT_EQ(std::numeric_limits<edgeweight>::infinity(), sssp.distance(0));
+	EXPECT_EQ(1.5 * (k - 1), sssp.distance(3 * k));
+	EXPECT_EQ(3 * (k - 1) + 1, sssp.getNodesSortedByDistance().size());
+}
+
 }
@@ -8,8 +8,13 @@
 #ifndef CHUNGLU_H_
 #define CHUNGLU_H_
 
+#include <algorithm>
+#include <cmath>
+#include <random>
+
 #include "StaticDegreeSequenceGenerator.h"
 #include "../auxiliary/Random.h"
+#include "../auxiliary/Parallel.h"
 
 namespace NetworKit {
 
@@ -35,14 +40,78 @@ protected:
 	count sum_deg;
 	count n;
 
+	/**
+	 * Number of consecutive rows that are generated with the same random stream.
+	 */
+	static const count rowsPerChunk = 256;
+
 public:
 	ChungLuGenerator(const std::vector<count>& degreeSequence);
 
 	/**
 	 * Generates graph with expected degree sequence seq.
 	 */
-	virtual Graph generate();
+	virtual Graph generate() override;
+
+	/**
+	 * Passes the edges of a new graph to @a sink while they are generated.
+	 */
+	virtual void generateEdges(EdgeSink& sink) override;
+
+	/**
+	 * Calls @a handle(u, v) for every edge {u, v} with u < v of a new random graph without
+	 * storing the graph, e.g. to write the edges to a file. As in generate(), node u gets
+	 * the u-th largest expected degree. The calls are made in parallel, but all edges with
+	 * the same u are created by the same thread. The graph only depends on the seed of
+	 * Aux::Random, not on the number of threads.
+	 */
+	template<typename L>
+	void parallelForEdges(L handle);
 };
 
+template<typename L>
+void ChungLuGenerator::parallelForEdges(L handle) {
+	if (n < 2 || sum_deg == 0) {
+		return;
+	}
+
+	/* We need a sorted list in descending order for this algorithm */
+	Aux::Parallel::sort(seq.begin(), seq.end(), [](count a, count b){ return a > b;});
+
+	const uint64_t seed = Aux::Random::integer();
+	const count chunks = (n - 1 + rowsPerChunk - 1) / rowsPerChunk;
+
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (omp_index chunk = 0; chunk < static_cast<omp_index>(chunks); ++chunk) {
+		std::mt19937_64 urng = Aux::Random::getStreamURNG(seed, chunk);
+		std::uniform_real_distribution<double> distribution;
+		const node end = static_cast<node>(std::min<count>((chunk + 1) * rowsPerChunk, n - 1));
+		for (node u = chunk * rowsPerChunk; u < end; u++) {
+			node v = u + 1;
+			double p = std::min(static_cast<double>(seq[u]) * static_cast<double>(seq[v]) / sum_deg, 1.0);
+
+			while (v < n && p > 0) {
+				if (p != 1.0) {
+					/* Calculate the distance to the next potential neighbour */
+					double skip = std::floor(std::log(1.0 - distribution(urng)) / std::log(1 - p));
+					if (skip >= static_cast<double>(n - v)) {
+						break;
+					}
+					v = v + static_cast<node>(skip);
+				}
+				double q = std::min(static_cast<double>(seq[u]) * static_cast<double>(seq[v]) / sum_deg, 1.0);
+				/* The potential neighbour was selected with the probability p.
+				 * In order to see if this neighbour should be rejected or accepted
+				 * we correct the probability using q */
+				if (distribution(urng) < q / p) {
+					handle(u, v);
+				}
+				p = q;
+				v++;
+			}
+		}
+	}
+}
+
 } /* namespace NetworKit */
 #endif /* CHUNGLU_H_ */
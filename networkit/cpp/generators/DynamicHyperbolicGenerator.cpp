@@ -5,7 +5,10 @@
  *      Author: moritzl
  */
 
+#include <array>
 #include <cmath>
+#include <numeric>
+#include <omp.h>
 
 #include "DynamicHyperbolicGenerator.h"
 #include "HyperbolicGenerator.h"
@@ -15,6 +18,31 @@
 using std::vector;
 namespace NetworKit {
 
+namespace {
+
+/**
+ * Calls @a handle(k) once for every position k in the union of @a ranges.
+ */
+template<typename L>
+void forUnionOfRanges(std::array<std::pair<index, index>, 4> ranges, L handle) {
+	std::sort(ranges.begin(), ranges.end());
+	index end = 0;
+	for (const std::pair<index, index> &range : ranges) {
+		for (index k = std::max(range.first, end); k < range.second; k++) {
+			handle(k);
+		}
+		end = std::max(end, range.second);
+	}
+}
+
+} // namespace
+
+std::array<std::pair<index, index>, 2> DynamicHyperbolicGenerator::candidateRanges(double phi, double r, double cLow, const vector<double> &bandAngles) const {
+	double minTheta, maxTheta;
+	std::tie(minTheta, maxTheta) = HyperbolicGenerator::getMinMaxTheta(phi, r, cLow, R);
+	return HyperbolicGenerator::getPointRangesWithinAngles(minTheta, maxTheta, bandAngles);
+}
+
 DynamicHyperbolicGenerator::DynamicHyperbolicGenerator(count n, double avgDegree, double exp, double T, double moveEachStep, double moveDistance) {
 	nodeCount = n;
 	this->alpha = (exp-1)/2;
@@ -77,10 +105,15 @@ void DynamicHyperbolicGenerator::initializeMovement() {
 }
 
 void DynamicHyperbolicGenerator::initializeQuadTree() {
+	vector<index> content(nodeCount);
 	for (index i = 0; i < nodeCount; i++) {
 		assert(radii[i] < R);
-		quad.addContent(i, angles[i], radii[i]);
+		content[i] = i;
 	}
+	//the default constructed tree has no region, use the leaf capacity of HyperbolicGenerator for T > 0
+	quad = Quadtree<index,false>(R, false, alpha, 10);
+	quad.bulkLoad(content, angles, radii);
+	quad.freeze();
 	INFO("Filled Quadtree");
 }
 
@@ -89,37 +122,112 @@ void DynamicHyperbolicGenerator::recomputeBands() {
 	bandRadii = HyperbolicGenerator::getBandRadii(nodeCount, R);
 	INFO("Got Band Radii");
 	assert(bandRadii.size() > 1);
-	//2. Initialize empty bands
-	bands.clear();
-	bands.resize(bandRadii.size() - 1);
-	bandAngles.clear();
-	bandAngles.resize(bandRadii.size() - 1);
+	const count bandCount = bandRadii.size() - 1;
 	assert(angles.size() == nodeCount);
 	assert(radii.size() == nodeCount);
 
-	//ensure points are sorted
+	//2. Sort points by band, then by angle and radius
+	vector<index> band(nodeCount);
+	#pragma omp parallel for
+	for (omp_index i = 0; i < static_cast<omp_index>(nodeCount); i++) {
+		band[i] = bandOf(radii[i]);
+	}
 	vector<index> permutation(nodeCount);
-
 	index p = 0;
 	std::generate(permutation.begin(), permutation.end(), [&p](){return p++;});
-
-	Aux::Parallel::sort(permutation.begin(), permutation.end(), [&](index i, index j){return angles[i] < angles[j] || (angles[i] == angles[j] && radii[i] < radii[j]);});
+	Aux::Parallel::sort(permutation.begin(), permutation.end(), [&](index i, index j){
+		return band[i] < band[j] || (band[i] == band[j] && (angles[i] < angles[j] || (angles[i] == angles[j] && radii[i] < radii[j])));
+	});
+	vector<index> bandBegin(bandCount + 1, 0);
+	for (index i = 0; i < nodeCount; i++) {
+		bandBegin[band[i] + 1]++;
+	}
+	std::partial_sum(bandBegin.begin(), bandBegin.end(), bandBegin.begin());
 
 	//3. Put points to bands
 	INFO("Starting Point distribution");
-	#pragma omp parallel for
-	for (omp_index j = 0; j < static_cast<omp_index>(bands.size()); j++){
-		for (index i = 0; i < nodeCount; i++){
-			double alias = permutation[i];
-			if (radii[alias] >= bandRadii[j] && radii[alias] <= bandRadii[j+1]){
-				bands[j].push_back(Point2D<double>(angles[alias], radii[alias], alias));
-				bandAngles[j].push_back(angles[alias]);
-			}
+	bandIds.assign(bandCount, vector<index>());
+	bandAngles.assign(bandCount, vector<double>());
+	bandPoints.assign(bandCount, HyperbolicPoints());
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (omp_index j = 0; j < static_cast<omp_index>(bandCount); j++){
+		bandIds[j].assign(permutation.begin() + bandBegin[j], permutation.begin() + bandBegin[j+1]);
+		bandAngles[j].reserve(bandIds[j].size());
+		bandPoints[j].reserve(bandIds[j].size());
+		for (index alias : bandIds[j]) {
+			bandAngles[j].push_back(angles[alias]);
+			bandPoints[j].push_back(angles[alias], radii[alias]);
 		}
 	}
+	isMoving.assign(nodeCount, false);
 	INFO("Filled Bands");
 }
 
+index DynamicHyperbolicGenerator::bandOf(double r) const {
+	//band j contains the radii in [bandRadii[j], bandRadii[j+1]), the last one also R
+	index upper = std::upper_bound(bandRadii.begin(), bandRadii.end(), r) - bandRadii.begin();
+	return std::min<index>(std::max<index>(upper, 1), bandRadii.size() - 1) - 1;
+}
+
+void DynamicHyperbolicGenerator::updateBands(const vector<index> &moved, const vector<double> &oldRadii) {
+	const count bandCount = bandIds.size();
+	vector<bool> changed(bandCount, false);
+	vector<vector<index> > insertions(bandCount);
+	for (index j = 0; j < moved.size(); j++) {
+		changed[bandOf(oldRadii[j])] = true;
+		insertions[bandOf(radii[moved[j]])].push_back(moved[j]);
+	}
+	auto before = [&](index i, index j) {
+		return angles[i] < angles[j] || (angles[i] == angles[j] && radii[i] < radii[j]);
+	};
+
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (omp_index b = 0; b < static_cast<omp_index>(bandCount); b++) {
+		vector<index> &inserted = insertions[b];
+		if (!changed[b] && inserted.empty()) continue;
+		std::sort(inserted.begin(), inserted.end(), before);
+		vector<index> &ids = bandIds[b];
+		vector<double> &bandAngle = bandAngles[b];
+		HyperbolicPoints &points = bandPoints[b];
+
+		//remove the moved points, the remaining ones keep their order
+		index kept = 0;
+		for (index k = 0; k < ids.size(); k++) {
+			if (isMoving[ids[k]]) continue;
+			if (kept != k) {
+				ids[kept] = ids[k];
+				bandAngle[kept] = bandAngle[k];
+				points.copy(k, kept);
+			}
+			kept++;
+		}
+
+		//merge the moved points in from the back, so that no point is copied twice
+		const count size = kept + inserted.size();
+		ids.resize(size);
+		bandAngle.resize(size);
+		points.resize(size);
+		index k = kept;
+		index l = inserted.size();
+		index out = size;
+		while (l > 0) {
+			out--;
+			if (k > 0 && before(inserted[l-1], ids[k-1])) {
+				k--;
+				ids[out] = ids[k];
+				bandAngle[out] = bandAngle[k];
+				points.copy(k, out);
+			} else {
+				l--;
+				const index v = inserted[l];
+				ids[out] = v;
+				bandAngle[out] = angles[v];
+				points.set(out, angles[v], radii[v]);
+			}
+		}
+	}
+}
+
 Graph DynamicHyperbolicGenerator::getGraph() const {
 	/**
 	 * The next call is unnecessarily expensive, since it constructs a new QuadTree / bands.
@@ -213,36 +321,154 @@ void DynamicHyperbolicGenerator::moveNode(index toMove) {
 vector<index> DynamicHyperbolicGenerator::getNeighborsInBands(index i, bool bothDirections) {
 	const double r = radii[i];
 	const double phi = angles[i];
-	//const double coshr = cosh(radii[i]);
-	//const double sinhr = sinh(radii[i]);
-	//const double coshR = cosh(R);
-	assert(bands.size() == bandAngles.size());
-	assert(bands.size() == bandRadii.size() -1);
+	const HyperbolicPoints::Query query(phi, r);
+	const double coshR = cosh(R);
+	assert(bandIds.size() == bandAngles.size());
+	assert(bandIds.size() == bandRadii.size() -1);
 	count expectedDegree = (4/PI)*nodeCount*exp(-(radii[i])/2);
 	vector<index> near;
 	near.reserve(expectedDegree*1.1);
-	for(index j = 0; j < bands.size(); j++){
+	for(index j = 0; j < bandIds.size(); j++){
 		if(bothDirections || bandRadii[j+1] > radii[i]){
 			double minTheta, maxTheta;
 			std::tie (minTheta, maxTheta) = HyperbolicGenerator::getMinMaxTheta(phi, r, bandRadii[j], R);
 
-			vector<Point2D<double>> neighborCandidates = HyperbolicGenerator::getPointsWithinAngles(minTheta, maxTheta, bands[j], bandAngles[j]);
+			for (const std::pair<index, index> &range : HyperbolicGenerator::getPointRangesWithinAngles(minTheta, maxTheta, bandAngles[j])) {
+				bandPoints[j].filterByDistance(range.first, range.second, query, coshR, bandIds[j].data(), near);
+			}
+		}
+	}
+	near.erase(std::remove(near.begin(), near.end(), i), near.end());
+	return near;
+}
+
+void DynamicHyperbolicGenerator::getEventsFromNodeMovementInBands(vector<GraphEvent> &result) {
+	//choose the nodes to move with geometric jumps, in increasing order
+	vector<index> toWiggle;
+	if (moveEachStep >= 1) {
+		toWiggle.resize(nodeCount);
+		std::iota(toWiggle.begin(), toWiggle.end(), 0);
+	} else {
+		const double logStay = std::log(1 - moveEachStep);
+		for (index next = 0; ; next++) {
+			const double skip = std::floor(std::log(1 - Aux::Random::real()) / logStay);
+			if (skip >= static_cast<double>(nodeCount - next)) break;
+			next += static_cast<index>(skip);
+			toWiggle.push_back(next);
+		}
+	}
+	const count moved = toWiggle.size();
+	const count bandCount = bandIds.size();
+	const double coshR = cosh(R);
+
+	//move the nodes, remembering their old positions
+	vector<double> oldAngles(moved), oldRadii(moved);
+	HyperbolicPoints oldPoints, newPoints;
+	oldPoints.resize(moved);
+	newPoints.resize(moved);
+	#pragma omp parallel for
+	for (omp_index j = 0; j < static_cast<omp_index>(moved); j++) {
+		const index u = toWiggle[j];
+		oldAngles[j] = angles[u];
+		oldRadii[j] = radii[u];
+		oldPoints.set(j, oldAngles[j], oldRadii[j]);
+		moveNode(u);
+		newPoints.set(j, angles[u], radii[u]);
+	}
+	for (index u : toWiggle) {
+		isMoving[u] = true;
+	}
+
+	//bands of the moved nodes at their old positions, holding their indices in toWiggle
+	vector<vector<index> > movedIds(bandCount);
+	for (index j = 0; j < moved; j++) {
+		movedIds[bandOf(oldRadii[j])].push_back(j);
+	}
+	vector<vector<double> > movedAngles(bandCount);
+	vector<HyperbolicPoints> movedPoints(bandCount);
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (omp_index b = 0; b < static_cast<omp_index>(bandCount); b++) {
+		std::sort(movedIds[b].begin(), movedIds[b].end(), [&](index i, index j){
+			return oldAngles[i] < oldAngles[j] || (oldAngles[i] == oldAngles[j] && oldRadii[i] < oldRadii[j]);
+		});
+		movedPoints[b].reserve(movedIds[b].size());
+		for (index j : movedIds[b]) {
+			movedAngles[b].push_back(oldAngles[j]);
+			movedPoints[b].push_back(oldAngles[j], oldRadii[j]);
+		}
+	}
+
+	updateBands(toWiggle, oldRadii);
 
-			const count sSize = neighborCandidates.size();
-			for(index w = 0; w < sSize; w++){
-				if (HyperbolicSpace::nativeDistance(phi, r, neighborCandidates[w].getX(), neighborCandidates[w].getY()) <= R) {
-					const index possibleNeighbor = neighborCandidates[w].getIndex();
-					if(possibleNeighbor != i){
-						near.push_back(possibleNeighbor);
+	/**
+	 * Only pairs with a moved node can change. A pair of a moved node u and a resting node v is found in
+	 * the union of the candidate ranges of the old and the new position of u, a pair of two moved nodes is
+	 * found either at the new positions if it is an edge afterwards or at the old ones if it was one before
+	 * and reported by the smaller node.
+	 */
+	vector<vector<GraphEvent> > threadEvents(omp_get_max_threads());
+	#pragma omp parallel for schedule(guided)
+	for (omp_index j = 0; j < static_cast<omp_index>(moved); j++) {
+		vector<GraphEvent> &events = threadEvents[omp_get_thread_num()];
+		const index u = toWiggle[j];
+		const HyperbolicPoints::Query oldQuery(oldAngles[j], oldRadii[j]);
+		const HyperbolicPoints::Query newQuery(angles[u], radii[u]);
+
+		for (index b = 0; b < bandCount; b++) {
+			const auto oldRanges = candidateRanges(oldAngles[j], oldRadii[j], bandRadii[b], bandAngles[b]);
+			const auto newRanges = candidateRanges(angles[u], radii[u], bandRadii[b], bandAngles[b]);
+			forUnionOfRanges({{oldRanges[0], oldRanges[1], newRanges[0], newRanges[1]}}, [&](index k) {
+				const index v = bandIds[b][k];
+				if (isMoving[v]) {
+					if (v > u && bandPoints[b].coshDistance(k, newQuery) <= coshR) {
+						const index w = std::lower_bound(toWiggle.begin(), toWiggle.end(), v) - toWiggle.begin();
+						if (oldPoints.coshDistance(w, oldQuery) > coshR) {
+							events.emplace_back(GraphEvent::EDGE_ADDITION, u, v);
+						}
+					}
+					return;
+				}
+				const bool wasAdjacent = bandPoints[b].coshDistance(k, oldQuery) <= coshR;
+				const bool isAdjacent = bandPoints[b].coshDistance(k, newQuery) <= coshR;
+				if (wasAdjacent != isAdjacent) {
+					events.emplace_back(isAdjacent ? GraphEvent::EDGE_ADDITION : GraphEvent::EDGE_REMOVAL, u, v);
+				}
+			});
+
+			const auto movedRanges = candidateRanges(oldAngles[j], oldRadii[j], bandRadii[b], movedAngles[b]);
+			for (const std::pair<index, index> &range : movedRanges) {
+				for (index k = range.first; k < range.second; k++) {
+					const index w = movedIds[b][k];
+					const index v = toWiggle[w];
+					if (v > u && movedPoints[b].coshDistance(k, oldQuery) <= coshR && newPoints.coshDistance(w, newQuery) > coshR) {
+						events.emplace_back(GraphEvent::EDGE_REMOVAL, u, v);
 					}
 				}
 			}
 		}
 	}
-	return near;
+
+	for (index u : toWiggle) {
+		isMoving[u] = false;
+	}
+
+	//every changed pair is reported once, sort them to make the stream independent of the scheduling
+	const count oldStreamMarker = result.size();
+	for (const vector<GraphEvent> &events : threadEvents) {
+		result.insert(result.end(), events.begin(), events.end());
+	}
+	for (auto it = result.begin()+oldStreamMarker; it < result.end(); it++) {
+		if (it->u > it->v) std::swap(it->u, it->v);
+	}
+	Aux::Parallel::sort(result.begin()+oldStreamMarker, result.end(), GraphEvent::compare);
 }
 
 void DynamicHyperbolicGenerator::getEventsFromNodeMovement(vector<GraphEvent> &result) {
+	if (T == 0) {
+		getEventsFromNodeMovementInBands(result);
+		return;
+	}
+
 	bool suppressLeft = false;
 
 	//now define lambda
@@ -268,12 +494,8 @@ void DynamicHyperbolicGenerator::getEventsFromNodeMovement(vector<GraphEvent> &r
 		if (Aux::Random::real(1) < moveEachStep) {
 			vector<index> localOldNeighbors;
 			toWiggle.push_back(i);
-			if (T == 0) {
-				localOldNeighbors = getNeighborsInBands(i, true);
-			} else {
-				Point2D<double> q = HyperbolicSpace::polarToCartesian(angles[i], radii[i]);
-				quad.getElementsProbabilistically(q, edgeProb, suppressLeft, localOldNeighbors);
-			}
+			Point2D<double> q = HyperbolicSpace::polarToCartesian(angles[i], radii[i]);
+			quad.getElementsProbabilistically(q, edgeProb, suppressLeft, localOldNeighbors);
 			oldNeighbours.push_back(localOldNeighbors);
 		}
 	}
@@ -285,35 +507,28 @@ void DynamicHyperbolicGenerator::getEventsFromNodeMovement(vector<GraphEvent> &r
 		double oldphi = angles[toWiggle[j]];
 		double oldr = radii[toWiggle[j]];
 		moveNode(toWiggle[j]);
-		if (T > 0) {
-			//updating Quadtree
-			#pragma omp critical
-			{
-				bool removed = quad.removeContent(toWiggle[j], oldphi, oldr);
+		//updating Quadtree
+		#pragma omp critical
+		{
+			bool removed = quad.removeContent(toWiggle[j], oldphi, oldr);
 #ifndef NDEBUG
-				assert(removed);
+			assert(removed);
 #else
-				((void)(removed));
+			((void)(removed));
 #endif
-				quad.addContent(toWiggle[j], angles[toWiggle[j]], radii[toWiggle[j]]);
-			}
+			quad.addContent(toWiggle[j], angles[toWiggle[j]], radii[toWiggle[j]]);
 		}
 	}
 
-	if (T == 0) {
-		recomputeBands();//update bands
-	}
+	//the frozen layout also serves the queries for the old neighbours in the next step
+	quad.freeze();
 
 	//now get the new edges and see what changed
 	#pragma omp parallel for
 	for (omp_index j = 0; j < static_cast<omp_index>(toWiggle.size()); j++) {
 		vector<index> newNeighbours;
-		if (T == 0) {
-			newNeighbours = getNeighborsInBands(toWiggle[j], true);
-		} else {
-			Point2D<double> q = HyperbolicSpace::polarToCartesian(angles[toWiggle[j]], radii[toWiggle[j]]);
-			quad.getElementsProbabilistically(q, edgeProb, suppressLeft, newNeighbours);
-		}
+		Point2D<double> q = HyperbolicSpace::polarToCartesian(angles[toWiggle[j]], radii[toWiggle[j]]);
+		quad.getElementsProbabilistically(q, edgeProb, suppressLeft, newNeighbours);
 
 		std::sort(oldNeighbours[j].begin(), oldNeighbours[j].end());
 		std::sort(newNeighbours.begin(), newNeighbours.end());
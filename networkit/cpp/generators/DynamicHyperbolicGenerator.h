@@ -8,10 +8,12 @@
 #ifndef DYNAMICHYPERBOLICGENERATOR_H_
 #define DYNAMICHYPERBOLICGENERATOR_H_
 
+#include <array>
 #include <map>
 
 #include "DynamicGraphGenerator.h"
 #include "quadtree/Quadtree.h"
+#include "../geometric/HyperbolicPoints.h"
 
 
 namespace NetworKit {
@@ -86,12 +88,32 @@ private:
 	void initializeMovement();
 
 	/**
-	 * Generate initial movement vectors for all points
+	 * Distribute all points to the bands, sorted by angle and radius
 	 */
 	void recomputeBands();
 
+	/**
+	 * @return Index of the band containing radius @a r.
+	 */
+	index bandOf(double r) const;
+
+	/**
+	 * Update the bands after the nodes in @a moved have been moved, without touching the other nodes
+	 * of unaffected bands.
+	 *
+	 * @param moved moved nodes, must be marked in isMoving
+	 * @param oldRadii radii of the moved nodes before the movement
+	 */
+	void updateBands(const vector<index> &moved, const vector<double> &oldRadii);
+
 	vector<index> getNeighborsInBands(index i, bool bothDirections=true);
 
+	/**
+	 * @return Positions in the sorted @a bandAngles of a band starting at radius @a cLow which may be
+	 * within distance R of (@a phi, @a r), as two ranges like HyperbolicGenerator::getPointRangesWithinAngles.
+	 */
+	std::array<std::pair<index, index>, 2> candidateRanges(double phi, double r, double cLow, const vector<double> &bandAngles) const;
+
 	/**
 	 * Execute node movement part of time step
 	 *
@@ -99,6 +121,15 @@ private:
 	 */
 	void getEventsFromNodeMovement(vector<GraphEvent> &result);
 
+	/**
+	 * Execute node movement part of time step for T = 0 kinetically: the bands are updated in place
+	 * and only the pairs whose distance changed are compared, instead of recomputing the bands and the
+	 * neighborhoods of the moved nodes before and after the movement.
+	 *
+	 * @param result vector to store GraphEvents in
+	 */
+	void getEventsFromNodeMovementInBands(vector<GraphEvent> &result);
+
 	/**
      * Move a single node
 	 *
@@ -127,8 +158,10 @@ private:
 	//data structures
 	Quadtree<index, false> quad;
 	vector<double> bandRadii;
-	vector<vector<Point2D<double>>> bands;
+	vector<vector<index> > bandIds;
 	vector<vector<double> > bandAngles;
+	vector<HyperbolicPoints> bandPoints;
+	vector<bool> isMoving;
 
 	bool initialized;
 };
@@ -0,0 +1,183 @@
+/*
+ * EdgeSink.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include <limits>
+#include <stdexcept>
+
+#include <omp.h>
+
+#include "EdgeSink.h"
+
+namespace NetworKit {
+
+namespace {
+
+void checkWidth(uint8_t width) {
+	if (width != 4 && width != 8) {
+		throw std::runtime_error("Only width 4 and 8 are supported");
+	}
+}
+
+void checkNodeIds(count n, uint8_t width) {
+	if (width == 4 && n > static_cast<count>(std::numeric_limits<uint32_t>::max()) + 1) {
+		throw std::runtime_error("Error, the node ids cannot be represented by an unsigned int of width 4. Please use a width of 8.");
+	}
+}
+
+/**
+ * Appends @a u and @a v to @a buffer as little endian unsigned integers of width @a width.
+ */
+void encodeEdge(std::vector<char>& buffer, node u, node v, uint8_t width) {
+	for (uint8_t w = 0; w < width; ++w) {
+		buffer.push_back(static_cast<char>(u));
+		u >>= 8;
+	}
+	for (uint8_t w = 0; w < width; ++w) {
+		buffer.push_back(static_cast<char>(v));
+		v >>= 8;
+	}
+}
+
+} // namespace
+
+void GraphBuilderEdgeSink::open(count n, bool directed) {
+	builder = GraphBuilder(n, false, directed);
+}
+
+void GraphBuilderEdgeSink::addEdge(node u, node v) {
+	builder.addHalfOutEdge(u, v);
+}
+
+void GraphBuilderEdgeSink::close() {
+}
+
+Graph GraphBuilderEdgeSink::getGraph() {
+	return builder.toGraph(true, true);
+}
+
+BinaryFileEdgeSink::BinaryFileEdgeSink(const std::string& path, uint8_t width, count bufferSize) :
+		path(path), width(width), bufferSize(bufferSize) {
+	checkWidth(width);
+}
+
+void BinaryFileEdgeSink::open(count n, bool) {
+	checkNodeIds(n, width);
+	out.open(path, std::ios::trunc | std::ios::binary);
+	if (!out) {
+		throw std::runtime_error("Error: edge file couldn't be opened");
+	}
+	buffers.assign(omp_get_max_threads(), std::vector<char>());
+	for (std::vector<char>& buffer : buffers) {
+		buffer.reserve(bufferSize + 2 * width);
+	}
+}
+
+void BinaryFileEdgeSink::addEdge(node u, node v) {
+	std::vector<char>& buffer = buffers[omp_get_thread_num()];
+	encodeEdge(buffer, u, v, width);
+	if (buffer.size() >= bufferSize) {
+		flush(buffer);
+	}
+}
+
+void BinaryFileEdgeSink::flush(std::vector<char>& buffer) {
+	// errors are only reported in close() as exceptions must not leave a parallel region
+	std::lock_guard<std::mutex> lock(outMutex);
+	out.write(buffer.data(), buffer.size());
+	buffer.clear();
+}
+
+void BinaryFileEdgeSink::close() {
+	for (std::vector<char>& buffer : buffers) {
+		flush(buffer);
+	}
+	buffers.clear();
+	out.close();
+	if (!out) {
+		throw std::runtime_error("Error: writing the edge file failed");
+	}
+}
+
+ShardedBinaryFileEdgeSink::ShardedBinaryFileEdgeSink(const std::string& path, uint8_t width, count bufferSize) :
+		path(path), width(width), bufferSize(bufferSize) {
+	checkWidth(width);
+}
+
+void ShardedBinaryFileEdgeSink::open(count n, bool) {
+	checkNodeIds(n, width);
+	const count threads = omp_get_max_threads();
+	shards.clear();
+	buffers.assign(threads, std::vector<char>());
+	for (index i = 0; i < threads; ++i) {
+		shards.emplace_back(new std::ofstream(path + "." + std::to_string(i), std::ios::trunc | std::ios::binary));
+		if (!*shards.back()) {
+			throw std::runtime_error("Error: edge file couldn't be opened");
+		}
+		buffers[i].reserve(bufferSize + 2 * width);
+	}
+}
+
+void ShardedBinaryFileEdgeSink::addEdge(node u, node v) {
+	const index thread = omp_get_thread_num();
+	std::vector<char>& buffer = buffers[thread];
+	encodeEdge(buffer, u, v, width);
+	if (buffer.size() >= bufferSize) {
+		shards[thread]->write(buffer.data(), buffer.size());
+		buffer.clear();
+	}
+}
+
+void ShardedBinaryFileEdgeSink::close() {
+	bool failed = false;
+	for (index i = 0; i < shards.size(); ++i) {
+		shards[i]->write(buffers[i].data(), buffers[i].size());
+		shards[i]->close();
+		failed = failed || !*shards[i];
+	}
+	buffers.clear();
+	if (failed) {
+		throw std::runtime_error("Error: writing the edge files failed");
+	}
+}
+
+std::vector<std::string> ShardedBinaryFileEdgeSink::getShardPaths() const {
+	std::vector<std::string> paths;
+	for (index i = 0; i < shards.size(); ++i) {
+		paths.push_back(path + "." + std::to_string(i));
+	}
+	return paths;
+}
+
+void CountingEdgeSink::open(count, bool) {
+	counters.assign(omp_get_max_threads(), Counter());
+}
+
+void CountingEdgeSink::addEdge(node u, node v) {
+	Counter& counter = counters[omp_get_thread_num()];
+	++counter.edges;
+	counter.selfLoops += (u == v);
+}
+
+void CountingEdgeSink::close() {
+}
+
+count CountingEdgeSink::numberOfEdges() const {
+	count edges = 0;
+	for (const Counter& counter : counters) {
+		edges += counter.edges;
+	}
+	return edges;
+}
+
+count CountingEdgeSink::numberOfSelfLoops() const {
+	count selfLoops = 0;
+	for (const Counter& counter : counters) {
+		selfLoops += counter.selfLoops;
+	}
+	return selfLoops;
+}
+
+} /* namespace NetworKit */
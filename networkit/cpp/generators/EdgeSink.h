@@ -0,0 +1,165 @@
+/*
+ * EdgeSink.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef EDGESINK_H_
+#define EDGESINK_H_
+
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "../graph/Graph.h"
+#include "../graph/GraphBuilder.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup generators
+ * Receives the edges of a generated graph, see StaticGraphGenerator::generateEdges().
+ *
+ * The generator calls open() once, then addEdge() for every edge and finally close().
+ * addEdge() is called in parallel, but all edges with the same source u are added by
+ * the same thread, so sinks can keep per-thread state indexed by omp_get_thread_num().
+ * Every edge is added exactly once, also for undirected graphs.
+ */
+class EdgeSink {
+public:
+	virtual ~EdgeSink() = default;
+
+	/**
+	 * Prepares the sink for a graph with @a n nodes.
+	 */
+	virtual void open(count n, bool directed) = 0;
+
+	/**
+	 * Adds the edge (@a u, @a v).
+	 */
+	virtual void addEdge(node u, node v) = 0;
+
+	/**
+	 * Called after all edges have been added.
+	 */
+	virtual void close() = 0;
+};
+
+/**
+ * @ingroup generators
+ * Collects the edges in a GraphBuilder to create an in-memory Graph.
+ */
+class GraphBuilderEdgeSink : public EdgeSink {
+public:
+	void open(count n, bool directed) override;
+	void addEdge(node u, node v) override;
+	void close() override;
+
+	/**
+	 * @return The graph consisting of the added edges. Can only be called once after close().
+	 */
+	Graph getGraph();
+
+private:
+	GraphBuilder builder;
+};
+
+/**
+ * @ingroup generators
+ * Writes the edges to a binary file as pairs (u, v) of unsigned little endian integers of
+ * the given width, in the same encoding as BinaryEdgeListPartitionWriter. Each thread
+ * collects its edges in a buffer of bounded size which is appended to the file when it
+ * is full, so the memory does not depend on the number of edges. The order of the edges
+ * in the file depends on the scheduling of the threads.
+ */
+class BinaryFileEdgeSink : public EdgeSink {
+public:
+	/**
+	 * @param[in] path The file to write to.
+	 * @param[in] width The width of the written integers (supported values: 4, 8, default: 8).
+	 * @param[in] bufferSize The number of bytes buffered per thread.
+	 */
+	BinaryFileEdgeSink(const std::string& path, uint8_t width = 8, count bufferSize = 1 << 20);
+
+	void open(count n, bool directed) override;
+	void addEdge(node u, node v) override;
+	void close() override;
+
+private:
+	void flush(std::vector<char>& buffer);
+
+	std::string path;
+	uint8_t width;
+	count bufferSize;
+	std::ofstream out;
+	std::mutex outMutex;
+	std::vector<std::vector<char>> buffers;
+};
+
+/**
+ * @ingroup generators
+ * Like BinaryFileEdgeSink, but every thread writes to its own file path.i, where i is the id
+ * of the thread. As no thread waits for another one, this scales with the number of threads
+ * as long as the file system keeps up. The shards together contain every edge exactly once.
+ */
+class ShardedBinaryFileEdgeSink : public EdgeSink {
+public:
+	/**
+	 * @param[in] path The prefix of the paths of the shards.
+	 * @param[in] width The width of the written integers (supported values: 4, 8, default: 8).
+	 * @param[in] bufferSize The number of bytes buffered per thread.
+	 */
+	ShardedBinaryFileEdgeSink(const std::string& path, uint8_t width = 8, count bufferSize = 1 << 20);
+
+	void open(count n, bool directed) override;
+	void addEdge(node u, node v) override;
+	void close() override;
+
+	/**
+	 * @return The paths of the shards written by the last call of open().
+	 */
+	std::vector<std::string> getShardPaths() const;
+
+private:
+	std::string path;
+	uint8_t width;
+	count bufferSize;
+	std::vector<std::unique_ptr<std::ofstream>> shards;
+	std::vector<std::vector<char>> buffers;
+};
+
+/**
+ * @ingroup generators
+ * Only counts the edges, e.g. to benchmark a generator without the costs of storing the graph.
+ */
+class CountingEdgeSink : public EdgeSink {
+public:
+	void open(count n, bool directed) override;
+	void addEdge(node u, node v) override;
+	void close() override;
+
+	/**
+	 * @return The number of edges added since the last call of open().
+	 */
+	count numberOfEdges() const;
+
+	/**
+	 * @return The number of self loops added since the last call of open().
+	 */
+	count numberOfSelfLoops() const;
+
+private:
+	// padded to a cache line, so the threads do not share the lines of their counters
+	struct Counter {
+		count edges;
+		count selfLoops;
+		char padding[64 - 2 * sizeof(count)];
+	};
+
+	std::vector<Counter> counters;
+};
+
+} /* namespace NetworKit */
+#endif /* EDGESINK_H_ */
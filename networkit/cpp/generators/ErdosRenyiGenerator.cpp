@@ -6,51 +6,38 @@
  */
 
 #include "ErdosRenyiGenerator.h"
-#include "../auxiliary/Random.h"
+#include "../graph/GraphBuilder.h"
 #include "../auxiliary/SignalHandling.h"
 
 namespace NetworKit {
 
+const count ErdosRenyiGenerator::maxChunks;
+
 ErdosRenyiGenerator::ErdosRenyiGenerator(count nNodes, double prob, bool directed): n(nNodes), p(prob), directed(directed) {
 
 }
 
+Graph ErdosRenyiGenerator::generate() {
+	Aux::SignalHandler handler;
+	GraphBuilder builder(n, false, directed);
+
+	// each row u is generated by one thread, so its half edges can be added without locking
+	parallelForEdges([&](node u, node v) {
+		builder.addHalfOutEdge(u, v);
+	});
 
-/**
- * Returns number of steps you need to wait until the next success (edge) occurs.
- */
-static inline count get_next_edge_distance(const double log_cp) {
-	return (count) 1 + floor(log(1.0 - Aux::Random::probability()) / log_cp);
+	handler.assureRunning();
+	return builder.toGraph(true, true);
 }
 
-Graph ErdosRenyiGenerator::generate() {
+void ErdosRenyiGenerator::generateEdges(EdgeSink& sink) {
 	Aux::SignalHandler handler;
-	Graph G(n, false, directed);
-	const double log_cp = log(1.0 - p); // log of counter probability
-
-	// create edges
-	node curr = 1;
-	node next = -1; // according to Batagelj/Brandes
-	while (curr < n) {
-		handler.assureRunning();
-		// compute new step length
-		next += get_next_edge_distance(log_cp);
-
-		// check if at end of row
-		while ((next >= curr) && (curr < n)) {
-			// adapt to next row
-			next = next - curr;
-			curr++;
-		}
-
-		// insert edge
-		if (curr < n) {
-			G.addEdge(curr, next);
-		}
-	}
-
-	G.shrinkToFit();
-	return G;
+	sink.open(n, directed);
+	parallelForEdges([&](node u, node v) {
+		sink.addEdge(u, v);
+	});
+	handler.assureRunning();
+	sink.close();
 }
 
 } /* namespace NetworKit */
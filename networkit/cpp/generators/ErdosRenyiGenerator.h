@@ -9,7 +9,10 @@
 #define ERDOSRENYIGENERATOR_H_
 
 #include "StaticGraphGenerator.h"
+#include "../auxiliary/Random.h"
+#include <algorithm>
 #include <cmath>
+#include <random>
 
 namespace NetworKit {
 
@@ -23,6 +26,19 @@ protected:
 	double p;
 	bool directed;
 
+	/**
+	 * The rows are split into this many chunks (at most one per row) which are generated
+	 * in parallel, each with its own random stream.
+	 */
+	static const count maxChunks = 1024;
+
+	/**
+	 * @return First row of chunk @a chunk such that all chunks contain about the same number of node pairs.
+	 */
+	node firstRowOfChunk(index chunk, count chunks) const {
+		return chunk >= chunks ? n : static_cast<node>(n * std::sqrt(static_cast<double>(chunk) / chunks));
+	}
+
 public:
 	/**
 	 * Creates random graphs in the G(n,p) model.
@@ -35,8 +51,60 @@ public:
 	 */
 	ErdosRenyiGenerator(count nNodes, double prob, bool directed=false);
 
-	virtual Graph generate();
+	virtual Graph generate() override;
+
+	/**
+	 * Passes the edges of a new graph to @a sink while they are generated.
+	 */
+	virtual void generateEdges(EdgeSink& sink) override;
+
+	/**
+	 * Calls @a handle(u, v) for every edge (u, v) of a new random graph without storing the graph,
+	 * e.g. to write the edges to a file. The calls are made in parallel, but all edges with the
+	 * same u are created by the same thread. The graph only depends on the seed of Aux::Random,
+	 * not on the number of threads.
+	 */
+	template<typename L>
+	void parallelForEdges(L handle) const;
 };
 
+template<typename L>
+void ErdosRenyiGenerator::parallelForEdges(L handle) const {
+	if (n < 2 || p <= 0) {
+		return;
+	}
+	const double log_cp = std::log(1.0 - p); // log of counter probability
+	// larger than the number of node pairs of any chunk, keeps the skips representable
+	const double maxSkip = static_cast<double>(n) * static_cast<double>(n);
+	const uint64_t seed = Aux::Random::integer();
+	const count chunks = std::min(n, maxChunks);
+
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (omp_index chunk = 0; chunk < static_cast<omp_index>(chunks); ++chunk) {
+		std::mt19937_64 urng = Aux::Random::getStreamURNG(seed, chunk);
+		std::uniform_real_distribution<double> distribution;
+		const node end = firstRowOfChunk(chunk + 1, chunks);
+		// row curr consists of the pairs (curr, next) with next < curr
+		node curr = firstRowOfChunk(chunk, chunks);
+		node next = -1; // according to Batagelj/Brandes
+		while (curr < end) {
+			// compute new step length
+			const double skip = std::floor(std::log(1.0 - distribution(urng)) / log_cp);
+			next += 1 + static_cast<count>(std::min(skip, maxSkip));
+
+			// check if at end of row
+			while ((next >= curr) && (curr < end)) {
+				// adapt to next row
+				next = next - curr;
+				curr++;
+			}
+
+			if (curr < end) {
+				handle(curr, next);
+			}
+		}
+	}
+}
+
 } /* namespace NetworKit */
 #endif /* ERDOSRENYIGENERATOR_H_ */
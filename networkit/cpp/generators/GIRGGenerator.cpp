@@ -0,0 +1,558 @@
+/*
+ * GIRGGenerator.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <omp.h>
+
+#include "GIRGGenerator.h"
+#include "../graph/GraphBuilder.h"
+#include "../auxiliary/Parallel.h"
+#include "../auxiliary/Random.h"
+
+namespace NetworKit {
+
+namespace {
+
+void checkTemperature(double T) {
+	if (T < 0 || T >= 1) throw std::runtime_error("Temperature must be in [0, 1).");
+}
+
+/**
+ * Computes expected average degrees for given weights. Averaged over the positions, the volume
+ * of the ball around one node reaching another one is uniform in [0, 1], so two nodes with
+ * t = c w_u w_v / W are adjacent with probability min(t, 1) for T = 0 and
+ * (alpha t - t^alpha) / (alpha - 1) for t < 1 and alpha = 1/T.
+ */
+class DegreeEstimator {
+public:
+	DegreeEstimator(const std::vector<double> &weights, double T) : sorted(weights), T(T), alpha(T > 0 ? 1 / T : 0) {
+		Aux::Parallel::sort(sorted.begin(), sorted.end());
+		n = sorted.size();
+		prefixSums.assign(n + 1, 0);
+		scaledPowerSums.assign(n + 1, 0);
+		for (index i = 0; i < n; i++) {
+			prefixSums[i + 1] = prefixSums[i] + sorted[i];
+			// sum of (w_v / w_i)^alpha over v <= i, which does not overflow for large alpha
+			if (T > 0) {
+				scaledPowerSums[i + 1] = (i == 0 ? 0 : scaledPowerSums[i] * std::pow(sorted[i - 1] / sorted[i], alpha)) + 1;
+			}
+		}
+	}
+
+	double averageDegree(double scaling) const {
+		if (n == 0) return 0;
+		const double factor = scaling / prefixSums[n];
+		const count chunks = std::min<count>(n, 16 * omp_get_max_threads());
+		double total = 0;
+		#pragma omp parallel for schedule(dynamic, 1) reduction(+:total)
+		for (omp_index chunk = 0; chunk < static_cast<omp_index>(chunks); chunk++) {
+			const index begin = n * chunk / chunks;
+			const index end = n * (chunk + 1) / chunks;
+			// the nodes v with t >= 1 are a suffix of the sorted weights, which grows with w_u
+			index first = std::lower_bound(sorted.begin(), sorted.end(), 1 / (factor * sorted[begin])) - sorted.begin();
+			for (index u = begin; u < end; u++) {
+				const double k = factor * sorted[u];
+				while (first < n && k * sorted[first] < 1) first++;
+				while (first > 0 && k * sorted[first - 1] >= 1) first--;
+				total += sumBelow(k, first) + (n - first) - probability(k * sorted[u]);
+			}
+		}
+		return total / n;
+	}
+
+private:
+	std::vector<double> sorted;
+	double T;
+	double alpha;
+	count n;
+	std::vector<double> prefixSums;
+	std::vector<double> scaledPowerSums;
+
+	double probability(double t) const {
+		if (t >= 1) return 1;
+		if (T == 0) return t;
+		return (alpha * t - std::pow(t, alpha)) / (alpha - 1);
+	}
+
+	/**
+	 * @return Sum of probability(k w_v) over the first @a end sorted weights, all with k w_v < 1.
+	 */
+	double sumBelow(double k, index end) const {
+		if (T == 0) return k * prefixSums[end];
+		if (end == 0) return 0;
+		return (alpha * k * prefixSums[end] - std::pow(k * sorted[end - 1], alpha) * scaledPowerSums[end]) / (alpha - 1);
+	}
+};
+
+/**
+ * Sampling algorithm of Bringmann, Keusch and Lengler. The cell of level l with code a consists of the
+ * points whose coordinates, multiplied by 2^l, have the integer parts encoded in a: bit b of the
+ * coordinate in dimension k is bit b * d + k of a. The points of a layer are sorted by the code of their
+ * cell on the deepest level needed for the layer, so the points of a cell of any level up to this one
+ * are a contiguous range.
+ */
+class Sampler {
+public:
+	Sampler(const std::vector<double> &weights, const std::vector<double> &positions, count dimension, double scaling, double T) :
+			weights(weights), positions(positions), n(weights.size()), d(dimension), T(T), alpha(T > 0 ? 1 / T : 0) {
+		double totalWeight = 0;
+		minWeight = n > 0 ? weights[0] : 1;
+		maxWeight = minWeight;
+		for (double weight : weights) {
+			if (!(weight > 0)) throw std::runtime_error("Weights must be positive.");
+			totalWeight += weight;
+			minWeight = std::min(minWeight, weight);
+			maxWeight = std::max(maxWeight, weight);
+		}
+		factor = scaling / totalWeight;
+		maxLevel = std::min<count>(std::floor(std::log2(std::max<count>(n, 1)) / d), 62 / d);
+		buildLayers();
+	}
+
+	Graph run() {
+		seed = Aux::Random::integer();
+		const count threads = omp_get_max_threads();
+		buffers.assign(threads, std::vector<std::vector<std::pair<node, node>>>(threads));
+		#pragma omp parallel
+		{
+			#pragma omp single nowait
+			{
+				for (index i = 0; i < layers.size(); i++) {
+					for (index j = i; j < layers.size(); j++) {
+						#pragma omp task
+						{
+							TaskRandom random(seed, streamOf(i, j, 0, 0, 0));
+							visit(i, j, targetLevel(i, j), 0, 0, 0, random);
+						}
+					}
+				}
+			}
+		}
+		return toGraph();
+	}
+
+private:
+	/**
+	 * Pairs of cells with fewer pairs of points are handled by the task that finds them.
+	 */
+	static const count taskGrain = 1 << 16;
+
+	struct Layer {
+		index begin; //!< the points of the layer are [begin, end) of the sorted points
+		index end;
+		count level; //!< deepest level needed for the layer
+		index firstOffset; //!< the cell boundaries of the layer start at cellOffsets[firstOffset]
+	};
+
+	typedef std::pair<index, index> Range;
+
+	const std::vector<double> &weights;
+	const std::vector<double> &positions;
+	count n;
+	count d;
+	double T;
+	double alpha;
+	double factor; //!< scaling / W
+	double minWeight;
+	double maxWeight;
+	count maxLevel;
+
+	// the points sorted by layer and cell
+	std::vector<node> ids;
+	std::vector<double> sortedWeights;
+	std::vector<double> sortedPositions;
+	std::vector<Layer> layers;
+	std::vector<index> cellOffsets;
+
+	uint64_t seed; //!< seed of the random streams of the tasks
+
+	/**
+	 * The half edges found by every thread, bucketed by ranges of their first node, so that the
+	 * buckets can be added to a GraphBuilder in parallel.
+	 */
+	std::vector<std::vector<std::vector<std::pair<node, node>>>> buffers;
+
+	/**
+	 * Uniform random numbers of one task. The generator of its stream is only created once the task
+	 * draws a number, since most tasks do not need any, e.g. for T = 0.
+	 */
+	class TaskRandom {
+	public:
+		TaskRandom(uint64_t seed, uint64_t stream) : seed(seed), stream(stream) {
+		}
+
+		double next() {
+			if (!urng) {
+				urng.reset(new std::mt19937_64(Aux::Random::getStreamURNG(seed, stream)));
+			}
+			return distribution(*urng);
+		}
+
+	private:
+		uint64_t seed;
+		uint64_t stream;
+		std::unique_ptr<std::mt19937_64> urng;
+		std::uniform_real_distribution<double> distribution;
+	};
+
+	/**
+	 * @return Index of the random stream of the task that starts with the cells @a a and @a b of level @a level
+	 * in layers @a i and @a j.
+	 */
+	static uint64_t streamOf(index i, index j, count level, uint64_t a, uint64_t b) {
+		// the splitmix64 finalizer; equal indices of different tasks are very unlikely and only correlate them
+		auto mix = [](uint64_t x) {
+			x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+			x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+			return x ^ (x >> 31);
+		};
+		uint64_t stream = mix((i << 32) ^ (j << 8) ^ level);
+		stream = mix(stream ^ a);
+		return mix(stream ^ (b * 0x9E3779B97F4A7C15ull));
+	}
+
+	index layerOf(double weight) const {
+		int exponent;
+		std::frexp(weight / minWeight, &exponent);
+		return exponent - 1;
+	}
+
+	/**
+	 * @return Upper bound for c w_u w_v / W for u in layer @a i and v in layer @a j.
+	 */
+	double maxConnectionVolume(index i, index j) const {
+		return factor * minWeight * minWeight * std::ldexp(1.0, i + j + 2);
+	}
+
+	/**
+	 * @return Deepest level whose cells have at least the maximal connection volume of the layers,
+	 * so that points in layers @a i and @a j in cells which do not touch on this level are not adjacent
+	 * for T = 0.
+	 */
+	count targetLevel(index i, index j) const {
+		const double volume = maxConnectionVolume(i, j);
+		if (volume >= 1) return 0;
+		return std::min<count>(maxLevel, std::floor(-std::log2(volume) / d));
+	}
+
+	uint64_t cellCode(index v, count level) const {
+		const double cells = std::ldexp(1.0, level);
+		const uint64_t maxCoordinate = (uint64_t(1) << level) - 1;
+		uint64_t code = 0;
+		for (index k = 0; k < d; k++) {
+			const uint64_t coordinate = std::min(static_cast<uint64_t>(positions[v * d + k] * cells), maxCoordinate);
+			for (index b = 0; b < level; b++) {
+				code |= ((coordinate >> b) & 1) << (b * d + k);
+			}
+		}
+		return code;
+	}
+
+	uint64_t cellCoordinate(uint64_t code, count level, index k) const {
+		uint64_t coordinate = 0;
+		for (index b = 0; b < level; b++) {
+			coordinate |= ((code >> (b * d + k)) & 1) << b;
+		}
+		return coordinate;
+	}
+
+	/**
+	 * @return Maximum over the dimensions of the distance of the cells @a a and @a b on the torus,
+	 * counted in cells. The cells touch if and only if it is at most 1.
+	 */
+	uint64_t cellDistance(uint64_t a, uint64_t b, count level) const {
+		const uint64_t cells = uint64_t(1) << level;
+		uint64_t distance = 0;
+		for (index k = 0; k < d; k++) {
+			const uint64_t x = cellCoordinate(a, level, k);
+			const uint64_t y = cellCoordinate(b, level, k);
+			const uint64_t difference = x > y ? x - y : y - x;
+			distance = std::max(distance, std::min(difference, cells - difference));
+		}
+		return distance;
+	}
+
+	void buildLayers() {
+		const count numLayers = n > 0 ? layerOf(maxWeight) + 1 : 0;
+		std::vector<std::tuple<index, uint64_t, node>> keys(n);
+		#pragma omp parallel for
+		for (omp_index v = 0; v < static_cast<omp_index>(n); v++) {
+			const index layer = layerOf(weights[v]);
+			keys[v] = std::make_tuple(layer, cellCode(v, targetLevel(layer, 0)), v);
+		}
+		Aux::Parallel::sort(keys.begin(), keys.end());
+
+		ids.resize(n);
+		sortedWeights.resize(n);
+		sortedPositions.resize(n * d);
+		#pragma omp parallel for
+		for (omp_index p = 0; p < static_cast<omp_index>(n); p++) {
+			const node v = std::get<2>(keys[p]);
+			ids[p] = v;
+			sortedWeights[p] = weights[v];
+			std::copy(positions.begin() + v * d, positions.begin() + (v + 1) * d, sortedPositions.begin() + p * d);
+		}
+
+		layers.resize(numLayers);
+		index p = 0;
+		for (index i = 0; i < numLayers; i++) {
+			Layer &layer = layers[i];
+			layer.begin = p;
+			while (p < n && std::get<0>(keys[p]) == i) p++;
+			layer.end = p;
+			layer.level = targetLevel(i, 0);
+			layer.firstOffset = cellOffsets.size();
+			cellOffsets.resize(cellOffsets.size() + (uint64_t(1) << (layer.level * d)) + 1);
+		}
+
+		// cellOffsets of a cell is the first point of the layer whose code is not smaller
+		for (const Layer &layer : layers) {
+			const uint64_t cells = uint64_t(1) << (layer.level * d);
+			#pragma omp parallel for
+			for (omp_index q = layer.begin; q <= static_cast<omp_index>(layer.end); q++) {
+				const uint64_t from = q == static_cast<omp_index>(layer.begin) ? 0 : std::get<1>(keys[q - 1]) + 1;
+				const uint64_t to = q == static_cast<omp_index>(layer.end) ? cells : std::get<1>(keys[q]);
+				for (uint64_t cell = from; cell <= to; cell++) {
+					cellOffsets[layer.firstOffset + cell] = q;
+				}
+			}
+		}
+	}
+
+	/**
+	 * @return The points of layer @a i in cell @a a of level @a level.
+	 */
+	Range range(index i, count level, uint64_t a) const {
+		const Layer &layer = layers[i];
+		const count shift = d * (layer.level - level);
+		return Range(cellOffsets[layer.firstOffset + (a << shift)], cellOffsets[layer.firstOffset + ((a + 1) << shift)]);
+	}
+
+	/**
+	 * @return The number of pairs of points visit() handles for the cells @a a and @a b of level @a level in layers @a i and @a j.
+	 */
+	count pairsOf(index i, index j, count level, uint64_t a, uint64_t b) const {
+		const Range ai = range(i, level, a);
+		const Range bj = range(j, level, b);
+		count pairs = (ai.second - ai.first) * (bj.second - bj.first);
+		if (i != j && a != b) {
+			const Range bi = range(i, level, b);
+			const Range aj = range(j, level, a);
+			pairs += (bi.second - bi.first) * (aj.second - aj.first);
+		}
+		return pairs;
+	}
+
+	/**
+	 * Handles the pairs of points of layers @a i and @a j in the cells @a a and @a b of level @a level.
+	 * Every unordered pair of cells is visited once. Every task draws from a random stream of its own,
+	 * derived from the layers and cells it starts with, and handles the pairs of cells that are too small
+	 * for tasks of their own in a fixed order, so the graph does not depend on the scheduling.
+	 */
+	void visit(index i, index j, count target, count level, uint64_t a, uint64_t b, TaskRandom &random) {
+		const Range ai = range(i, level, a);
+		const Range bj = range(j, level, b);
+		// for different layers and cells, the points of layer i in b and of layer j in a are a second set of pairs
+		const bool mirrored = i != j && a != b;
+		const Range bi = mirrored ? range(i, level, b) : Range(0, 0);
+		const Range aj = mirrored ? range(j, level, a) : Range(0, 0);
+		const count pairs = (ai.second - ai.first) * (bj.second - bj.first) + (bi.second - bi.first) * (aj.second - aj.first);
+		if (pairs == 0) return;
+
+		const uint64_t distance = cellDistance(a, b, level);
+		if (distance <= 1) {
+			if (level == target) {
+				checkAll(ai, bj, i == j && a == b, random);
+				checkAll(bi, aj, false, random);
+			} else {
+				const uint64_t children = uint64_t(1) << d;
+				for (uint64_t s = 0; s < children; s++) {
+					for (uint64_t t = (a == b ? s : 0); t < children; t++) {
+						const uint64_t childA = (a << d) | s;
+						const uint64_t childB = (b << d) | t;
+						if (pairs >= taskGrain && pairsOf(i, j, level + 1, childA, childB) >= taskGrain) {
+							#pragma omp task
+							{
+								TaskRandom childRandom(seed, streamOf(i, j, level + 1, childA, childB));
+								visit(i, j, target, level + 1, childA, childB, childRandom);
+							}
+						} else {
+							visit(i, j, target, level + 1, childA, childB, random);
+						}
+					}
+				}
+			}
+		} else if (T > 0) {
+			// for T = 0, points in cells which do not touch on the target level are not adjacent
+			const double gap = std::ldexp(static_cast<double>(distance - 1), -static_cast<int>(level));
+			const double bound = std::min(1.0, std::pow(maxConnectionVolume(i, j) / std::pow(2 * gap, d), alpha));
+			sampleBounded(ai, bj, bound, random);
+			sampleBounded(bi, aj, bound, random);
+		}
+	}
+
+	/**
+	 * @return Volume of the ball around point @a p reaching point @a q.
+	 */
+	double volume(index p, index q) const {
+		double distance = 0;
+		for (index k = 0; k < d; k++) {
+			double difference = std::abs(sortedPositions[p * d + k] - sortedPositions[q * d + k]);
+			distance = std::max(distance, std::min(difference, 1 - difference));
+		}
+		// d is small, so multiplying is much faster than std::pow
+		double result = 1;
+		for (index k = 0; k < d; k++) {
+			result *= 2 * distance;
+		}
+		return result;
+	}
+
+	double probability(index p, index q) const {
+		const double t = factor * sortedWeights[p] * sortedWeights[q];
+		const double v = volume(p, q);
+		if (v <= t) return 1;
+		return T == 0 ? 0 : std::pow(t / v, alpha);
+	}
+
+	void addEdge(index p, index q) {
+		std::vector<std::vector<std::pair<node, node>>> &buckets = buffers[omp_get_thread_num()];
+		buckets[ids[p] * buckets.size() / n].emplace_back(ids[p], ids[q]);
+	}
+
+	/**
+	 * Checks all pairs of points of @a first and @a second, or all pairs of different points
+	 * of @a first if @a same is set.
+	 */
+	void checkAll(Range first, Range second, bool same, TaskRandom &random) {
+		for (index p = first.first; p < first.second; p++) {
+			for (index q = same ? p + 1 : second.first; q < second.second; q++) {
+				const double prob = probability(p, q);
+				if (prob == 1 || (prob > 0 && random.next() < prob)) {
+					addEdge(p, q);
+				}
+			}
+		}
+	}
+
+	/**
+	 * Samples the pairs of points of @a first and @a second, which are adjacent with probability
+	 * at most @a bound, by jumping over the candidates and correcting the probability.
+	 */
+	void sampleBounded(Range first, Range second, double bound, TaskRandom &random) {
+		const count secondSize = second.second - second.first;
+		const count total = (first.second - first.first) * secondSize;
+		if (total == 0 || bound <= 0) return;
+		if (bound >= 1) {
+			checkAll(first, second, false, random);
+			return;
+		}
+		const double logComplement = std::log1p(-bound);
+		for (index k = 0; ; k++) {
+			const double skip = std::floor(std::log(1 - random.next()) / logComplement);
+			if (skip >= static_cast<double>(total - k)) break;
+			k += static_cast<index>(skip);
+			const index p = first.first + k / secondSize;
+			const index q = second.first + k % secondSize;
+			if (random.next() * bound < probability(p, q)) {
+				addEdge(p, q);
+			}
+		}
+	}
+
+	Graph toGraph() {
+		// the nodes of a bucket are only filled by the thread that handles the bucket; the neighbors
+		// are sorted, so that their order does not depend on the threads that have found the edges
+		GraphBuilder builder(n);
+		const count buckets = buffers.size();
+		#pragma omp parallel for schedule(dynamic, 1)
+		for (omp_index bucket = 0; bucket < static_cast<omp_index>(buckets); bucket++) {
+			for (std::vector<std::vector<std::pair<node, node>>> &buffer : buffers) {
+				for (const std::pair<node, node> &edge : buffer[bucket]) {
+					builder.addHalfEdge(edge.first, edge.second);
+				}
+				std::vector<std::pair<node, node>>().swap(buffer[bucket]);
+			}
+		}
+		return builder.toGraph(true, true, true);
+	}
+};
+
+const count Sampler::taskGrain;
+
+} // namespace
+
+GIRGGenerator::GIRGGenerator(count n, count dimension, double avgDegree, double exponent, double T) :
+		n(n), dimension(dimension), avgDegree(avgDegree), exponent(exponent), T(T), scaling(0) {
+	if (dimension == 0) throw std::runtime_error("Dimension must be at least 1.");
+	if (exponent <= 2) throw std::runtime_error("Exponent of power-law distribution must be > 2");
+	if (avgDegree <= 0 || avgDegree >= n - 1) throw std::runtime_error("Average degree must be positive and less than n-1");
+	checkTemperature(T);
+}
+
+Graph GIRGGenerator::generate() {
+	weights.resize(n);
+	positions.resize(n * dimension);
+	const uint64_t seed = Aux::Random::integer();
+	const count chunkSize = 1 << 16;
+	const count chunks = (n + chunkSize - 1) / chunkSize;
+
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (omp_index chunk = 0; chunk < static_cast<omp_index>(chunks); chunk++) {
+		std::mt19937_64 urng = Aux::Random::getStreamURNG(seed, chunk);
+		std::uniform_real_distribution<double> distribution;
+		const node end = std::min<node>((chunk + 1) * chunkSize, n);
+		for (node v = chunk * chunkSize; v < end; v++) {
+			weights[v] = std::pow(1 - distribution(urng), -1 / (exponent - 1));
+			for (index k = 0; k < dimension; k++) {
+				positions[v * dimension + k] = distribution(urng);
+			}
+		}
+	}
+
+	scaling = fitScaling(weights, avgDegree, T);
+	return generate(weights, positions, dimension, scaling, T);
+}
+
+Graph GIRGGenerator::generate(const std::vector<double> &weights, const std::vector<double> &positions, count dimension, double scaling, double T) {
+	checkTemperature(T);
+	if (dimension == 0) throw std::runtime_error("Dimension must be at least 1.");
+	if (positions.size() != weights.size() * dimension) throw std::runtime_error("There must be dimension coordinates for each weight.");
+	if (!(scaling > 0)) throw std::runtime_error("Scaling must be positive.");
+	Sampler sampler(weights, positions, dimension, scaling, T);
+	return sampler.run();
+}
+
+double GIRGGenerator::fitScaling(const std::vector<double> &weights, double avgDegree, double T) {
+	checkTemperature(T);
+	if (avgDegree <= 0 || avgDegree >= weights.size() - 1.0) throw std::runtime_error("Average degree must be positive and less than n-1");
+	const DegreeEstimator estimator(weights, T);
+	// the expected average degree grows with the scaling from 0 to n-1
+	double low = 1, high = 1;
+	while (estimator.averageDegree(high) < avgDegree) high *= 2;
+	while (estimator.averageDegree(low) > avgDegree) low /= 2;
+	for (index i = 0; i < 100 && high > low * (1 + 1e-9); i++) {
+		const double middle = std::sqrt(low * high);
+		if (estimator.averageDegree(middle) < avgDegree) {
+			low = middle;
+		} else {
+			high = middle;
+		}
+	}
+	return std::sqrt(low * high);
+}
+
+double GIRGGenerator::expectedAverageDegree(const std::vector<double> &weights, double scaling, double T) {
+	checkTemperature(T);
+	return DegreeEstimator(weights, T).averageDegree(scaling);
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,108 @@
+/*
+ * GIRGGenerator.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef GIRGGENERATOR_H_
+#define GIRGGENERATOR_H_
+
+#include <vector>
+
+#include "StaticGraphGenerator.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup generators
+ * Creates geometric inhomogeneous random graphs (GIRGs) as introduced by Bringmann, Keusch and
+ * Lengler: "Geometric inhomogeneous random graphs", Theoretical Computer Science 760 (2019).
+ *
+ * Every node v has a weight w_v drawn from a power law and a position x_v drawn uniformly from the
+ * d-dimensional torus [0,1)^d. Let W be the sum of the weights, vol(u, v) = (2 |x_u - x_v|)^d the
+ * volume of the ball around x_u reaching x_v in the maximum norm on the torus and
+ * t(u, v) = c w_u w_v / W for the scaling constant c. For temperature T = 0 (threshold variant) u and v
+ * are adjacent if and only if vol(u, v) <= t(u, v), for 0 < T < 1 they are adjacent with probability
+ * min(1, (t(u, v) / vol(u, v))^(1/T)).
+ *
+ * The generation follows the linear expected time sampling algorithm of the paper: the nodes are
+ * split into layers of weights within a factor of 2 and every pair of layers is handled on the
+ * level of a hierarchy of grid cells where the cells are about as large as the distance at which
+ * the nodes connect. Pairs of points in neighboring cells of this level are checked one by one,
+ * pairs of points in cells further apart are sampled with geometric jumps like in
+ * QuadNode::getElementsProbabilistically. The pairs of cells are processed in parallel.
+ */
+class GIRGGenerator: public StaticGraphGenerator {
+public:
+	/**
+	 * @param n Number of nodes.
+	 * @param dimension Dimension d of the torus.
+	 * @param avgDegree Expected average degree, determines the scaling constant c.
+	 * @param exponent Exponent of the power-law distribution of the weights, must be > 2.
+	 * @param T Temperature, 0 for the threshold variant, otherwise in (0, 1).
+	 */
+	GIRGGenerator(count n, count dimension = 1, double avgDegree = 10, double exponent = 2.5, double T = 0);
+
+	/**
+	 * @return Graph with new random weights and positions, generated according to the parameters
+	 * specified in the constructor.
+	 */
+	virtual Graph generate();
+
+	/**
+	 * Generates a graph for given weights and positions.
+	 *
+	 * @param weights Positive weight of each node.
+	 * @param positions Coordinates of the nodes in [0,1), the i-th coordinate of node v is positions[v * dimension + i].
+	 * @param dimension Dimension d of the torus.
+	 * @param scaling Scaling constant c.
+	 * @param T Temperature, 0 for the threshold variant, otherwise in (0, 1).
+	 */
+	static Graph generate(const std::vector<double> &weights, const std::vector<double> &positions, count dimension, double scaling, double T = 0);
+
+	/**
+	 * @return The scaling constant c for which graphs generated for @a weights have the expected
+	 * average degree @a avgDegree. The expected average degree does not depend on the dimension.
+	 */
+	static double fitScaling(const std::vector<double> &weights, double avgDegree, double T = 0);
+
+	/**
+	 * @return The expected average degree of graphs generated for @a weights and @a scaling.
+	 */
+	static double expectedAverageDegree(const std::vector<double> &weights, double scaling, double T = 0);
+
+	/**
+	 * @return The weights of the nodes of the last generated graph.
+	 */
+	const std::vector<double> &getWeights() const {
+		return weights;
+	}
+
+	/**
+	 * @return The positions of the nodes of the last generated graph, see generate(weights, positions, dimension, scaling, T).
+	 */
+	const std::vector<double> &getPositions() const {
+		return positions;
+	}
+
+	/**
+	 * @return The scaling constant used for the last generated graph.
+	 */
+	double getScaling() const {
+		return scaling;
+	}
+
+private:
+	count n;
+	count dimension;
+	double avgDegree;
+	double exponent;
+	double T;
+
+	std::vector<double> weights;
+	std::vector<double> positions;
+	double scaling;
+};
+
+} /* namespace NetworKit */
+#endif /* GIRGGENERATOR_H_ */
@@ -70,34 +70,70 @@ Graph HyperbolicGenerator::generate() {
 }
 
 Graph HyperbolicGenerator::generate(count n, double R, double alpha, double T) {
+	vector<double> angles, radii;
+	samplePoints(n, R, alpha, angles, radii);
+	return generate(angles, radii, R, T);
+}
+
+void HyperbolicGenerator::generateEdges(EdgeSink& sink) {
+	vector<double> angles, radii;
+	samplePoints(nodeCount, R, alpha, angles, radii);
+	generateEdges(angles, radii, R, temperature, sink);
+}
+
+void HyperbolicGenerator::generateEdges(const vector<double> &angles, const vector<double> &radii, double R, double T, EdgeSink& sink) {
+	if (T < 0) throw std::runtime_error("Temperature cannot be negative.");
+	sink.open(angles.size(), false);
+	// every edge is found from both of its nodes, it is only passed on from one of them
+	if (T == 0) {
+		forNeighborhoodsCold(angles, radii, R, false, [&](index i, const vector<index> &near) {
+			for (index j : near) {
+				if (radii[j] > radii[i] || (radii[j] == radii[i] && angles[j] < angles[i])) {
+					sink.addEdge(i, j);
+				}
+			}
+		});
+	} else {
+		forNeighborhoodsWarm(angles, radii, R, T, [&](index i, const vector<index> &near) {
+			for (index j : near) {
+				if (j > i) {
+					sink.addEdge(i, j);
+				}
+			}
+		});
+	}
+	sink.close();
+}
+
+void HyperbolicGenerator::samplePoints(count n, double R, double alpha, vector<double> &angles, vector<double> &radii) {
 	assert(R > 0);
-	vector<double> angles(n);
-	vector<double> radii(n);
+	vector<double> sampledAngles(n);
+	vector<double> sampledRadii(n);
 
 	//sample points randomly
-	HyperbolicSpace::fillPoints(angles, radii, R, alpha);
+	HyperbolicSpace::fillPoints(sampledAngles, sampledRadii, R, alpha);
 	vector<index> permutation(n);
 
 	index p = 0;
 	std::generate(permutation.begin(), permutation.end(), [&p](){return p++;});
 
 	//can probably be parallelized easily, but doesn't bring much benefit
-	Aux::Parallel::sort(permutation.begin(), permutation.end(), [&angles,&radii](index i, index j){return angles[i] < angles[j] || (angles[i] == angles[j] && radii[i] < radii[j]);});
+	Aux::Parallel::sort(permutation.begin(), permutation.end(), [&sampledAngles,&sampledRadii](index i, index j){return sampledAngles[i] < sampledAngles[j] || (sampledAngles[i] == sampledAngles[j] && sampledRadii[i] < sampledRadii[j]);});
 
-	vector<double> anglecopy(n);
-	vector<double> radiicopy(n);
+	angles.resize(n);
+	radii.resize(n);
 
 	#pragma omp parallel for
 	for (omp_index j = 0; j < static_cast<omp_index>(n); j++) {
-		anglecopy[j] = angles[permutation[j]];
-		radiicopy[j] = radii[permutation[j]];
+		angles[j] = sampledAngles[permutation[j]];
+		radii[j] = sampledRadii[permutation[j]];
 	}
 
 	INFO("Generated Points");
-	return generate(anglecopy, radiicopy, R, T);
 }
 
-Graph HyperbolicGenerator::generateCold(const vector<double> &angles, const vector<double> &radii, double R) {
+template<typename L>
+void HyperbolicGenerator::forNeighborhoodsCold(const vector<double> &angles, const vector<double> &radii, double R, bool allBands, L handle) {
 	const count n = angles.size();
 	assert(radii.size() == n);
 
@@ -115,105 +151,114 @@ Graph HyperbolicGenerator::generateCold(const vector<double> &angles, const vect
 	Aux::Parallel::sort(permutation.begin(), permutation.end(), [&angles,&radii](index i, index j){return angles[i] < angles[j] || (angles[i] == angles[j] && radii[i] < radii[j]);});
 
 	vector<double> bandRadii = getBandRadii(n, R);
-	//Initialize empty bands
-	vector<vector<Point2D<double>>> bands(bandRadii.size() - 1);
-	//Put points to bands
-	#pragma omp parallel for
-	for (omp_index j = 0; j < static_cast<omp_index>(bands.size()); j++){
-		for (index i = 0; i < n; i++){
-			double alias = permutation[i];
-			if (radii[alias] >= bandRadii[j] && radii[alias] <= bandRadii[j+1]){
-				bands[j].push_back(Point2D<double>(angles[alias], radii[alias], alias));
-			}
-		}
-	}
-
-	const count bandCount = bands.size();
+	const count bandCount = bandRadii.size() - 1;
 	const double coshR = cosh(R);
 	assert(radii.size() == n);
 
 	Aux::Timer bandTimer;
 	bandTimer.start();
 
-	//1.Extract band angles to use them later, can create a band class to handle this more elegantly
+	//Put points to bands, sorted by angle. Each band keeps the node ids, the angles for the slab
+	//search and the hyperbolic functions of the coordinates for the distance kernel.
+	vector<vector<index>> bandIds(bandCount);
 	vector<vector<double>> bandAngles(bandCount);
+	vector<HyperbolicPoints> bandPoints(bandCount);
 	#pragma omp parallel for
-	for (omp_index i=0; i < static_cast<omp_index>(bandCount); i++){
-		const count currentBandSize = bands[i].size();
-		bandAngles[i].resize(currentBandSize);
-		for(index j=0; j < currentBandSize; j++) {
-			bandAngles[i][j] = bands[i][j].getX();
+	for (omp_index j = 0; j < static_cast<omp_index>(bandCount); j++){
+		for (index i = 0; i < n; i++){
+			index alias = permutation[i];
+			if (radii[alias] >= bandRadii[j] && radii[alias] <= bandRadii[j+1]){
+				bandIds[j].push_back(alias);
+				bandAngles[j].push_back(angles[alias]);
+				bandPoints[j].push_back(angles[alias], radii[alias]);
+			}
 		}
-		if (!std::is_sorted(bandAngles[i].begin(), bandAngles[i].end())) {
+		if (!std::is_sorted(bandAngles[j].begin(), bandAngles[j].end())) {
 			throw std::runtime_error("Points in bands must be sorted.");
 		}
 	}
 	bandTimer.stop();
-	INFO("Extracting band angles took ", bandTimer.elapsedMilliseconds(), " milliseconds.");
+	INFO("Filling bands took ", bandTimer.elapsedMilliseconds(), " milliseconds.");
 
 	//2.Insert edges
 	Aux::Timer timer;
 	timer.start();
-	vector<double> empty;
-	GraphBuilder result(n, false, false);
-
 	#pragma omp parallel
 	{
 		index id = omp_get_thread_num();
 		threadtimers[id].start();
+		//reused for all nodes of this thread, so the edge phase allocates nothing per node
+		vector<index> near;
 		#pragma omp for schedule(guided) nowait
 		for (omp_index i = 0; i < static_cast<omp_index>(n); i++) {
-			const double coshr = cosh(radii[i]);
-			const double sinhr = sinh(radii[i]);
-			count expectedDegree = (4/PI)*n*exp(-(radii[i])/2);
-			vector<index> near;
-			near.reserve(expectedDegree*1.1);
-			Point2D<double> pointV(angles[i], radii[i], i);
+			const HyperbolicPoints::Query query(angles[i], radii[i]);
+			near.clear();
 			for(index j = 0; j < bandCount; j++){
-				if(directSwap || bandRadii[j+1] > radii[i]){
+				if(allBands || bandRadii[j+1] > radii[i]){
 					double minTheta, maxTheta;
 					std::tie (minTheta, maxTheta) = getMinMaxTheta(angles[i], radii[i], bandRadii[j], R);
-					//minTheta = 0;
-					//maxTheta = 2*PI;
-					vector<Point2D<double>> neighborCandidates = getPointsWithinAngles(minTheta, maxTheta, bands[j], bandAngles[j]);
-
-					const count sSize = neighborCandidates.size();
-					for(index w = 0; w < sSize; w++){
-						double deltaPhi = PI - abs(PI-abs(angles[i] - neighborCandidates[w].getX()));
-						if (coshr*cosh(neighborCandidates[w].getY())-sinhr*sinh(neighborCandidates[w].getY())*cos(deltaPhi) <= coshR) {
-							if (neighborCandidates[w].getIndex() != i){
-								near.push_back(neighborCandidates[w].getIndex());
-							}
-						}
+					for (const std::pair<index, index> &range : getPointRangesWithinAngles(minTheta, maxTheta, bandAngles[j])) {
+						bandPoints[j].filterByDistance(range.first, range.second, query, coshR, bandIds[j].data(), near);
 					}
 				}
 			}
-			if (directSwap) {
-				auto newend = std::remove(near.begin(), near.end(), i); //no self loops!
-				if (newend != near.end()) {
-					assert(newend+1 == near.end());
-					assert(*(newend)==i);
-					near.pop_back();//std::remove doesn't remove element but swaps it to the end
-				}
-				result.swapNeighborhood(i, near, empty, false);
-			} else {
-				for (index j : near) {
-					if (j >= n) ERROR("Node ", j, " prospective neighbour of ", i, " does not actually exist. Oops.");
-					if(radii[j] > radii[i] || (radii[j] == radii[i] && angles[j] < angles[i]))
-						result.addHalfEdge(i,j);
-				}
-			}
+			handle(i, near);
 		}
 		threadtimers[id].stop();
 	}
 	timer.stop();
 	INFO("Generating Edges took ", timer.elapsedMilliseconds(), " milliseconds.");
+}
+
+Graph HyperbolicGenerator::generateCold(const vector<double> &angles, const vector<double> &radii, double R) {
+	const count n = angles.size();
+	vector<double> empty;
+	// one buffer per thread for the node ids of a neighborhood
+	vector<vector<node>> neighborBuffers(omp_get_max_threads());
+	GraphBuilder result(n, false, false);
+	forNeighborhoodsCold(angles, radii, R, directSwap, [&](index i, vector<index> &near) {
+		if (directSwap) {
+			auto newend = std::remove(near.begin(), near.end(), i); //no self loops!
+			if (newend != near.end()) {
+				assert(newend+1 == near.end());
+				assert(*(newend)==i);
+				near.pop_back();//std::remove doesn't remove element but swaps it to the end
+			}
+			// the builder takes over the buffer and leaves its empty neighborhood in it, so the only
+			// allocation per node is the exactly sized adjacency the builder keeps
+			vector<node> &neighbors = neighborBuffers[omp_get_thread_num()];
+			neighbors.assign(near.begin(), near.end());
+			result.swapNeighborhood(i, neighbors, empty, false);
+		} else {
+			for (index j : near) {
+				if (j >= n) ERROR("Node ", j, " prospective neighbour of ", i, " does not actually exist. Oops.");
+				if(radii[j] > radii[i] || (radii[j] == radii[i] && angles[j] < angles[i]))
+					result.addHalfEdge(i,j);
+			}
+		}
+	});
 	return result.toGraph(!directSwap, true);
 }
 
 Graph HyperbolicGenerator::generate(const vector<double> &angles, const vector<double> &radii, double R, double T) {
 	if (T < 0) throw std::runtime_error("Temperature cannot be negative.");
 	if (T == 0) return generateCold(angles, radii, R);
+
+	const count n = angles.size();
+	GraphBuilder result(n, false, false);//no direct swap with probabilistic graphs
+	forNeighborhoodsWarm(angles, radii, R, T, [&](index i, const vector<index> &near) {
+		for (index j : near) {
+			if (j >= n) ERROR("Node ", j, " prospective neighbour of ", i, " does not actually exist. Oops.");
+			if (j > i) {
+				result.addHalfEdge(i, j);
+			}
+		}
+	});
+	return result.toGraph(true, true);
+}
+
+template<typename L>
+void HyperbolicGenerator::forNeighborhoodsWarm(const vector<double> &angles, const vector<double> &radii, double R, double T, L handle) {
 	assert(T > 0);
 
 	/**
@@ -227,12 +272,16 @@ Graph HyperbolicGenerator::generate(const vector<double> &angles, const vector<d
 	assert(alpha > 0);
 	Quadtree<index,false> quad(R, theoreticalSplit, alpha, capacity, balance);
 
-	for (index i = 0; i < n; i++) {
+	vector<index> content(n);
+	#pragma omp parallel for
+	for (omp_index i = 0; i < static_cast<omp_index>(n); i++) {
 		assert(radii[i] < R);
-		quad.addContent(i, angles[i], radii[i]);
+		content[i] = i;
 	}
+	quad.bulkLoad(content, angles, radii);
 
 	quad.trim();
+	quad.freeze();
 	timer.stop();
 	INFO("Filled Quadtree, took ", timer.elapsedMilliseconds(), " milliseconds.");
 
@@ -245,23 +294,18 @@ Graph HyperbolicGenerator::generate(const vector<double> &angles, const vector<d
 	assert(beta == beta);
 	auto edgeProb = [beta, R](double distance) -> double {return 1 / (exp(beta*(distance-R)/2)+1);};
 
-	//get Graph
-	GraphBuilder result(n, false, false);//no direct swap with probabilistic graphs
 	count totalCandidates = 0;
-	#pragma omp parallel for
-	for (omp_index i = 0; i < static_cast<omp_index>(n); i++) {
+	#pragma omp parallel reduction(+:totalCandidates)
+	{
 		vector<index> near;
-		totalCandidates += quad.getElementsProbabilistically(HyperbolicSpace::polarToCartesian(angles[i], radii[i]), edgeProb, anglesSorted, near);
-		for (index j : near) {
-			if (j >= n) ERROR("Node ", j, " prospective neighbour of ", i, " does not actually exist. Oops.");
-			if (j > i) {
-				result.addHalfEdge(i, j);
-			}
+		#pragma omp for
+		for (omp_index i = 0; i < static_cast<omp_index>(n); i++) {
+			near.clear();
+			totalCandidates += quad.getElementsProbabilistically(HyperbolicSpace::polarToCartesian(angles[i], radii[i]), edgeProb, anglesSorted, near);
+			handle(i, near);
 		}
-
 	}
 	DEBUG("Candidates tested: ", totalCandidates);
-	return result.toGraph(true, true);
 
 }
 }
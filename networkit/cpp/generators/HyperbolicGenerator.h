@@ -8,10 +8,14 @@
 #ifndef HYPERBOLICGENERATOR_H_
 #define HYPERBOLICGENERATOR_H_
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <utility>
 
 #include <vector>
 #include "../geometric/HyperbolicSpace.h"
+#include "../geometric/HyperbolicPoints.h"
 #include "StaticGraphGenerator.h"
 #include "../auxiliary/Timer.h"
 #include "quadtree/Quadtree.h"
@@ -43,7 +47,18 @@ public:
 	/**
 	 * @return Graph to be generated according to parameters specified in constructor.
 	 */
-	Graph generate();
+	Graph generate() override;
+
+	/**
+	 * Passes the edges of a graph generated according to the parameters specified in the
+	 * constructor to @a sink while they are found, without storing the graph.
+	 */
+	void generateEdges(EdgeSink& sink) override;
+
+	/**
+	 * Like generate(angles, radii, R, T), but passes the edges to @a sink while they are found.
+	 */
+	void generateEdges(const vector<double> &angles, const vector<double> &radii, double R, double T, EdgeSink& sink);
 
 	/**
 	 * Set the capacity of a quadtree leaf.
@@ -83,18 +98,25 @@ private:
 
 	Graph generate(count n, double R, double alpha, double T = 0);
 
-	static vector<vector<double> > getBandAngles(const vector<vector<Point2D<double>>> &bands) {
-		vector<vector<double>> bandAngles(bands.size());
-		#pragma omp parallel for
-		for (omp_index i=0; i < static_cast<omp_index>(bands.size()); i++){
-			const count currentBandSize = bands[i].size();
-			bandAngles[i].resize(currentBandSize);
-			for(index j=0; j < currentBandSize; j++) {
-				bandAngles[i][j] = bands[i][j].getX();
-			}
-		}
-		return bandAngles;
-	}
+	/**
+	 * Samples @a n points in a disk of radius @a R with dispersion @a alpha, sorted by angle.
+	 */
+	static void samplePoints(count n, double R, double alpha, vector<double> &angles, vector<double> &radii);
+
+	/**
+	 * Calls @a handle(i, near) for every node i with the nodes near i for T = 0. Unless @a allBands
+	 * is set, only the bands reaching further out than i are searched, so every edge is at least
+	 * found from its inner node. The calls are made in parallel.
+	 */
+	template<typename L>
+	void forNeighborhoodsCold(const vector<double> &angles, const vector<double> &radii, double R, bool allBands, L handle);
+
+	/**
+	 * Calls @a handle(i, near) for every node i with the sampled neighbors of i for T > 0.
+	 * The calls are made in parallel.
+	 */
+	template<typename L>
+	void forNeighborhoodsWarm(const vector<double> &angles, const vector<double> &radii, double R, double T, L handle);
 
 	static vector<double> getBandRadii(int n, double R, double seriesRatio = 0.9) {
 		/*
@@ -144,66 +166,32 @@ private:
 	  return std::make_tuple(minTheta, maxTheta);
 	}
 
-	static vector<Point2D<double>> getPointsWithinAngles(double minTheta, double maxTheta, const vector<Point2D<double>> &band, vector<double> &bandAngles){
-		/**
-		Returns the list of points, w, that lies within minTheta and maxTheta
-		in the supplied band(That area is called as slab)
-		*/
-		//TODO: There should be a better way to write the whole thing. Find it.
-		//TODO: This can be done faster. Instead of returning the copying to slab array, just return the indexes and iterate over the band array
-		assert(band.size() == bandAngles.size());
-
-		vector<Point2D<double>> slab;
-
-		std::vector<double>::iterator low;
-		std::vector<double>::iterator high;
+	/**
+	 * Returns the positions of the points in a band whose angles lie between minTheta and maxTheta
+	 * (the slab), as up to two ranges [first, second) of positions in the sorted @a bandAngles.
+	 * The second range is only non-empty if the slab wraps around 2pi.
+	 */
+	static std::array<std::pair<index, index>, 2> getPointRangesWithinAngles(double minTheta, double maxTheta, const vector<double> &bandAngles) {
+		auto range = [&bandAngles](double low, double high) {
+			return std::make_pair<index, index>(std::lower_bound(bandAngles.begin(), bandAngles.end(), low) - bandAngles.begin(),
+					std::upper_bound(bandAngles.begin(), bandAngles.end(), high) - bandAngles.begin());
+		};
+		const std::pair<index, index> emptyRange(0, 0);
 
 		if(minTheta == -2*PI)
 			minTheta = 0;
-		//Case 1: We do not have overlap 2pi, simply put all the points between min and max to the list
+		//Case 1: We do not have overlap 2pi, simply take all the points between min and max
 		if(maxTheta <= 2*PI && minTheta >= 0){
-			low = std::lower_bound(bandAngles.begin(), bandAngles.end(), minTheta);
-			high = std::upper_bound(bandAngles.begin(), bandAngles.end(), maxTheta);
-			std::vector<Point2D<double>>::const_iterator first = band.begin() + (low - bandAngles.begin());
-			std::vector<Point2D<double>>::const_iterator last = band.begin() + (high - bandAngles.begin());
-			//Q: Does this operation increases the complexity ? It is linear in times of high - low
-			//Does not increase the complexity, since we have to check these points anyway
-			slab.insert(slab.end(), first, last);
+			return {{range(minTheta, maxTheta), emptyRange}};
 		}
 		//Case 2: We have 'forward' overlap at 2pi, that is maxTheta > 2pi
 		else if (maxTheta > 2*PI){
-			//1. Get points from minTheta to 2pi
-			low = std::lower_bound(bandAngles.begin(), bandAngles.end(), minTheta);
-			high = std::upper_bound(bandAngles.begin(), bandAngles.end(), 2*PI);
-			std::vector<Point2D<double>>::const_iterator first = band.begin() + (low - bandAngles.begin());
-			std::vector<Point2D<double>>::const_iterator last = band.begin() + (high - bandAngles.begin());
-			slab.insert(slab.end(), first, last);
-
-			//2. Get points from 0 to maxTheta%2pi
-			low = std::lower_bound(bandAngles.begin(), bandAngles.end(), 0);
-			maxTheta = fmod(maxTheta, (2*PI));
-			high = std::upper_bound(bandAngles.begin(), bandAngles.end(), maxTheta);
-			std::vector<Point2D<double>>::const_iterator first2 = band.begin() + (low - bandAngles.begin());
-			std::vector<Point2D<double>>::const_iterator last2 = band.begin() + (high - bandAngles.begin());
-			slab.insert(slab.end(), first2, last2);
+			return {{range(minTheta, 2*PI), range(0, fmod(maxTheta, (2*PI)))}};
 		}
 		//Case 3: We have 'backward' overlap at 2pi, that is minTheta < 0
-		else if (minTheta < 0){
-			//1. Get points from 2pi + minTheta to 2pi
-			minTheta = (2*PI) + minTheta;
-			low = std::lower_bound(bandAngles.begin(), bandAngles.end(), minTheta);
-			high = std::upper_bound(bandAngles.begin(), bandAngles.end(), 2*PI);
-			std::vector<Point2D<double>>::const_iterator first = band.begin() + (low - bandAngles.begin());
-			std::vector<Point2D<double>>::const_iterator last = band.begin() + (high - bandAngles.begin());
-			slab.insert(slab.end(), first, last);
-			//2. Get points from 0 to maxTheta
-			low = std::lower_bound(bandAngles.begin(), bandAngles.end(), 0);
-			high = std::upper_bound(bandAngles.begin(), bandAngles.end(), maxTheta);
-			std::vector<Point2D<double>>::const_iterator first2 = band.begin() + (low - bandAngles.begin());
-			std::vector<Point2D<double>>::const_iterator last2 = band.begin() + (high - bandAngles.begin());
-			slab.insert(slab.end(), first2, last2);
+		else {
+			return {{range((2*PI) + minTheta, 2*PI), range(0, maxTheta)}};
 		}
-		return slab;
 	}
 
 	/**
@@ -5,7 +5,14 @@
  *      Author: Henning, cls
  */
 
+#include <algorithm>
+#include <omp.h>
+#include <random>
+#include <tuple>
+
 #include "RmatGenerator.h"
+#include "../graph/GraphBuilder.h"
+#include "../auxiliary/Parallel.h"
 #include "../auxiliary/Random.h"
 #include "../auxiliary/NumericTools.h"
 #include "../auxiliary/Log.h"
@@ -22,51 +29,64 @@ RmatGenerator::RmatGenerator(count scale, count edgeFactor, double a, double b,
 	defaultEdgeWeight = 1.0;
 }
 
+namespace {
+
+/**
+ * Edge drawn as the seq-th edge of the global sequence of draws.
+ */
+struct DrawnEdge {
+	node u;
+	node v;
+	index seq;
+};
+
+bool lessByEdgeThenSeq(const DrawnEdge& x, const DrawnEdge& y) {
+	return std::tie(x.u, x.v, x.seq) < std::tie(y.u, y.v, y.seq);
+}
+
+bool sameEdge(const DrawnEdge& x, const DrawnEdge& y) {
+	return x.u == y.u && x.v == y.v;
+}
+
+/**
+ * Adds the sorted @a edges to @a builder in parallel, one thread per row u.
+ */
+void addSortedEdges(GraphBuilder& builder, const std::vector<DrawnEdge>& edges, const std::vector<edgeweight>& weights) {
+	std::vector<index> rowStarts;
+	for (index i = 0; i < edges.size(); ++i) {
+		if (i == 0 || edges[i].u != edges[i - 1].u) {
+			rowStarts.push_back(i);
+		}
+	}
+	rowStarts.push_back(edges.size());
+
+	#pragma omp parallel for schedule(guided)
+	for (omp_index r = 0; r < static_cast<omp_index>(rowStarts.size()) - 1; ++r) {
+		for (index i = rowStarts[r]; i < rowStarts[r + 1]; ++i) {
+			builder.addHalfOutEdge(edges[i].u, edges[i].v, weights.empty() ? defaultEdgeWeight : weights[i]);
+		}
+	}
+}
+
+} // namespace
+
+const count RmatGenerator::drawsPerChunk;
+
 Graph RmatGenerator::generate() {
-	count n = (1 << scale);
+	count n = (count(1) << scale);
 	if (n <= reduceNodes) {
 		throw std::runtime_error("Error, shall delete more nodes than the graph originally has");
 	}
 	// when nodes are deleted, all nodes have less neighbors
 	count numEdges = n * edgeFactor * n * 1.0 / (n - reduceNodes);
 	count wantedEdges = (n - reduceNodes) * edgeFactor;
-	Graph G(n - reduceNodes, weighted);
 	double ab = a+b;
 	double abc = ab+c;
 
-	auto quadrant([&]() {
-		double r = Aux::Random::probability();
-		TRACE("r: ", r);
-
-		if (r <= a) {
-			return 0;
-		}
-		else if (r <= ab) {
-			return 1;
-		}
-		else if (r <= abc) {
-			return 2;
-		}
-		else return 3;
-	});
-
-	auto drawEdge([&]() {
-		node u = 0;
-		node v = 0;
-		for (index i = 0; i < scale; ++i) {
-			count q = quadrant();
-//			TRACE("q: ", q);
-			u = u << 1;
-			v = v << 1;
-			u = u | (q >> 1);
-			v = v | (q & 1);
-		}
-
-		return std::make_pair(u, v);
-	});
-
+	// maps the nodes of the R-MAT matrix to the nodes of the graph, none for deleted ones
+	std::vector<node> nodemap;
 	if (reduceNodes > 0) {
-		std::vector<node> nodemap(n, 0);
+		nodemap.assign(n, 0);
 
 		for (count deletedNodes = 0; deletedNodes < reduceNodes;) {
 			node u = Aux::Random::index(n);
@@ -82,47 +102,101 @@ Graph RmatGenerator::generate() {
 				++u;
 			}
 		}
+	}
 
-		node u, v;
-		if (weighted) {
-			for (index e = 0; e < numEdges; ++e) {
-				std::tie(u, v) = drawEdge();
-				u = nodemap[u];
-				v = nodemap[v];
-				if (u != none && v != none) {
-					G.increaseWeight(u, v, defaultEdgeWeight);
+	const uint64_t seed = Aux::Random::integer();
+	std::vector<std::vector<DrawnEdge> > drawnPerThread(omp_get_max_threads());
+
+	/*
+	 * Draws the edges with the sequence numbers [firstDraw, endDraw) in parallel and appends them to edges.
+	 * The draws are grouped into chunks of drawsPerChunk with their own random streams, so each draw
+	 * only depends on the seed. Undirected edges are stored as (max, min); edges to deleted nodes are
+	 * skipped, and so are self-loops if nodes are deleted from an unweighted graph.
+	 */
+	auto drawEdges = [&](index firstDraw, index endDraw, std::vector<DrawnEdge>& edges) {
+		const index firstChunk = firstDraw / drawsPerChunk;
+		const index endChunk = (endDraw + drawsPerChunk - 1) / drawsPerChunk;
+
+		#pragma omp parallel for schedule(dynamic, 1)
+		for (omp_index chunk = firstChunk; chunk < static_cast<omp_index>(endChunk); ++chunk) {
+			std::vector<DrawnEdge>& drawn = drawnPerThread[omp_get_thread_num()];
+			std::mt19937_64 urng = Aux::Random::getStreamURNG(seed, chunk);
+			std::uniform_real_distribution<double> distribution;
+
+			const index end = std::min((chunk + 1) * drawsPerChunk, endDraw);
+			for (index draw = std::max(chunk * drawsPerChunk, firstDraw); draw < end; ++draw) {
+				node u = 0;
+				node v = 0;
+				for (index i = 0; i < scale; ++i) {
+					double r = distribution(urng);
+					count q = r <= a ? 0 : (r <= ab ? 1 : (r <= abc ? 2 : 3));
+					u = u << 1;
+					v = v << 1;
+					u = u | (q >> 1);
+					v = v | (q & 1);
 				}
-			}
-		} else {
-			while (G.numberOfEdges() < wantedEdges) {
-				std::tie(u, v) = drawEdge();
-				u = nodemap[u];
-				v = nodemap[v];
-				if (u != none && v != none && u != v && !G.hasEdge(u, v)) {
-					G.addEdge(u, v);
+				if (!nodemap.empty()) {
+					u = nodemap[u];
+					v = nodemap[v];
+					if (u == none || v == none) {
+						continue;
+					}
+				}
+				if (u == v && !weighted && reduceNodes > 0) {
+					continue;
 				}
+				if (u < v) {
+					std::swap(u, v);
+				}
+				drawn.push_back({u, v, draw});
 			}
 		}
-	} else {
-		if (weighted) {
-			for (index e = 0; e < numEdges; ++e) {
-				std::pair<node, node> drawnEdge = drawEdge();
-				//			TRACE("edge drawn: ", drawnEdge.first, " - ", drawnEdge.second);
-				G.increaseWeight(drawnEdge.first, drawnEdge.second, defaultEdgeWeight);
-			}
-		} else {
-			while (G.numberOfEdges() < wantedEdges) {
-				std::pair<node, node> drawnEdge = drawEdge();
-				//			TRACE("edge drawn: ", drawnEdge.first, " - ", drawnEdge.second);
-				if (!G.hasEdge(drawnEdge.first, drawnEdge.second)) {
-					G.addEdge(drawnEdge.first, drawnEdge.second);
-				}
+
+		for (std::vector<DrawnEdge>& drawn : drawnPerThread) {
+			edges.insert(edges.end(), drawn.begin(), drawn.end());
+			drawn.clear();
+		}
+	};
+
+	std::vector<DrawnEdge> edges;
+	std::vector<edgeweight> weights;
+	if (weighted) {
+		// every draw increases the weight of its edge
+		drawEdges(0, numEdges, edges);
+		Aux::Parallel::sort(edges.begin(), edges.end(), lessByEdgeThenSeq);
+		index k = 0;
+		for (index i = 0; i < edges.size(); ++i) {
+			if (k > 0 && sameEdge(edges[k - 1], edges[i])) {
+				weights[k - 1] += defaultEdgeWeight;
+			} else {
+				edges[k++] = edges[i];
+				weights.push_back(defaultEdgeWeight);
 			}
 		}
+		edges.resize(k);
+	} else {
+		// the graph consists of the first wantedEdges distinct edges of the sequence of draws
+		index nextDraw = 0;
+		while (edges.size() < wantedEdges) {
+			const count missing = wantedEdges - edges.size();
+			const index endDraw = nextDraw + std::max(missing + missing / 8, drawsPerChunk);
+			drawEdges(nextDraw, endDraw, edges);
+			nextDraw = endDraw;
+
+			// keep the earliest draw of each edge
+			Aux::Parallel::sort(edges.begin(), edges.end(), lessByEdgeThenSeq);
+			edges.erase(std::unique(edges.begin(), edges.end(), sameEdge), edges.end());
+		}
+		Aux::Parallel::sort(edges.begin(), edges.end(), [](const DrawnEdge& x, const DrawnEdge& y) {
+			return x.seq < y.seq;
+		});
+		edges.resize(wantedEdges);
+		Aux::Parallel::sort(edges.begin(), edges.end(), lessByEdgeThenSeq);
 	}
 
-	G.shrinkToFit();
-	return G;
+	GraphBuilder builder(n - reduceNodes, weighted);
+	addSortedEdges(builder, edges, weights);
+	return builder.toGraph(true, true);
 }
 
 } /* namespace NetworKit */
@@ -20,6 +20,10 @@ namespace NetworKit {
  * More details at http://www.graph500.org or in the original paper:
  * Deepayan Chakrabarti, Yiping Zhan, Christos Faloutsos:
  * R-MAT: A Recursive Model for Graph Mining. SDM 2004: 442-446.
+ *
+ * The edges are drawn in parallel in chunks with independent random streams
+ * and duplicates are removed by sorting, so the graph only depends on the seed
+ * of Aux::Random and not on the number of threads.
  */
 class RmatGenerator: public NetworKit::StaticGraphGenerator {
 protected:
@@ -30,6 +34,11 @@ protected:
 	bool weighted;
 	count reduceNodes;
 
+	/**
+	 * Number of consecutive edge draws that use the same random stream.
+	 */
+	static const count drawsPerChunk = 1 << 16;
+
 public:
 
 	/**
@@ -9,4 +9,18 @@
 
 namespace NetworKit {
 
+void StaticGraphGenerator::generateEdges(EdgeSink& sink) {
+	const Graph G = generate();
+	sink.open(G.upperNodeIdBound(), G.isDirected());
+	G.balancedParallelForNodes([&](node u) {
+		G.forNeighborsOf(u, [&](node v) {
+			// undirected edges are stored at both nodes
+			if (G.isDirected() || v <= u) {
+				sink.addEdge(u, v);
+			}
+		});
+	});
+	sink.close();
+}
+
 } /* namespace NetworKit */
@@ -9,6 +9,7 @@
 #define STATICGRAPHGENERATOR_H_
 
 #include "../graph/Graph.h"
+#include "EdgeSink.h"
 
 namespace NetworKit {
 
@@ -24,6 +25,14 @@ public:
 	virtual ~StaticGraphGenerator() = default;
 
 	virtual Graph generate() = 0;
+
+	/**
+	 * Passes the edges of a new graph to @a sink instead of returning the graph. Generators
+	 * that override this emit their edges while they create them, so the graph is never
+	 * stored and its size is only bounded by the sink. The default implementation generates
+	 * the graph in memory and passes its edges afterwards.
+	 */
+	virtual void generateEdges(EdgeSink& sink);
 };
 
 } /* namespace NetworKit */
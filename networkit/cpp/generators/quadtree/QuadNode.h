@@ -15,6 +15,7 @@
 #include "../../auxiliary/Log.h"
 #include "../../auxiliary/Parallel.h"
 #include "../../geometric/HyperbolicSpace.h"
+#include "QuadtreeBulkLoad.h"
 
 using std::vector;
 using std::min;
@@ -23,9 +24,12 @@ using std::cos;
 
 namespace NetworKit {
 
+template <class T, bool poincare> class Quadtree;
+
 template <class T, bool poincare = true>
 class QuadNode {
 	friend class QuadTreeGTest;
+	friend class Quadtree<T, poincare>;
 private:
 	double leftAngle;
 	double minR;
@@ -185,6 +189,48 @@ public:
 		}
 	}
 
+	/**
+	 * Add the points at polar coordinates (@a pointAngles[i], @a pointRadii[i]) with content @a input[i]
+	 * to this empty leaf at once. The subtree is the same as after adding the points in order with
+	 * addContent, but its parts are built in parallel.
+	 */
+	void bulkLoad(const vector<T> &input, const vector<double> &pointAngles, const vector<double> &pointRadii) {
+		assert(isLeaf && content.empty());
+		assert(input.size() == pointAngles.size() && input.size() == pointRadii.size());
+		auto fill = [&](QuadNode &leaf, const index *points, count size) {
+			for (index i = 0; i < size; i++) {
+				const index p = points[i];
+				assert(leaf.responsible(pointAngles[p], pointRadii[p]));
+				if (leaf.lowerBoundR > pointRadii[p]) leaf.lowerBoundR = pointRadii[p];
+				leaf.content.push_back(input[p]);
+				leaf.angles.push_back(pointAngles[p]);
+				leaf.radii.push_back(pointRadii[p]);
+				leaf.positions.push_back(HyperbolicSpace::polarToCartesian(pointAngles[p], pointRadii[p]));
+			}
+		};
+		auto split = [](QuadNode &node) {
+			node.split();
+			node.content.clear();
+			node.angles.clear();
+			node.radii.clear();
+			node.positions.clear();
+		};
+		auto childOf = [&](const QuadNode &node, index p) -> index {
+			for (index i = 0; i < node.children.size(); i++) {
+				if (node.children[i].responsible(pointAngles[p], pointRadii[p])) return i;
+			}
+			assert(false);
+			return node.children.size() - 1;
+		};
+		auto finish = [](QuadNode &node, count size) {
+			node.subTreeSize = size;
+			for (const QuadNode &child : node.children) {
+				if (child.size() > 0 && node.lowerBoundR > child.lowerBoundR) node.lowerBoundR = child.lowerBoundR;
+			}
+		};
+		QuadtreeBulkLoad::bulkLoad(*this, input.size(), capacity, fill, split, childOf, finish);
+	}
+
 	/**
 	 * Remove content at polar coordinates (angle, R). May cause coarsening of the quadtree
 	 *
@@ -266,42 +312,50 @@ public:
 	 * @return True if the region managed by this node lies completely outside of the circle
 	 */
 	bool outOfReach(Point2D<double> query, double radius) const {
+		return outOfReach(*this, query, radius);
+	}
+
+	/**
+	 * Same as above for the bounds of a region that is not a QuadNode, e.g. of a frozen Quadtree.
+	 */
+	template<typename Region>
+	static bool outOfReach(const Region &region, Point2D<double> query, double radius) {
 		double phi, r;
 		HyperbolicSpace::cartesianToPolar(query, phi, r);
-		if (responsible(phi, r)) return false;
+		if (responsible(region, phi, r)) return false;
 
 		//if using native coordinates, call distance calculation
-		if (!poincare) return hyperbolicDistances(phi, r).first > radius;
+		if (!poincare) return hyperbolicDistances(region, phi, r).first > radius;
 
 		//get four edge points
 		double topDistance, bottomDistance, leftDistance, rightDistance;
 
-		if (phi < leftAngle || phi > rightAngle) {
-			topDistance = min(c.distance(query), d.distance(query));
+		if (phi < region.leftAngle || phi > region.rightAngle) {
+			topDistance = min(region.c.distance(query), region.d.distance(query));
 		} else {
-			topDistance = abs(r - maxR);
+			topDistance = abs(r - region.maxR);
 		}
 		if (topDistance <= radius) return false;
-		if (phi < leftAngle || phi > rightAngle) {
-			bottomDistance = min(a.distance(query), b.distance(query));
+		if (phi < region.leftAngle || phi > region.rightAngle) {
+			bottomDistance = min(region.a.distance(query), region.b.distance(query));
 		} else {
-			bottomDistance = abs(r - minR);
+			bottomDistance = abs(r - region.minR);
 		}
 		if (bottomDistance <= radius) return false;
 
-		double minDistanceR = r*cos(abs(phi-leftAngle));
-		if (minDistanceR > minR && minDistanceR < maxR) {
+		double minDistanceR = r*cos(abs(phi-region.leftAngle));
+		if (minDistanceR > region.minR && minDistanceR < region.maxR) {
 			leftDistance = query.distance(HyperbolicSpace::polarToCartesian(phi, minDistanceR));
 		} else {
-			leftDistance = min(a.distance(query), d.distance(query));
+			leftDistance = min(region.a.distance(query), region.d.distance(query));
 		}
 		if (leftDistance <= radius) return false;
 
-		minDistanceR = r*cos(abs(phi-rightAngle));
-		if (minDistanceR > minR && minDistanceR < maxR) {
+		minDistanceR = r*cos(abs(phi-region.rightAngle));
+		if (minDistanceR > region.minR && minDistanceR < region.maxR) {
 			rightDistance = query.distance(HyperbolicSpace::polarToCartesian(phi, minDistanceR));
 		} else {
-			rightDistance = min(b.distance(query), c.distance(query));
+			rightDistance = min(region.b.distance(query), region.c.distance(query));
 		}
 		if (rightDistance <= radius) return false;
 		return true;
@@ -329,14 +383,22 @@ public:
 	 * @param r_h radial coordinate of query point in poincare disk
 	 */
 	std::pair<double, double> hyperbolicDistances(double phi, double r) const {
+		return hyperbolicDistances(*this, phi, r);
+	}
+
+	/**
+	 * Same as above for the bounds of a region that is not a QuadNode, e.g. of a frozen Quadtree.
+	 */
+	template<typename Region>
+	static std::pair<double, double> hyperbolicDistances(const Region &region, double phi, double r) {
 		double minRHyper, maxRHyper, r_h;
 		if (poincare) {
-			minRHyper=HyperbolicSpace::EuclideanRadiusToHyperbolic(this->minR);
-			maxRHyper=HyperbolicSpace::EuclideanRadiusToHyperbolic(this->maxR);
+			minRHyper=HyperbolicSpace::EuclideanRadiusToHyperbolic(region.minR);
+			maxRHyper=HyperbolicSpace::EuclideanRadiusToHyperbolic(region.maxR);
 			r_h = HyperbolicSpace::EuclideanRadiusToHyperbolic(r);
 		} else {
-			minRHyper=this->minR;
-			maxRHyper=this->maxR;
+			minRHyper=region.minR;
+			maxRHyper=region.maxR;
 			r_h = r;
 		}
 
@@ -346,8 +408,8 @@ public:
 		double coshMaxR = cosh(maxRHyper);
 		double sinhMinR = sinh(minRHyper);
 		double sinhMaxR = sinh(maxRHyper);
-		double cosDiffLeft = cos(phi - leftAngle);
-		double cosDiffRight = cos(phi - rightAngle);
+		double cosDiffLeft = cos(phi - region.leftAngle);
+		double cosDiffRight = cos(phi - region.rightAngle);
 
 		/**
 		 * If the query point is not within the quadnode, the distance minimum is on the border.
@@ -359,7 +421,7 @@ public:
 		//Left border
 		double lowerLeftDistance = coshMinR*coshr-sinhMinR*sinhr*cosDiffLeft;
 		double upperLeftDistance = coshMaxR*coshr-sinhMaxR*sinhr*cosDiffLeft;
-		if (responsible(phi, r)) coshMinDistance = 1; //strictly speaking, this is wrong
+		if (responsible(region, phi, r)) coshMinDistance = 1; //strictly speaking, this is wrong
 		else coshMinDistance = min(lowerLeftDistance, upperLeftDistance);
 
 		coshMaxDistance = max(lowerLeftDistance, upperLeftDistance);
@@ -398,7 +460,7 @@ public:
 		assert(coshMinDistance >= 1);
 
 		//upper and lower borders
-		if (phi >= leftAngle && phi < rightAngle) {
+		if (phi >= region.leftAngle && phi < region.rightAngle) {
 			double lower = cosh(abs(r_h-minRHyper));
 			double upper = cosh(abs(r_h-maxRHyper));
 			coshMinDistance = min(coshMinDistance, lower);
@@ -414,7 +476,7 @@ public:
 		double mirrorphi;
 		if (phi >= PI) mirrorphi = phi - PI;
 		else mirrorphi = phi + PI;
-		if (mirrorphi >= leftAngle && mirrorphi < rightAngle) {
+		if (mirrorphi >= region.leftAngle && mirrorphi < region.rightAngle) {
 			double lower = coshMinR*coshr+sinhMinR*sinhr;
 			double upper = coshMaxR*coshr+sinhMaxR*sinhr;
 			coshMinDistance = min(coshMinDistance, lower);
@@ -444,7 +506,15 @@ public:
 	 * @return True if input point lies within the region of this QuadNode
 	 */
 	bool responsible(double angle, double r) const {
-		return (angle >= leftAngle && angle < rightAngle && r >= minR && r < maxR);
+		return responsible(*this, angle, r);
+	}
+
+	/**
+	 * Same as above for the bounds of a region that is not a QuadNode, e.g. of a frozen Quadtree.
+	 */
+	template<typename Region>
+	static bool responsible(const Region &region, double angle, double r) {
+		return (angle >= region.leftAngle && angle < region.rightAngle && r >= region.minR && r < region.maxR);
 	}
 
 	/**
@@ -556,7 +626,8 @@ public:
 		}
 	}
 
-	count getElementsProbabilistically(Point2D<double> euQuery, std::function<double(double)> prob, bool suppressLeft, vector<T> &result) const {
+	template<typename L>
+	count getElementsProbabilistically(Point2D<double> euQuery, const L& prob, bool suppressLeft, vector<T> &result) const {
 		double phi_q, r_q;
 		HyperbolicSpace::cartesianToPolar(euQuery, phi_q, r_q);
 		if (suppressLeft && phi_q > rightAngle) return 0;
@@ -645,7 +716,8 @@ public:
 	}
 
 
-	void maybeGetKthElement(double upperBound, Point2D<double> euQuery, std::function<double(double)> prob, index k, vector<T> &circleDenizens) const {
+	template<typename L>
+	void maybeGetKthElement(double upperBound, Point2D<double> euQuery, const L& prob, index k, vector<T> &circleDenizens) const {
 		TRACE("Maybe get element ", k, " with upper Bound ", upperBound);
 		assert(k < size());
 		if (isLeaf) {
@@ -16,6 +16,7 @@
 #include <assert.h>
 #include "../../auxiliary/Log.h"
 #include "../../geometric/HyperbolicSpace.h"
+#include "QuadtreeBulkLoad.h"
 
 using std::vector;
 using std::min;
@@ -155,6 +156,40 @@ public:
 		}
 	}
 
+	/**
+	 * Add the points at @a pointPositions[i] with content @a input[i] to this empty leaf at once.
+	 * The subtree is the same as after adding the points in order with addContent, but its parts
+	 * are built in parallel.
+	 */
+	void bulkLoad(const vector<T> &input, const vector<Point<double> > &pointPositions) {
+		assert(isLeaf && content.empty());
+		assert(input.size() == pointPositions.size());
+		auto fill = [&](QuadNodeCartesianEuclid &leaf, const index *points, count size) {
+			for (index i = 0; i < size; i++) {
+				const index p = points[i];
+				assert(leaf.responsible(pointPositions[p]));
+				leaf.content.push_back(input[p]);
+				leaf.positions.push_back(pointPositions[p]);
+			}
+		};
+		auto split = [](QuadNodeCartesianEuclid &node) {
+			node.split();
+			node.content.clear();
+			node.positions.clear();
+		};
+		auto childOf = [&](const QuadNodeCartesianEuclid &node, index p) -> index {
+			for (index i = 0; i < node.children.size(); i++) {
+				if (node.children[i].responsible(pointPositions[p])) return i;
+			}
+			assert(false);
+			return node.children.size() - 1;
+		};
+		auto finish = [](QuadNodeCartesianEuclid &node, count size) {
+			node.subTreeSize = size;
+		};
+		QuadtreeBulkLoad::bulkLoad(*this, input.size(), capacity, fill, split, childOf, finish);
+	}
+
 	/**
 	 * Remove content at coordinate pos. May cause coarsening of the quadtree
 	 *
@@ -357,7 +392,8 @@ public:
 		}
 	}
 
-	count getElementsProbabilistically(Point<double> euQuery, std::function<double(double)> prob, vector<T> &result) const {
+	template<typename L>
+	count getElementsProbabilistically(Point<double> euQuery, const L& prob, vector<T> &result) const {
 		TRACE("Getting Euclidean distances");
 		auto distancePair = EuclideanDistances(euQuery);
 		double probUB = prob(distancePair.first);
@@ -434,7 +470,8 @@ public:
 	}
 
 
-	void maybeGetKthElement(double upperBound, Point<double> euQuery, std::function<double(double)> prob, index k, vector<T> &circleDenizens) const {
+	template<typename L>
+	void maybeGetKthElement(double upperBound, Point<double> euQuery, const L& prob, index k, vector<T> &circleDenizens) const {
 		TRACE("Maybe get element ", k, " with upper Bound ", upperBound);
 		assert(k < size());
 		if (isLeaf) {
@@ -16,6 +16,7 @@
 #include <assert.h>
 #include "../../auxiliary/Log.h"
 #include "../../geometric/HyperbolicSpace.h"
+#include "QuadtreeBulkLoad.h"
 
 using std::vector;
 using std::min;
@@ -171,6 +172,48 @@ public:
 		}
 	}
 
+	/**
+	 * Add the points at polar coordinates (@a pointAngles[i], @a pointRadii[i]) with content @a input[i]
+	 * to this empty leaf at once. The subtree is the same as after adding the points in order with
+	 * addContent, but its parts are built in parallel.
+	 */
+	void bulkLoad(const vector<T> &input, const vector<double> &pointAngles, const vector<double> &pointRadii) {
+		assert(isLeaf && content.empty());
+		assert(input.size() == pointAngles.size() && input.size() == pointRadii.size());
+		auto fill = [&](QuadNodePolarEuclid &leaf, const index *points, count size) {
+			for (index i = 0; i < size; i++) {
+				const index p = points[i];
+				assert(leaf.responsible(pointAngles[p], pointRadii[p]));
+				if (leaf.lowerBoundR > pointRadii[p]) leaf.lowerBoundR = pointRadii[p];
+				leaf.content.push_back(input[p]);
+				leaf.angles.push_back(pointAngles[p]);
+				leaf.radii.push_back(pointRadii[p]);
+				leaf.positions.push_back(HyperbolicSpace::polarToCartesian(pointAngles[p], pointRadii[p]));
+			}
+		};
+		auto split = [](QuadNodePolarEuclid &node) {
+			node.split();
+			node.content.clear();
+			node.angles.clear();
+			node.radii.clear();
+			node.positions.clear();
+		};
+		auto childOf = [&](const QuadNodePolarEuclid &node, index p) -> index {
+			for (index i = 0; i < node.children.size(); i++) {
+				if (node.children[i].responsible(pointAngles[p], pointRadii[p])) return i;
+			}
+			assert(false);
+			return node.children.size() - 1;
+		};
+		auto finish = [](QuadNodePolarEuclid &node, count size) {
+			node.subTreeSize = size;
+			for (const QuadNodePolarEuclid &child : node.children) {
+				if (child.size() > 0 && node.lowerBoundR > child.lowerBoundR) node.lowerBoundR = child.lowerBoundR;
+			}
+		};
+		QuadtreeBulkLoad::bulkLoad(*this, input.size(), capacity, fill, split, childOf, finish);
+	}
+
 	/**
 	 * Remove content at polar coordinates (angle, R). May cause coarsening of the quadtree
 	 *
@@ -470,7 +513,8 @@ public:
 		}
 	}
 
-	count getElementsProbabilistically(Point2D<double> euQuery, std::function<double(double)> prob, bool suppressLeft, vector<T> &result) const {
+	template<typename L>
+	count getElementsProbabilistically(Point2D<double> euQuery, const L& prob, bool suppressLeft, vector<T> &result) const {
 		double phi_q, r_q;
 		HyperbolicSpace::cartesianToPolar(euQuery, phi_q, r_q);
 		if (suppressLeft && phi_q > rightAngle) return 0;
@@ -549,7 +593,8 @@ public:
 	}
 
 
-	void maybeGetKthElement(double upperBound, Point2D<double> euQuery, std::function<double(double)> prob, index k, vector<T> &circleDenizens) const {
+	template<typename L>
+	void maybeGetKthElement(double upperBound, Point2D<double> euQuery, const L& prob, index k, vector<T> &circleDenizens) const {
 		TRACE("Maybe get element ", k, " with upper Bound ", upperBound);
 		assert(k < size());
 		if (isLeaf) {
@@ -15,6 +15,7 @@
 #include <functional>
 #include "QuadNode.h"
 #include "../../geometric/HyperbolicSpace.h"
+#include "../../geometric/HyperbolicPoints.h"
 #include "../../auxiliary/Parallel.h"
 
 namespace NetworKit {
@@ -48,10 +49,21 @@ public:
 		double r = HyperbolicSpace::hyperbolicRadiusToEuclidean(R);
 		root = QuadNode<T>(0, 0, 2*PI, r, capacity, theoreticalSplit,alpha,balance);
 		maxRadius = r;
-		for (index i = 0; i < n; i++) {
-			assert(content[i] < n);
-			root.addContent(content[i], angles[i], radii[i]);
-		}
+		root.bulkLoad(content, angles, radii);
+	}
+
+	/**
+	 * Adds all points to the empty tree at once. The tree is the same as after calling
+	 * addContent(content[i], angles[i], radii[i]) for all i in order, but is built in parallel.
+	 *
+	 * @param content contents of the points
+	 * @param angles angular coordinates of the points
+	 * @param radii radial coordinates of the points
+	 */
+	void bulkLoad(const vector<T> &content, const vector<double> &angles, const vector<double> &radii) {
+		unfreeze();
+		assert(size() == 0);
+		root.bulkLoad(content, angles, radii);
 	}
 
 	/**
@@ -60,6 +72,7 @@ public:
 	 * @param R radial coordinate of x
 	 */
 	void addContent(T newcomer, double angle, double r) {
+		unfreeze();
 		root.addContent(newcomer, angle, r);
 	}
 
@@ -69,6 +82,7 @@ public:
 	 * @param R radial coordinate of x
 	 */
 	bool removeContent(T toRemove, double angle, double r) {
+		unfreeze();
 		return root.removeContent(toRemove, angle, r);
 	}
 
@@ -132,13 +146,13 @@ public:
 		 */
 
 		bool wraparound = false;
-		root.getElementsInEuclideanCircle(center, radius, circleDenizens, minPhi, maxPhi, minR, maxR);
+		getElementsInEuclideanCircle(center, radius, circleDenizens, minPhi, maxPhi, minR, maxR);
 		if (minPhi < 0) {
-			root.getElementsInEuclideanCircle(center, radius, circleDenizens, 2*PI+minPhi, 2*PI, minR, maxR);
+			getElementsInEuclideanCircle(center, radius, circleDenizens, 2*PI+minPhi, 2*PI, minR, maxR);
 			wraparound = true;
 		}
 		if (maxPhi > 2*PI) {
-			root.getElementsInEuclideanCircle(center, radius, circleDenizens, 0, maxPhi - 2*PI, minR, maxR);
+			getElementsInEuclideanCircle(center, radius, circleDenizens, 0, maxPhi - 2*PI, minR, maxR);
 			wraparound = true;
 		}
 
@@ -171,12 +185,25 @@ public:
 		getElementsInHyperbolicCircle(circleCenter, hyperbolicRadius, false, circleDenizens);
 	}
 
-	count getElementsProbabilistically(Point2D<double> euQuery, std::function<double(double)> prob, vector<T> &circleDenizens) {
-		return root.getElementsProbabilistically(euQuery, prob, false, circleDenizens);
+	/**
+	 * Appends each element to @a circleDenizens with probability @a prob(distance to @a euQuery).
+	 * @a prob can be any callable double(double) including std::function; lambdas can be inlined.
+	 * @return Number of candidates whose probability was evaluated.
+	 */
+	template<typename L>
+	count getElementsProbabilistically(Point2D<double> euQuery, L prob, vector<T> &circleDenizens) {
+		return getElementsProbabilistically(euQuery, prob, false, circleDenizens);
 	}
 
-	count getElementsProbabilistically(Point2D<double> euQuery, std::function<double(double)> prob, bool suppressLeft, vector<T> &circleDenizens) {
-		return root.getElementsProbabilistically(euQuery, prob, suppressLeft, circleDenizens);
+	template<typename L>
+	count getElementsProbabilistically(Point2D<double> euQuery, L prob, bool suppressLeft, vector<T> &circleDenizens) {
+		if (!isFrozen()) {
+			return root.getElementsProbabilistically(euQuery, prob, suppressLeft, circleDenizens);
+		}
+		double phi_q, r_q;
+		HyperbolicSpace::cartesianToPolar(euQuery, phi_q, r_q);
+		const HyperbolicPoints::Query nativeQuery(phi_q, r_q);
+		return getFrozenElementsProbabilistically(0, euQuery, phi_q, r_q, nativeQuery, prob, suppressLeft, circleDenizens);
 	}
 
 	void recount() {
@@ -208,6 +235,7 @@ public:
 	}
 
 	void reindex() {
+		unfreeze();
 		#pragma omp parallel
 		{
 			#pragma omp single nowait
@@ -224,9 +252,237 @@ public:
 		root.trim();
 	}
 
+	/**
+	 * Copies the tree into contiguous arrays: the nodes in breadth-first order and the points of
+	 * the leaves in depth-first order as structure of arrays, so that the points of every subtree
+	 * form one range. Queries run on these arrays until the tree is modified, which avoids chasing
+	 * pointers through the heap. Call after the construction is complete, e.g. after trim().
+	 */
+	void freeze() {
+		unfreeze();
+		vector<const QuadNode<T, poincare>*> original = {&root};
+		frozenNodes.push_back(frozenNode(root));
+		for (index i = 0; i < original.size(); i++) {
+			frozenNodes[i].firstChild = frozenNodes.size();
+			frozenNodes[i].numChildren = original[i]->children.size();
+			for (const QuadNode<T, poincare> &child : original[i]->children) {
+				original.push_back(&child);
+				frozenNodes.push_back(frozenNode(child));
+			}
+		}
+
+		frozenContent.reserve(size());
+		if (poincare) {
+			frozenX.reserve(size());
+			frozenY.reserve(size());
+		} else {
+			frozenPoints.reserve(size());
+		}
+		freezePoints(0, original);
+		assert(frozenContent.size() == size());
+	}
+
+	/**
+	 * @return True if the queries run on the arrays created by freeze().
+	 */
+	bool isFrozen() const {
+		return !frozenNodes.empty();
+	}
+
 private:
 	QuadNode<T, poincare> root;
 	double maxRadius;
+
+	/**
+	 * Corner of a frozen region in Cartesian coordinates.
+	 */
+	struct FrozenCorner {
+		double x;
+		double y;
+
+		double distance(const Point2D<double> &query) const {
+			const double deltaX = query.getX() - x;
+			const double deltaY = query.getY() - y;
+			return sqrt(deltaX*deltaX + deltaY*deltaY);
+		}
+	};
+
+	/**
+	 * Bounds of an original node, as far as the queries need them: the polar bounds, the smallest radius
+	 * of a point in the subtree and, for the Euclidean circles in the Poincare disk, the corners.
+	 */
+	struct FrozenRegion {
+		double leftAngle;
+		double minR;
+		double rightAngle;
+		double maxR;
+		double lowerBoundR;
+		FrozenCorner a, b, c, d;
+	};
+
+	/**
+	 * Node of the frozen layout.
+	 */
+	struct FrozenNode {
+		FrozenRegion region;
+		index firstChild; //!< the children are frozenNodes[firstChild, firstChild + numChildren)
+		count numChildren;
+		index firstPoint; //!< the points of the subtree are [firstPoint, firstPoint + numPoints)
+		count numPoints;
+	};
+
+	vector<FrozenNode> frozenNodes;
+	vector<T> frozenContent;
+	vector<double> frozenX; //!< Cartesian coordinates, only for the Poincare disk
+	vector<double> frozenY;
+	HyperbolicPoints frozenPoints; //!< native coordinates, only if not in the Poincare disk
+
+	void unfreeze() {
+		frozenNodes.clear();
+		frozenContent.clear();
+		frozenX.clear();
+		frozenY.clear();
+		frozenPoints.clear();
+	}
+
+	static FrozenCorner frozenCorner(const Point2D<double> &corner) {
+		return FrozenCorner{corner.getX(), corner.getY()};
+	}
+
+	static FrozenNode frozenNode(const QuadNode<T, poincare> &node) {
+		const FrozenRegion region{node.leftAngle, node.minR, node.rightAngle, node.maxR, node.lowerBoundR,
+			frozenCorner(node.a), frozenCorner(node.b), frozenCorner(node.c), frozenCorner(node.d)};
+		return FrozenNode{region, 0, 0, 0, node.size()};
+	}
+
+	void freezePoints(index i, const vector<const QuadNode<T, poincare>*> &original) {
+		FrozenNode &node = frozenNodes[i];
+		node.firstPoint = frozenContent.size();
+		if (node.numChildren == 0) {
+			const QuadNode<T, poincare> &leaf = *original[i];
+			frozenContent.insert(frozenContent.end(), leaf.content.begin(), leaf.content.end());
+			for (index j = 0; j < leaf.content.size(); j++) {
+				if (poincare) {
+					frozenX.push_back(leaf.positions[j].getX());
+					frozenY.push_back(leaf.positions[j].getY());
+				} else {
+					frozenPoints.push_back(leaf.angles[j], leaf.radii[j]);
+				}
+			}
+		} else {
+			for (index c = 0; c < node.numChildren; c++) {
+				freezePoints(node.firstChild + c, original);
+			}
+		}
+		assert(frozenContent.size() - node.firstPoint == node.numPoints);
+	}
+
+	void getElementsInEuclideanCircle(Point2D<double> center, double radius, vector<T> &result, double minAngle, double maxAngle, double lowR, double highR) const {
+		if (isFrozen()) {
+			if (!poincare) throw std::runtime_error("Euclidean query circles not yet implemented for native hyperbolic coordinates.");
+			getFrozenElementsInEuclideanCircle(0, center, radius, result, minAngle, maxAngle, lowR, highR);
+		} else {
+			root.getElementsInEuclideanCircle(center, radius, result, minAngle, maxAngle, lowR, highR);
+		}
+	}
+
+	/**
+	 * Same as QuadNode::getElementsInEuclideanCircle on the subtree of frozen node @a i.
+	 */
+	void getFrozenElementsInEuclideanCircle(index i, Point2D<double> center, double radius, vector<T> &result, double minAngle, double maxAngle, double lowR, double highR) const {
+		const FrozenNode &node = frozenNodes[i];
+		const FrozenRegion &region = node.region;
+		if (minAngle >= region.rightAngle || maxAngle <= region.leftAngle || lowR >= region.maxR || highR < region.lowerBoundR) return;
+		if (QuadNode<T, poincare>::outOfReach(region, center, radius)) {
+			return;
+		}
+
+		if (node.numChildren == 0) {
+			const double rsq = radius*radius;
+			const double queryX = center[0];
+			const double queryY = center[1];
+			const index end = node.firstPoint + node.numPoints;
+
+			for (index p = node.firstPoint; p < end; p++) {
+				const double deltaX = frozenX[p] - queryX;
+				const double deltaY = frozenY[p] - queryY;
+				if (deltaX*deltaX + deltaY*deltaY < rsq) {
+					result.push_back(frozenContent[p]);
+				}
+			}
+		} else {
+			for (index c = 0; c < node.numChildren; c++) {
+				getFrozenElementsInEuclideanCircle(node.firstChild + c, center, radius, result, minAngle, maxAngle, lowR, highR);
+			}
+		}
+	}
+
+	double frozenDistance(index p, Point2D<double> euQuery, const HyperbolicPoints::Query &nativeQuery) const {
+		if (poincare) {
+			return HyperbolicSpace::poincareMetric(Point2D<double>(frozenX[p], frozenY[p]), euQuery);
+		} else {
+			return frozenPoints.distance(p, nativeQuery);
+		}
+	}
+
+	/**
+	 * Same as QuadNode::getElementsProbabilistically on the subtree of frozen node @a i, with the polar
+	 * coordinates (@a phi_q, @a r_q) of the query and their hyperbolic functions in @a nativeQuery computed
+	 * once. Since the points of the subtree are contiguous, the k-th of them is found directly instead of
+	 * descending with maybeGetKthElement.
+	 */
+	template<typename L>
+	count getFrozenElementsProbabilistically(index i, Point2D<double> euQuery, double phi_q, double r_q, const HyperbolicPoints::Query &nativeQuery, const L& prob, bool suppressLeft, vector<T> &result) const {
+		const FrozenNode &node = frozenNodes[i];
+		const FrozenRegion &region = node.region;
+		if (suppressLeft && phi_q > region.rightAngle) return 0;
+		auto distancePair = QuadNode<T, poincare>::hyperbolicDistances(region, phi_q, r_q);
+		double probUB = prob(distancePair.first);
+#ifndef NDEBUG
+		double probLB = prob(distancePair.second);
+		assert(probLB <= probUB);
+#endif
+		if (probUB > 0.5) probUB = 1;//if we are going to take every second element anyway, no use in calculating expensive jumps
+		if (probUB == 0) return 0;
+		double probdenom = std::log(1-probUB);
+		if (probdenom == 0) {
+			DEBUG(probUB, " not zero, but too small too process. Ignoring.");
+			return 0;
+		}
+
+		count expectedNeighbours = probUB*node.numPoints;
+		count candidatesTested = 0;
+
+		if (node.numChildren == 0 || expectedNeighbours < 1) {
+			// jump over the points of the subtree and accept the candidates with the corrected probability
+			const count stsize = node.numPoints;
+			for (index k = 0; k < stsize; k++) {
+				if (probUB < 1) {
+					double delta = std::log(Aux::Random::real()) / probdenom;
+					assert(delta >= 0);
+					k += delta;
+					if (k >= stsize) break;
+				}
+
+				candidatesTested++;
+				const index p = node.firstPoint + k;
+				double distance = frozenDistance(p, euQuery, nativeQuery);
+				assert(distance >= distancePair.first);
+
+				double q = prob(distance) / probUB; //since the candidate was selected by the jumping process, we have to adjust the probabilities
+				assert(q <= 1);
+				assert(q >= 0);
+				if (Aux::Random::real() < q) {
+					result.push_back(frozenContent[p]);
+				}
+			}
+		} else {//carry on as normal
+			for (index c = 0; c < node.numChildren; c++) {
+				candidatesTested += getFrozenElementsProbabilistically(node.firstChild + c, euQuery, phi_q, r_q, nativeQuery, prob, suppressLeft, result);
+			}
+		}
+		return candidatesTested;
+	}
 };
 }
 
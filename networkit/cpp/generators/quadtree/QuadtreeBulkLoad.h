@@ -0,0 +1,127 @@
+/*
+ * QuadtreeBulkLoad.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef QUADTREEBULKLOAD_H_
+#define QUADTREEBULKLOAD_H_
+
+#include <algorithm>
+#include <vector>
+#include <omp.h>
+
+#include "../../Globals.h"
+
+namespace NetworKit {
+
+/**
+ * Builds quadtrees from all points at once, shared by the node types of Quadtree,
+ * QuadtreePolarEuclid and QuadtreeCartesianEuclid.
+ *
+ * A leaf holds less than capacity points, so a node is split if and only if at least
+ * capacity points lie in its region, and it is split when the capacity-th of them
+ * arrives. The tree is therefore built top-down: the points of a node are partitioned
+ * stably among its children, i.e. ordered by their path of cells, and the subtrees are
+ * built by OpenMP tasks. As every node sees its points in the order of insertion, the
+ * result is the same as adding the points one by one, including the splits at the median
+ * of the points of a leaf.
+ */
+namespace QuadtreeBulkLoad {
+
+/**
+ * Subtrees and partitions with fewer points are handled by the task that creates them.
+ */
+const count taskGrain = 1 << 12;
+
+/**
+ * Builds the subtree of the empty leaf @a node from the @a size points (ids into the point
+ * arrays of the caller) at @a points, using the @a size entries at @a buffer as scratch space.
+ *
+ * @param fill fill(leaf, points, size) appends the points to a leaf.
+ * @param split split(node) splits a leaf holding its first capacity-1 points and removes them.
+ * @param childOf childOf(node, point) returns the index of the child responsible for the point.
+ * @param finish finish(node, size) updates a split node after its subtrees have been built.
+ */
+template<class Node, typename Fill, typename Split, typename ChildOf, typename Finish>
+void build(Node &node, index *points, index *buffer, count size, count capacity, const Fill &fill, const Split &split, const ChildOf &childOf, const Finish &finish) {
+	if (size < capacity) {
+		fill(node, points, size);
+		return;
+	}
+	fill(node, points, capacity - 1);
+	split(node);
+
+	// stable counting sort by child, in blocks which are counted and scattered in parallel
+	const count numChildren = node.children.size();
+	const count blocks = std::max<count>(1, std::min<count>(size / taskGrain, 4 * omp_get_num_threads()));
+	std::vector<count> offsets(blocks * numChildren + 1, 0);
+	auto blockBegin = [&](index b) {
+		return size * b / blocks;
+	};
+	auto countBlock = [&](index b) {
+		for (index i = blockBegin(b); i < blockBegin(b + 1); i++) {
+			offsets[childOf(node, points[i]) * blocks + b + 1]++;
+		}
+	};
+	for (index b = 0; b < blocks; b++) {
+		#pragma omp task if(blocks > 1)
+		countBlock(b);
+	}
+	#pragma omp taskwait
+	for (index i = 1; i < offsets.size(); i++) {
+		offsets[i] += offsets[i - 1];
+	}
+	auto scatterBlock = [&](index b) {
+		std::vector<index> next(numChildren);
+		for (index c = 0; c < numChildren; c++) {
+			next[c] = offsets[c * blocks + b];
+		}
+		for (index i = blockBegin(b); i < blockBegin(b + 1); i++) {
+			buffer[next[childOf(node, points[i])]++] = points[i];
+		}
+	};
+	for (index b = 0; b < blocks; b++) {
+		#pragma omp task if(blocks > 1)
+		scatterBlock(b);
+	}
+	#pragma omp taskwait
+
+	// the points of the children are in buffer now, so points is the scratch space of the children
+	auto buildChild = [&](index c) {
+		const index begin = offsets[c * blocks];
+		build(node.children[c], buffer + begin, points + begin, offsets[(c + 1) * blocks] - begin, capacity, fill, split, childOf, finish);
+	};
+	for (index c = 0; c < numChildren; c++) {
+		#pragma omp task if(offsets[(c + 1) * blocks] - offsets[c * blocks] >= taskGrain)
+		buildChild(c);
+	}
+	#pragma omp taskwait
+	finish(node, size);
+}
+
+/**
+ * Builds the subtree of the empty leaf @a root from the points 0, ..., @a n - 1, see build().
+ */
+template<class Node, typename Fill, typename Split, typename ChildOf, typename Finish>
+void bulkLoad(Node &root, count n, count capacity, const Fill &fill, const Split &split, const ChildOf &childOf, const Finish &finish) {
+	std::vector<index> points(n);
+	std::vector<index> buffer(n);
+	#pragma omp parallel for
+	for (omp_index i = 0; i < static_cast<omp_index>(n); i++) {
+		points[i] = i;
+	}
+
+	#pragma omp parallel
+	{
+		#pragma omp single nowait
+		{
+			build(root, points.data(), buffer.data(), n, capacity, fill, split, childOf, finish);
+		}
+	}
+}
+
+} /* namespace QuadtreeBulkLoad */
+
+} /* namespace NetworKit */
+#endif /* QUADTREEBULKLOAD_H_ */
@@ -36,9 +36,8 @@ public:
 	}
 
 	QuadtreeCartesianEuclid(const vector<Point<double> > &positions, const vector<T> &content, bool theoreticalSplit=false, count capacity=1000) {
-		const count n = positions.size();
-		assert(content.size() == n);
-		assert(n > 0);
+		assert(content.size() == positions.size());
+		assert(positions.size() > 0);
 
 		this->dimension = positions[0].getDimensions();
 		vector<double> lowerValue(dimension);
@@ -64,10 +63,7 @@ public:
 		this->upper = Point<double>(upperValue);
 
 		root = QuadNodeCartesianEuclid<T>(lower, upper, capacity, theoreticalSplit);
-		for (index i = 0; i < n; i++) {
-			assert(content[i] < n);
-			root.addContent(content[i], positions[i]);
-		}
+		root.bulkLoad(content, positions);
 	}
 
 	/**
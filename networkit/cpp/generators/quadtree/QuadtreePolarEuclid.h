@@ -48,10 +48,7 @@ public:
 		}
 		maxRadius = std::nextafter(maxRadius, std::numeric_limits<double>::max());
 		root = QuadNodePolarEuclid<T>(0, 0, 2*PI, maxRadius, capacity, theoreticalSplit,balance);
-		for (index i = 0; i < n; i++) {
-			assert(content[i] < n);
-			root.addContent(content[i], angles[i], radii[i]);
-		}
+		root.bulkLoad(content, angles, radii);
 	}
 
 	/**
@@ -89,11 +86,13 @@ public:
 		root.getElementsInEuclideanCircle(circleCenter, radius, false, circleDenizens);
 	}
 
-	count getElementsProbabilistically(Point2D<double> euQuery, std::function<double(double)> prob, vector<T> &circleDenizens) {
+	template<typename L>
+	count getElementsProbabilistically(Point2D<double> euQuery, L prob, vector<T> &circleDenizens) {
 		return root.getElementsProbabilistically(euQuery, prob, false, circleDenizens);
 	}
 
-	count getElementsProbabilistically(Point2D<double> euQuery, std::function<double(double)> prob, bool suppressLeft, vector<T> &circleDenizens) {
+	template<typename L>
+	count getElementsProbabilistically(Point2D<double> euQuery, L prob, bool suppressLeft, vector<T> &circleDenizens) {
 		return root.getElementsProbabilistically(euQuery, prob, suppressLeft, circleDenizens);
 	}
 
@@ -423,6 +423,79 @@ TEST_F(QuadTreeGTest, testSequentialQuadTreeConstruction) {
 	//EXPECT_TRUE(std::is_permutation(radii.begin(), radii.end(), radiicopy.begin()));
 }
 
+TEST_F(QuadTreeGTest, testQuadTreeBulkLoad) {
+	Aux::Random::setSeed(0, false);
+	count n = 50000;
+	count capacity = 20;
+	double alpha = 1;
+	double R = HyperbolicSpace::hyperbolicAreaToRadius(n);
+	vector<double> angles(n);
+	vector<double> radii(n);
+	vector<index> content(n);
+	HyperbolicSpace::fillPoints(angles, radii, R, alpha);
+	for (index i = 0; i < n; i++) {
+		content[i] = i;
+	}
+
+	//native coordinates, as used by the HyperbolicGenerator
+	Quadtree<index, false> nativeQuad(R, false, alpha, capacity);
+	for (index i = 0; i < n; i++) {
+		nativeQuad.addContent(i, angles[i], radii[i]);
+	}
+	Quadtree<index, false> nativeBulk(R, false, alpha, capacity);
+	nativeBulk.bulkLoad(content, angles, radii);
+	EXPECT_EQ(n, nativeBulk.size());
+	expectSameTree(nativeQuad, nativeBulk);
+
+	//Poincare disk with theoretical split
+	double r = HyperbolicSpace::hyperbolicRadiusToEuclidean(R);
+	vector<double> euclideanRadii(n);
+	for (index i = 0; i < n; i++) {
+		euclideanRadii[i] = std::min(HyperbolicSpace::hyperbolicRadiusToEuclidean(radii[i]), std::nextafter(r, 0));
+	}
+	Quadtree<index> poincareQuad(r, true, alpha, capacity);
+	for (index i = 0; i < n; i++) {
+		poincareQuad.addContent(i, angles[i], euclideanRadii[i]);
+	}
+	Quadtree<index> poincareBulk(r, true, alpha, capacity);
+	poincareBulk.bulkLoad(content, angles, euclideanRadii);
+	expectSameTree(poincareQuad, poincareBulk);
+
+	//the pruning with the lower bounds of the radii gives the same results
+	for (index i = 0; i < 100; i++) {
+		index query = Aux::Random::integer(n-1);
+		Point2D<double> center = HyperbolicSpace::polarToCartesian(angles[query], euclideanRadii[query]);
+		EXPECT_EQ(poincareQuad.getElementsInHyperbolicCircle(center, R/4), poincareBulk.getElementsInHyperbolicCircle(center, R/4));
+	}
+
+	//median splits depend on the first points of a leaf
+	double maxR = std::nextafter(*std::max_element(radii.begin(), radii.end()), R);
+	QuadNodePolarEuclid<index> polarNode(0, 0, 2*PI, maxR, capacity);
+	for (index i = 0; i < n; i++) {
+		polarNode.addContent(i, angles[i], radii[i]);
+	}
+	QuadNodePolarEuclid<index> polarBulk(0, 0, 2*PI, maxR, capacity);
+	polarBulk.bulkLoad(content, angles, radii);
+	expectSameSubtree(polarNode, polarBulk);
+
+	count dimension = 3;
+	vector<Point<double> > positions(n);
+	for (index i = 0; i < n; i++) {
+		vector<double> coordinates = {Aux::Random::probability(), Aux::Random::probability(), Aux::Random::probability()};
+		positions[i] = Point<double>(coordinates);
+	}
+	vector<double> ones(dimension, 1.0);
+	Point<double> lower(dimension);
+	Point<double> upper(ones);
+	QuadNodeCartesianEuclid<index> cartesianNode(lower, upper, capacity);
+	for (index i = 0; i < n; i++) {
+		cartesianNode.addContent(i, positions[i]);
+	}
+	QuadNodeCartesianEuclid<index> cartesianBulk(lower, upper, capacity);
+	cartesianBulk.bulkLoad(content, positions);
+	expectSameSubtree(cartesianNode, cartesianBulk);
+}
+
 TEST_F(QuadTreeGTest, testProbabilisticQuery) {
 	Aux::Random::setSeed(0, false);
 	count n = 5000;
@@ -452,7 +525,7 @@ TEST_F(QuadTreeGTest, testProbabilisticQuery) {
 	for (index i = 0; i < 200; i++) {
 		index query = Aux::Random::integer(n-1);
 		double acc = Aux::Random::probability() ;
-		auto edgeProb = [acc](double distance) -> double {return acc;};
+		auto edgeProb = [acc](double) -> double {return acc;};
 		vector<index> near;
 		quad.getElementsProbabilistically(HyperbolicSpace::polarToCartesian(angles[query], radii[query]), edgeProb, near);
 		EXPECT_NEAR(near.size(), acc*n, std::max(acc*n*0.25, 10.0));
@@ -460,17 +533,87 @@ TEST_F(QuadTreeGTest, testProbabilisticQuery) {
 
 	//TODO: some test about appropriate subtrees and leaves
 
-	auto edgeProb = [](double distance) -> double {return 1;};
+	auto edgeProb = [](double) -> double {return 1;};
 	vector<index> near;
 	quad.getElementsProbabilistically(HyperbolicSpace::polarToCartesian(angles[0], radii[0]), edgeProb, near);
 	EXPECT_EQ(n, near.size());
 
-	auto edgeProb2 = [](double distance) -> double {return 0;};
+	auto edgeProb2 = [](double) -> double {return 0;};
 	near.clear();
 	quad.getElementsProbabilistically(HyperbolicSpace::polarToCartesian(angles[0], radii[0]), edgeProb2, near);
 	EXPECT_EQ(0u, near.size());
 }
 
+/**
+ * Queries on the frozen layout have to return the same elements as on the tree itself
+ */
+TEST_F(QuadTreeGTest, testFrozenQuadTree) {
+	count n = 5000;
+	count capacity = 20;
+	double alpha = 1;
+	double R = HyperbolicSpace::hyperbolicAreaToRadius(n);
+	vector<double> angles(n);
+	vector<double> radii(n);
+	HyperbolicSpace::fillPoints(angles, radii, R, alpha);
+
+	Quadtree<index> poincareQuad(HyperbolicSpace::hyperbolicRadiusToEuclidean(R), false, alpha, capacity);
+	Quadtree<index, false> nativeQuad(R, false, alpha, capacity);
+	for (index i = 0; i < n; i++) {
+		nativeQuad.addContent(i, angles[i], radii[i]);
+		double r = HyperbolicSpace::hyperbolicRadiusToEuclidean(radii[i]);
+		if (r == poincareQuad.getMaxRadius()) r = std::nextafter(r, 0);
+		poincareQuad.addContent(i, angles[i], r);
+		radii[i] = r;
+	}
+	EXPECT_FALSE(poincareQuad.isFrozen());
+
+	vector<vector<index> > circleResults;
+	vector<vector<index> > thresholdResults;
+	// with a step function as probability, the probabilistic query is deterministic
+	auto threshold = [R](double distance) -> double {return distance <= R ? 1 : 0;};
+	for (index i = 0; i < 100; i++) {
+		Point2D<double> query = HyperbolicSpace::polarToCartesian(angles[i], radii[i]);
+		circleResults.push_back(poincareQuad.getElementsInHyperbolicCircle(query, R));
+		vector<index> near;
+		nativeQuad.getElementsProbabilistically(HyperbolicSpace::polarToCartesian(angles[i], HyperbolicSpace::EuclideanRadiusToHyperbolic(radii[i])), threshold, near);
+		thresholdResults.push_back(near);
+	}
+
+	poincareQuad.freeze();
+	nativeQuad.freeze();
+	EXPECT_TRUE(poincareQuad.isFrozen());
+	EXPECT_EQ(n, poincareQuad.size());
+	for (index i = 0; i < 100; i++) {
+		Point2D<double> query = HyperbolicSpace::polarToCartesian(angles[i], radii[i]);
+		vector<index> frozenCircle = poincareQuad.getElementsInHyperbolicCircle(query, R);
+		std::sort(frozenCircle.begin(), frozenCircle.end());
+		std::sort(circleResults[i].begin(), circleResults[i].end());
+		EXPECT_EQ(circleResults[i], frozenCircle);
+
+		vector<index> near;
+		nativeQuad.getElementsProbabilistically(HyperbolicSpace::polarToCartesian(angles[i], HyperbolicSpace::EuclideanRadiusToHyperbolic(radii[i])), threshold, near);
+		std::sort(near.begin(), near.end());
+		std::sort(thresholdResults[i].begin(), thresholdResults[i].end());
+		EXPECT_EQ(thresholdResults[i], near);
+	}
+
+	// sampling with a constant probability uses the jumps over the contiguous points
+	for (index i = 0; i < 50; i++) {
+		double acc = Aux::Random::probability();
+		auto edgeProb = [acc](double) -> double {return acc;};
+		vector<index> near;
+		nativeQuad.getElementsProbabilistically(HyperbolicSpace::polarToCartesian(angles[i], HyperbolicSpace::EuclideanRadiusToHyperbolic(radii[i])), edgeProb, near);
+		EXPECT_NEAR(near.size(), acc*n, std::max(acc*n*0.25, 10.0));
+		std::sort(near.begin(), near.end());
+		EXPECT_TRUE(std::unique(near.begin(), near.end()) == near.end());
+	}
+
+	// modifications go back to the tree
+	EXPECT_TRUE(poincareQuad.removeContent(0, angles[0], radii[0]));
+	EXPECT_FALSE(poincareQuad.isFrozen());
+	EXPECT_EQ(n-1, poincareQuad.size());
+}
+
 TEST_F(QuadTreeGTest, testCartesianEuclidQuery) {
 	count n = 10000;
 	//count m = n*3;
@@ -508,12 +651,12 @@ TEST_F(QuadTreeGTest, testCartesianEuclidQuery) {
 
 	//TODO: some test about appropriate subtrees and leaves
 
-	auto edgeProb = [](double distance) -> double {return 1;};
+	auto edgeProb = [](double) -> double {return 1;};
 	vector<index> near;
 	quad.getElementsProbabilistically(positions[0], edgeProb, near);
 	EXPECT_EQ(n, near.size());
 
-	auto edgeProb2 = [](double distance) -> double {return 0;};
+	auto edgeProb2 = [](double) -> double {return 0;};
 	near.clear();
 	quad.getElementsProbabilistically(positions[0], edgeProb2, near);
 	EXPECT_EQ(0u, near.size());
@@ -697,7 +840,7 @@ TEST_F(QuadTreeGTest, testPolarEuclidQuery) {
 	for (index i = 0; i < 200; i++) {
 		index query = Aux::Random::integer(n-1);
 		double acc = Aux::Random::probability() ;
-		auto edgeProb = [acc](double distance) -> double {return acc;};
+		auto edgeProb = [acc](double) -> double {return acc;};
 		vector<index> near;
 		tree.getElementsProbabilistically(HyperbolicSpace::polarToCartesian(angles[query], radii[query]), edgeProb, near);
 		EXPECT_NEAR(near.size(), acc*n, std::max(acc*n*0.25, 10.0));
@@ -705,12 +848,12 @@ TEST_F(QuadTreeGTest, testPolarEuclidQuery) {
 
 	//TODO: some test about appropriate subtrees and leaves
 
-	auto edgeProb = [](double distance) -> double {return 1;};
+	auto edgeProb = [](double) -> double {return 1;};
 	vector<index> near;
 	tree.getElementsProbabilistically(HyperbolicSpace::polarToCartesian(angles[0], radii[0]), edgeProb, near);
 	EXPECT_EQ(n, near.size());
 
-	auto edgeProb2 = [](double distance) -> double {return 0;};
+	auto edgeProb2 = [](double) -> double {return 0;};
 	near.clear();
 	tree.getElementsProbabilistically(HyperbolicSpace::polarToCartesian(angles[0], radii[0]), edgeProb2, near);
 	EXPECT_EQ(0u, near.size());
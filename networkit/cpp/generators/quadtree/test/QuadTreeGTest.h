@@ -33,6 +33,25 @@ protected:
 	vector<QuadNode<T> > getChildren(QuadNode<T> &node) {
 		return node.children;
 	}
+
+	template <class T, bool poincare>
+	void expectSameTree(const Quadtree<T, poincare> &first, const Quadtree<T, poincare> &second) {
+		expectSameSubtree(first.root, second.root);
+	}
+
+	/**
+	 * Checks that both subtrees have the same shape and the same contents in the same order.
+	 */
+	template <class Node>
+	void expectSameSubtree(const Node &first, const Node &second) {
+		EXPECT_EQ(first.isLeaf, second.isLeaf);
+		EXPECT_EQ(first.size(), second.size());
+		EXPECT_EQ(first.content, second.content);
+		ASSERT_EQ(first.children.size(), second.children.size());
+		for (index i = 0; i < first.children.size(); i++) {
+			expectSameSubtree(first.children[i], second.children[i]);
+		}
+	}
 };
 
 } /* namespace NetworKit */
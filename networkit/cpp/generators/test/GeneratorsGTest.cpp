@@ -12,6 +12,7 @@ Dy * GeneratorsTest.cpp
 
 #include <numeric>
 #include <cmath>
+#include <fstream>
 
 #include "../ClusteredRandomGraphGenerator.h"
 #include "../DynamicGraphSource.h"
@@ -34,6 +35,7 @@ Dy * GeneratorsTest.cpp
 #include "../LFRGenerator.h"
 #include "../MocnikGenerator.h"
 #include "../MocnikGeneratorBasic.h"
+#include "../GIRGGenerator.h"
 
 
 #include "../../viz/PostscriptWriter.h"
@@ -45,6 +47,7 @@ Dy * GeneratorsTest.cpp
 #include "../../io/GraphIO.h"
 #include "../../io/METISGraphReader.h"
 #include "../../community/Modularity.h"
+#include "../../graph/test/GraphTestUtils.h"
 #include "../../dynamics/GraphUpdater.h"
 #include "../../auxiliary/MissingMath.h"
 #include "../../auxiliary/Parallel.h"
@@ -52,6 +55,7 @@ Dy * GeneratorsTest.cpp
 #include "../../global/ClusteringCoefficient.h"
 #include "../../community/PLM.h"
 #include "../../community/Modularity.h"
+#include "../../graph/test/GraphTestUtils.h"
 
 
 namespace NetworKit {
@@ -297,6 +301,43 @@ TEST_F(GeneratorsGTest, testDynamicHyperbolicGeneratorOnMovedNodes) {
 	EXPECT_NEAR(G.numberOfEdges(), initialEdgeCount, initialEdgeCount/5);
 }
 
+/**
+ * Applying the events of the kinetic movement for T = 0 must result in the graph of the moved points.
+ */
+TEST_F(GeneratorsGTest, testDynamicHyperbolicGeneratorKineticEvents) {
+	const count n = 5000;
+	const double k = 8;
+	const double alpha = 1;
+	const double R = HyperbolicSpace::getTargetRadius(n, n*k/2, alpha, 0);
+
+	for (double movedShare : {0.01, 0.2, 1.0}) {
+		vector<double> angles(n);
+		vector<double> radii(n);
+		HyperbolicSpace::fillPoints(angles, radii, R, alpha);
+		DynamicHyperbolicGenerator dynGen(angles, radii, R, alpha, 0, movedShare, 0.5);
+		Graph G = dynGen.getGraph();
+		GraphUpdater gu(G);
+
+		for (index step = 0; step < 5; step++) {
+			std::vector<GraphEvent> stream = dynGen.generate(1);
+			for (const GraphEvent &event : stream) {
+				if (event.type == GraphEvent::EDGE_ADDITION) {
+					EXPECT_FALSE(G.hasEdge(event.u, event.v));
+				} else if (event.type == GraphEvent::EDGE_REMOVAL) {
+					EXPECT_TRUE(G.hasEdge(event.u, event.v));
+				}
+			}
+			gu.update(stream);
+
+			Graph comparison = dynGen.getGraph();
+			ASSERT_EQ(comparison.numberOfEdges(), G.numberOfEdges());
+			comparison.forEdges([&](node u, node v) {
+				EXPECT_TRUE(G.hasEdge(u, v));
+			});
+		}
+	}
+}
+
 /**
  * creates a series of pictures visualizing the effect of the dynamic hyperbolic generator
  */
@@ -456,6 +497,36 @@ TEST_F(GeneratorsGTest, testDynamicPathGenerator) {
 	#endif
 }
 
+/**
+ * Generates a graph with the same seed using one and several threads and checks that the edges agree.
+ */
+template<class Generator>
+static void expectSameGraphForAnyNumberOfThreads(Generator& generator) {
+	auto sortedEdges = [](const Graph& G) {
+		std::vector<std::tuple<node, node, edgeweight>> edges;
+		G.forEdges([&](node u, node v, edgeweight w) {
+			edges.emplace_back(std::max(u, v), std::min(u, v), w);
+		});
+		std::sort(edges.begin(), edges.end());
+		return edges;
+	};
+
+	auto generateWithThreads = [&](int threads) {
+		return GraphTestUtils::withThreads(threads, [&]() {
+			Aux::Random::setSeed(42, false);
+			return generator.generate();
+		});
+	};
+	Graph G1 = generateWithThreads(1);
+	Graph G4 = generateWithThreads(4);
+
+	EXPECT_TRUE(G4.checkConsistency());
+	EXPECT_EQ(G1.numberOfNodes(), G4.numberOfNodes());
+	EXPECT_EQ(G1.numberOfEdges(), G4.numberOfEdges());
+	EXPECT_EQ(G1.numberOfSelfLoops(), G4.numberOfSelfLoops());
+	EXPECT_TRUE(sortedEdges(G1) == sortedEdges(G4));
+}
+
 TEST_F(GeneratorsGTest, testErdosRenyiGenerator) {
 	count n = 2000;
 	double p = 1.5 * (log(n) / (double) n);
@@ -475,6 +546,25 @@ TEST_F(GeneratorsGTest, testErdosRenyiGenerator) {
 	EXPECT_TRUE(G.checkConsistency());
 }
 
+TEST_F(GeneratorsGTest, testErdosRenyiGeneratorThreadIndependence) {
+	count n = 3000;
+	double p = 0.01;
+	ErdosRenyiGenerator generator(n, p);
+	expectSameGraphForAnyNumberOfThreads(generator);
+	ErdosRenyiGenerator directedGenerator(n, p, true);
+	expectSameGraphForAnyNumberOfThreads(directedGenerator);
+
+	// stream the edges without building the graph
+	std::atomic<count> nEdges(0);
+	directedGenerator.parallelForEdges([&](node u, node v) {
+		EXPECT_LT(v, u);
+		nEdges += 1;
+	});
+	count nPairs = (n * (n-1)) / 2;
+	EXPECT_GE(nEdges, 0.9 * p * nPairs);
+	EXPECT_LE(nEdges, 1.1 * p * nPairs);
+}
+
 TEST_F(GeneratorsGTest, testRmatGeneratorException) {
 	count scale = 9;
 	count edgeFactor = 12;
@@ -515,6 +605,29 @@ TEST_F(GeneratorsGTest, testRmatGenerator) {
 	EXPECT_TRUE(G.checkConsistency());
 }
 
+TEST_F(GeneratorsGTest, testRmatGeneratorThreadIndependence) {
+	count scale = 10;
+	count edgeFactor = 8;
+	count n = (1 << scale);
+
+	RmatGenerator rmat(scale, edgeFactor, 0.57, 0.19, 0.19, 0.05);
+	expectSameGraphForAnyNumberOfThreads(rmat);
+	Graph G = rmat.generate();
+	EXPECT_EQ(n * edgeFactor, G.numberOfEdges());
+
+	RmatGenerator reducedRmat(scale, edgeFactor, 0.57, 0.19, 0.19, 0.05, false, 24);
+	expectSameGraphForAnyNumberOfThreads(reducedRmat);
+	G = reducedRmat.generate();
+	EXPECT_EQ(n - 24, G.numberOfNodes());
+	EXPECT_EQ((n - 24) * edgeFactor, G.numberOfEdges());
+	EXPECT_EQ(0u, G.numberOfSelfLoops());
+
+	RmatGenerator weightedRmat(scale, edgeFactor, 0.57, 0.19, 0.19, 0.05, true);
+	expectSameGraphForAnyNumberOfThreads(weightedRmat);
+	G = weightedRmat.generate();
+	EXPECT_TRUE(G.isWeighted());
+	EXPECT_DOUBLE_EQ(n * edgeFactor, G.totalEdgeWeight());
+}
 
 TEST_F(GeneratorsGTest, testChungLuGenerator) {
 	count n = 400;
@@ -581,6 +694,16 @@ TEST_F(GeneratorsGTest, testChungLuGeneratorVolumeConsistency) {
 	EXPECT_NEAR(G.numberOfEdges() * 2, expectedVolume, 0.2 * expectedVolume);
 }
 
+TEST_F(GeneratorsGTest, testChungLuGeneratorThreadIndependence) {
+	count n = 2000;
+	std::vector<count> vec;
+	for (index i = 0; i < n; i++) {
+		vec.push_back(1 + (i * i) % 100);
+	}
+	ChungLuGenerator generator(vec);
+	expectSameGraphForAnyNumberOfThreads(generator);
+}
+
 TEST_F(GeneratorsGTest, testHavelHakimiGeneratorOnRandomSequence) {
 	count n = 400;
 	count maxDegree = n / 10;
@@ -862,6 +985,104 @@ TEST_F(GeneratorsGTest, testHyperbolicGeneratorMechanicGraphs) {
 	ASSERT_TRUE(G.checkConsistency());
 }
 
+/**
+ * Generates a graph in memory and streams a graph with the same seed into all edge sinks,
+ * then checks that all of them have received the edges of the graph.
+ */
+static void expectSameEdgesInSinks(StaticGraphGenerator& generator) {
+	typedef std::vector<std::pair<node, node>> EdgeVector;
+	auto normalized = [](EdgeVector edges, bool directed) {
+		if (!directed) {
+			for (std::pair<node, node>& edge : edges) {
+				edge = std::make_pair(std::max(edge.first, edge.second), std::min(edge.first, edge.second));
+			}
+		}
+		std::sort(edges.begin(), edges.end());
+		return edges;
+	};
+	auto readEdges = [](const std::string& path, EdgeVector& edges) {
+		std::ifstream in(path, std::ios::binary);
+		std::vector<unsigned char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+		ASSERT_EQ(0u, bytes.size() % 16);
+		auto word = [&](index pos) {
+			uint64_t value = 0;
+			for (index b = 8; b-- > 0;) {
+				value = (value << 8) | bytes[pos + b];
+			}
+			return value;
+		};
+		for (index pos = 0; pos < bytes.size(); pos += 16) {
+			edges.emplace_back(word(pos), word(pos + 8));
+		}
+	};
+
+	Aux::Random::setSeed(42, false);
+	const Graph G = generator.generate();
+	EdgeVector expected;
+	G.forEdges([&](node u, node v) {
+		expected.emplace_back(u, v);
+	});
+	expected = normalized(expected, G.isDirected());
+
+	GraphBuilderEdgeSink builderSink;
+	Aux::Random::setSeed(42, false);
+	generator.generateEdges(builderSink);
+	const Graph H = builderSink.getGraph();
+	EXPECT_TRUE(H.checkConsistency());
+	EXPECT_EQ(G.numberOfNodes(), H.numberOfNodes());
+	EdgeVector built;
+	H.forEdges([&](node u, node v) {
+		built.emplace_back(u, v);
+	});
+	EXPECT_TRUE(expected == normalized(built, H.isDirected()));
+
+	CountingEdgeSink countingSink;
+	Aux::Random::setSeed(42, false);
+	generator.generateEdges(countingSink);
+	EXPECT_EQ(G.numberOfEdges(), countingSink.numberOfEdges());
+	EXPECT_EQ(G.numberOfSelfLoops(), countingSink.numberOfSelfLoops());
+
+	// small buffers, so the buffers are flushed several times
+	BinaryFileEdgeSink fileSink("output/edgesink.bin", 8, 1024);
+	Aux::Random::setSeed(42, false);
+	generator.generateEdges(fileSink);
+	EdgeVector written;
+	readEdges("output/edgesink.bin", written);
+	EXPECT_TRUE(expected == normalized(written, G.isDirected()));
+
+	ShardedBinaryFileEdgeSink shardedSink("output/edgesink.shard", 8, 1024);
+	Aux::Random::setSeed(42, false);
+	generator.generateEdges(shardedSink);
+	EdgeVector sharded;
+	for (const std::string& path : shardedSink.getShardPaths()) {
+		readEdges(path, sharded);
+	}
+	EXPECT_TRUE(expected == normalized(sharded, G.isDirected()));
+}
+
+TEST_F(GeneratorsGTest, testEdgeSinks) {
+	ErdosRenyiGenerator erdosRenyi(1000, 0.01);
+	expectSameEdgesInSinks(erdosRenyi);
+	ErdosRenyiGenerator directedErdosRenyi(1000, 0.01, true);
+	expectSameEdgesInSinks(directedErdosRenyi);
+
+	std::vector<count> degrees;
+	for (index i = 0; i < 1000; i++) {
+		degrees.push_back(1 + (i * i) % 100);
+	}
+	ChungLuGenerator chungLu(degrees);
+	expectSameEdgesInSinks(chungLu);
+
+	HyperbolicGenerator hyperbolic(1000, 8, 3);
+	expectSameEdgesInSinks(hyperbolic);
+	HyperbolicGenerator warmHyperbolic(1000, 8, 3, 0.5);
+	expectSameEdgesInSinks(warmHyperbolic);
+
+	// generators without a streaming implementation pass the edges of the generated graph
+	BarabasiAlbertGenerator barabasiAlbert(4, 1000);
+	expectSameEdgesInSinks(barabasiAlbert);
+}
+
 TEST_F(GeneratorsGTest, testConfigurationModelGeneratorOnRealSequence) {
 	METISGraphReader reader;
 	std::vector<std::string> graphs = {"input/jazz.graph",
@@ -1111,6 +1332,73 @@ TEST_F(GeneratorsGTest, testMocnikGeneratorBasic) {
 	EXPECT_NEAR(G.numberOfEdges() * 1. / G.numberOfNodes(), std::pow(k, dim), 10000);
 }
 
+TEST_F(GeneratorsGTest, testGIRGGeneratorThreshold) {
+	const count n = 2000;
+	for (count dimension = 1; dimension <= 3; dimension++) {
+		GIRGGenerator gen(n, dimension, 8, 2.5, 0);
+		Graph G = gen.generate();
+		EXPECT_EQ(n, G.numberOfNodes());
+		EXPECT_TRUE(G.checkConsistency());
+		EXPECT_EQ(0u, G.numberOfSelfLoops());
+
+		// compare with the definition for all pairs of nodes
+		const std::vector<double> &weights = gen.getWeights();
+		const std::vector<double> &positions = gen.getPositions();
+		const double totalWeight = std::accumulate(weights.begin(), weights.end(), 0.0);
+		count edges = 0;
+		for (node u = 0; u < n; u++) {
+			for (node v = u + 1; v < n; v++) {
+				double distance = 0;
+				for (index k = 0; k < dimension; k++) {
+					double difference = std::abs(positions[u * dimension + k] - positions[v * dimension + k]);
+					distance = std::max(distance, std::min(difference, 1 - difference));
+				}
+				const bool adjacent = std::pow(2 * distance, dimension) <= gen.getScaling() * weights[u] * weights[v] / totalWeight;
+				EXPECT_EQ(adjacent, G.hasEdge(u, v));
+				edges += adjacent;
+			}
+		}
+		EXPECT_EQ(edges, G.numberOfEdges());
+	}
+}
+
+TEST_F(GeneratorsGTest, testGIRGGeneratorAverageDegree) {
+	const count n = 20000;
+	const double avgDegree = 10;
+	for (double T : {0.0, 0.5}) {
+		for (count dimension : {1, 2}) {
+			GIRGGenerator gen(n, dimension, avgDegree, 2.8, T);
+			Graph G = gen.generate();
+			EXPECT_TRUE(G.checkConsistency());
+			EXPECT_EQ(0u, G.numberOfSelfLoops());
+			EXPECT_NEAR(avgDegree, GIRGGenerator::expectedAverageDegree(gen.getWeights(), gen.getScaling(), T), 1e-6);
+			EXPECT_NEAR(avgDegree, 2.0 * G.numberOfEdges() / n, 1);
+		}
+	}
+}
+
+TEST_F(GeneratorsGTest, testGIRGGeneratorReproducible) {
+	// the graph only depends on the seed, not on the number of threads
+	using GraphTestUtils::adjacencies;
+	for (double T : {0.0, 0.5}) {
+		for (count dimension : {1, 2}) {
+			GIRGGenerator gen(5000, dimension, 10, 2.5, T);
+			auto generateWithThreads = [&](int threads) {
+				return GraphTestUtils::withThreads(threads, [&]() {
+					Aux::Random::setSeed(42, false);
+					return gen.generate();
+				});
+			};
+			Graph G1 = generateWithThreads(1);
+			Graph G4 = generateWithThreads(4);
+			Graph H4 = generateWithThreads(4);
+
+			EXPECT_EQ(adjacencies(G1), adjacencies(G4));
+			EXPECT_EQ(adjacencies(G4), adjacencies(H4));
+		}
+	}
+}
+
 } /* namespace NetworKit */
 
 #endif /*NOGTEST */
@@ -0,0 +1,128 @@
+/*
+ * HyperbolicPoints.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include "HyperbolicPoints.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define NETWORKIT_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace NetworKit {
+
+namespace {
+
+struct KernelArguments {
+	const double *coshR, *sinhR, *cosPhi, *sinPhi;
+	const HyperbolicPoints::Query &query;
+	double coshThreshold;
+	const index *ids;
+	std::vector<index> &result;
+};
+
+void filterScalar(const KernelArguments &args, index begin, index end) {
+	const HyperbolicPoints::Query &q = args.query;
+	for (index k = begin; k < end; ++k) {
+		double cosDeltaPhi = args.cosPhi[k] * q.cosPhi + args.sinPhi[k] * q.sinPhi;
+		if (args.coshR[k] * q.coshR - args.sinhR[k] * q.sinhR * cosDeltaPhi <= args.coshThreshold) {
+			args.result.push_back(args.ids[k]);
+		}
+	}
+}
+
+#ifdef NETWORKIT_X86_KERNELS
+
+// same operations in the same order as filterScalar, so all kernels return the same points
+__attribute__((target("avx2")))
+void filterAVX2(const KernelArguments &args, index begin, index end) {
+	const HyperbolicPoints::Query &q = args.query;
+	const __m256d qCoshR = _mm256_set1_pd(q.coshR);
+	const __m256d qSinhR = _mm256_set1_pd(q.sinhR);
+	const __m256d qCosPhi = _mm256_set1_pd(q.cosPhi);
+	const __m256d qSinPhi = _mm256_set1_pd(q.sinPhi);
+	const __m256d threshold = _mm256_set1_pd(args.coshThreshold);
+
+	index k = begin;
+	for (; k + 4 <= end; k += 4) {
+		__m256d cosDeltaPhi = _mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(args.cosPhi + k), qCosPhi),
+				_mm256_mul_pd(_mm256_loadu_pd(args.sinPhi + k), qSinPhi));
+		__m256d sinhTerm = _mm256_mul_pd(_mm256_mul_pd(_mm256_loadu_pd(args.sinhR + k), qSinhR), cosDeltaPhi);
+		__m256d coshDistance = _mm256_sub_pd(_mm256_mul_pd(_mm256_loadu_pd(args.coshR + k), qCoshR), sinhTerm);
+		int mask = _mm256_movemask_pd(_mm256_cmp_pd(coshDistance, threshold, _CMP_LE_OQ));
+		while (mask) {
+			int lane = __builtin_ctz(mask);
+			args.result.push_back(args.ids[k + lane]);
+			mask &= mask - 1;
+		}
+	}
+	filterScalar(args, k, end);
+}
+
+__attribute__((target("avx512f")))
+void filterAVX512(const KernelArguments &args, index begin, index end) {
+	const HyperbolicPoints::Query &q = args.query;
+	const __m512d qCoshR = _mm512_set1_pd(q.coshR);
+	const __m512d qSinhR = _mm512_set1_pd(q.sinhR);
+	const __m512d qCosPhi = _mm512_set1_pd(q.cosPhi);
+	const __m512d qSinPhi = _mm512_set1_pd(q.sinPhi);
+	const __m512d threshold = _mm512_set1_pd(args.coshThreshold);
+
+	index k = begin;
+	for (; k + 8 <= end; k += 8) {
+		__m512d cosDeltaPhi = _mm512_add_pd(_mm512_mul_pd(_mm512_loadu_pd(args.cosPhi + k), qCosPhi),
+				_mm512_mul_pd(_mm512_loadu_pd(args.sinPhi + k), qSinPhi));
+		__m512d sinhTerm = _mm512_mul_pd(_mm512_mul_pd(_mm512_loadu_pd(args.sinhR + k), qSinhR), cosDeltaPhi);
+		__m512d coshDistance = _mm512_sub_pd(_mm512_mul_pd(_mm512_loadu_pd(args.coshR + k), qCoshR), sinhTerm);
+		unsigned mask = _mm512_cmp_pd_mask(coshDistance, threshold, _CMP_LE_OQ);
+		while (mask) {
+			int lane = __builtin_ctz(mask);
+			args.result.push_back(args.ids[k + lane]);
+			mask &= mask - 1;
+		}
+	}
+	filterScalar(args, k, end);
+}
+
+#endif
+
+} // namespace
+
+HyperbolicPoints::Vectorization HyperbolicPoints::bestVectorization() {
+#ifdef NETWORKIT_X86_KERNELS
+	static const Vectorization best = []() {
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx512f")) {
+			return Vectorization::AVX512;
+		}
+		if (__builtin_cpu_supports("avx2")) {
+			return Vectorization::AVX2;
+		}
+		return Vectorization::SCALAR;
+	}();
+	return best;
+#else
+	return Vectorization::SCALAR;
+#endif
+}
+
+void HyperbolicPoints::filterByDistance(index begin, index end, const Query &query, double coshThreshold, const index *ids, std::vector<index> &result,
+		Vectorization vectorization) const {
+	KernelArguments args{coshR.data(), sinhR.data(), cosPhi.data(), sinPhi.data(), query, coshThreshold, ids, result};
+	switch (vectorization) {
+#ifdef NETWORKIT_X86_KERNELS
+	case Vectorization::AVX512:
+		filterAVX512(args, begin, end);
+		break;
+	case Vectorization::AVX2:
+		filterAVX2(args, begin, end);
+		break;
+#endif
+	default:
+		filterScalar(args, begin, end);
+	}
+}
+
+} /* namespace NetworKit */
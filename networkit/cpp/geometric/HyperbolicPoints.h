@@ -0,0 +1,130 @@
+/*
+ * HyperbolicPoints.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef HYPERBOLICPOINTS_H_
+#define HYPERBOLICPOINTS_H_
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "../Globals.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup geometric
+ * Points in native hyperbolic polar coordinates as structure of arrays, stored with the terms of
+ * the hyperbolic law of cosines
+ *   cosh(dist(p, q)) = cosh r_p cosh r_q - sinh r_p sinh r_q (cos phi_p cos phi_q + sin phi_p sin phi_q),
+ * so that distances to many points are computed without evaluating transcendental functions per point.
+ * Batches of points are compared against a distance threshold with AVX-512 or AVX2 if the processor
+ * supports it, the implementation is selected at runtime; all implementations return the same points.
+ */
+class HyperbolicPoints {
+public:
+	/**
+	 * Query point with the precomputed terms of its coordinates.
+	 */
+	struct Query {
+		double coshR, sinhR, cosPhi, sinPhi;
+
+		Query(double phi, double r) : coshR(std::cosh(r)), sinhR(std::sinh(r)), cosPhi(std::cos(phi)), sinPhi(std::sin(phi)) {
+		}
+	};
+
+	enum class Vectorization {
+		SCALAR, AVX2, AVX512
+	};
+
+	/**
+	 * @return The fastest implementation of filterByDistance supported by this processor.
+	 */
+	static Vectorization bestVectorization();
+
+	void push_back(double phi, double r) {
+		coshR.push_back(std::cosh(r));
+		sinhR.push_back(std::sinh(r));
+		cosPhi.push_back(std::cos(phi));
+		sinPhi.push_back(std::sin(phi));
+	}
+
+	void reserve(count n) {
+		coshR.reserve(n);
+		sinhR.reserve(n);
+		cosPhi.reserve(n);
+		sinPhi.reserve(n);
+	}
+
+	void resize(count n) {
+		coshR.resize(n);
+		sinhR.resize(n);
+		cosPhi.resize(n);
+		sinPhi.resize(n);
+	}
+
+	/**
+	 * Replaces point @a k by the point (@a phi, @a r).
+	 */
+	void set(index k, double phi, double r) {
+		coshR[k] = std::cosh(r);
+		sinhR[k] = std::sinh(r);
+		cosPhi[k] = std::cos(phi);
+		sinPhi[k] = std::sin(phi);
+	}
+
+	/**
+	 * Replaces point @a to by point @a from, without evaluating transcendental functions.
+	 */
+	void copy(index from, index to) {
+		coshR[to] = coshR[from];
+		sinhR[to] = sinhR[from];
+		cosPhi[to] = cosPhi[from];
+		sinPhi[to] = sinPhi[from];
+	}
+
+	void clear() {
+		coshR.clear();
+		sinhR.clear();
+		cosPhi.clear();
+		sinPhi.clear();
+	}
+
+	count size() const {
+		return coshR.size();
+	}
+
+	/**
+	 * @return cosh of the hyperbolic distance between point @a k and @a query.
+	 */
+	double coshDistance(index k, const Query &query) const {
+		return coshR[k] * query.coshR - sinhR[k] * query.sinhR * (cosPhi[k] * query.cosPhi + sinPhi[k] * query.sinPhi);
+	}
+
+	/**
+	 * @return Hyperbolic distance between point @a k and @a query.
+	 */
+	double distance(index k, const Query &query) const {
+		// rounding can push the cosh of tiny distances below 1
+		return std::acosh(std::max(coshDistance(k, query), 1.0));
+	}
+
+	/**
+	 * Appends ids[k] to @a result for every point k in [@a begin, @a end) whose hyperbolic distance to
+	 * @a query is at most the distance whose cosh is @a coshThreshold.
+	 */
+	void filterByDistance(index begin, index end, const Query &query, double coshThreshold, const index *ids, std::vector<index> &result,
+			Vectorization vectorization = bestVectorization()) const;
+
+private:
+	std::vector<double> coshR;
+	std::vector<double> sinhR;
+	std::vector<double> cosPhi;
+	std::vector<double> sinPhi;
+};
+
+} /* namespace NetworKit */
+#endif /* HYPERBOLICPOINTS_H_ */
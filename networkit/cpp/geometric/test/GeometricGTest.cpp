@@ -12,6 +12,7 @@
 #include "../../auxiliary/Log.h"
 #include "../../auxiliary/Random.h"
 #include "../HyperbolicSpace.h"
+#include "../HyperbolicPoints.h"
 #include "../Point2D.h"
 
 namespace NetworKit {
@@ -85,4 +86,58 @@ TEST_F(GeometricGTest, testHyperbolicTargetRadius) {
 	EXPECT_NEAR(R,167.08503,1e-4);
 }
 
+/**
+ * the batch distance kernels agree with each other and with the native distance
+ */
+TEST_F(GeometricGTest, testHyperbolicPointsDistanceKernel) {
+	count n = 1003;
+	double R = 10;
+	vector<double> angles(n);
+	vector<double> radii(n);
+	HyperbolicSpace::fillPoints(angles, radii, R, 1);
+	HyperbolicPoints points;
+	vector<index> ids(n);
+	for (index i = 0; i < n; i++) {
+		points.push_back(angles[i], radii[i]);
+		ids[i] = 2*i;
+	}
+	EXPECT_EQ(n, points.size());
+
+	vector<HyperbolicPoints::Vectorization> vectorizations = {HyperbolicPoints::Vectorization::SCALAR};
+	if (HyperbolicPoints::bestVectorization() != HyperbolicPoints::Vectorization::SCALAR) {
+		vectorizations.push_back(HyperbolicPoints::Vectorization::AVX2);
+	}
+	if (HyperbolicPoints::bestVectorization() == HyperbolicPoints::Vectorization::AVX512) {
+		vectorizations.push_back(HyperbolicPoints::Vectorization::AVX512);
+	}
+
+	for (index q = 0; q < 20; q++) {
+		HyperbolicPoints::Query query(angles[q], radii[q]);
+		// ranges of all lengths modulo the vector widths
+		index begin = q;
+		index end = n - q / 2;
+		vector<index> expected;
+		points.filterByDistance(begin, end, query, std::cosh(R), ids.data(), expected, HyperbolicPoints::Vectorization::SCALAR);
+		for (auto vectorization : vectorizations) {
+			vector<index> result;
+			points.filterByDistance(begin, end, query, std::cosh(R), ids.data(), result, vectorization);
+			EXPECT_EQ(expected, result);
+		}
+
+		index found = 0;
+		for (index k = begin; k < end; k++) {
+			double distance = HyperbolicSpace::nativeDistance(angles[q], radii[q], angles[k], radii[k]);
+			// acosh is ill-conditioned close to 1, so compare the cosh relative to the magnitude of its terms
+			EXPECT_NEAR(std::cosh(distance), points.coshDistance(k, query), 1e-12 * std::cosh(radii[q]) * std::cosh(radii[k]));
+			if (found < expected.size() && expected[found] == ids[k]) {
+				EXPECT_LE(distance, R + 1e-6);
+				found++;
+			} else {
+				EXPECT_GE(distance, R - 1e-6);
+			}
+		}
+		EXPECT_EQ(expected.size(), found);
+	}
+}
+
 } /* namespace NetworKit */
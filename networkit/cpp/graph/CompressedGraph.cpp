@@ -0,0 +1,204 @@
+/*
+ * CompressedGraph.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include <algorithm>
+#include <utility>
+#include <omp.h>
+
+#include "CompressedGraph.h"
+
+namespace NetworKit {
+
+namespace {
+
+count varintLength(uint64_t x) {
+	count length = 1;
+	while (x >= 0x80) {
+		x >>= 7;
+		++length;
+	}
+	return length;
+}
+
+uint8_t* writeVarint(uint8_t* pos, uint64_t x) {
+	while (x >= 0x80) {
+		*pos++ = static_cast<uint8_t>(x | 0x80);
+		x >>= 7;
+	}
+	*pos++ = static_cast<uint8_t>(x);
+	return pos;
+}
+
+uint64_t zigzag(node v, node u) {
+	const int64_t delta = static_cast<int64_t>(v) - static_cast<int64_t>(u); // v - u would wrap for 32 bit node ids
+	return (static_cast<uint64_t>(delta) << 1) ^ static_cast<uint64_t>(delta >> 63);
+}
+
+} // namespace
+
+CompressedGraph::CompressedGraph() :
+	name(""),
+	n(0),
+	m(0),
+	storedNumberOfSelfLoops(0),
+	z(0),
+	weighted(false),
+	directed(false) {
+	out.offsets.assign(1, 0);
+}
+
+CompressedGraph::CompressedGraph(const Graph& G) :
+	name(G.getName()),
+	n(G.numberOfNodes()),
+	m(G.numberOfEdges()),
+	storedNumberOfSelfLoops(G.numberOfSelfLoops()),
+	z(G.upperNodeIdBound()),
+	weighted(G.isWeighted()),
+	directed(G.isDirected()),
+	exists(G.upperNodeIdBound(), false) {
+
+	G.forNodes([&](node u) {
+		exists[u] = true;
+	});
+
+	compress(G, false, out);
+	if (directed) {
+		compress(G, true, in);
+	}
+}
+
+void CompressedGraph::compress(const Graph& G, bool incoming, Adjacency& adjacency) {
+	adjacency.offsets.assign(z + 1, 0);
+	if (weighted) {
+		adjacency.weightOffsets.assign(z + 1, 0);
+	}
+
+	// first pass: sort every list and compute the length of its encoding
+	std::vector<std::vector<std::pair<node, edgeweight>>> buffers(omp_get_max_threads());
+	auto sortedList = [&](node u) -> std::vector<std::pair<node, edgeweight>>& {
+		auto& list = buffers[omp_get_thread_num()];
+		list.clear();
+		auto collect = [&](node, node v, edgeweight ew) {
+			list.emplace_back(v, ew);
+		};
+		if (incoming) {
+			G.forInEdgesOf(u, collect);
+		} else {
+			G.forEdgesOf(u, collect);
+		}
+		std::sort(list.begin(), list.end());
+		return list;
+	};
+
+	#pragma omp parallel for schedule(guided)
+	for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+		if (!exists[u]) {
+			adjacency.offsets[u + 1] = varintLength(0);
+			continue;
+		}
+		const auto& list = sortedList(u);
+		count length = varintLength(list.size());
+		for (index i = 0; i < list.size(); ++i) {
+			length += varintLength(i == 0 ? zigzag(list[0].first, u) : list[i].first - list[i - 1].first);
+		}
+		adjacency.offsets[u + 1] = length;
+		if (weighted) {
+			adjacency.weightOffsets[u + 1] = list.size();
+		}
+	}
+
+	for (node u = 0; u < z; ++u) {
+		adjacency.offsets[u + 1] += adjacency.offsets[u];
+		if (weighted) {
+			adjacency.weightOffsets[u + 1] += adjacency.weightOffsets[u];
+		}
+	}
+
+	adjacency.bytes.resize(adjacency.offsets[z]);
+	adjacency.weights.resize(weighted ? adjacency.weightOffsets[z] : 0);
+
+	// second pass: encode the lists at their offsets
+	#pragma omp parallel for schedule(guided)
+	for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+		uint8_t* pos = adjacency.bytes.data() + adjacency.offsets[u];
+		if (!exists[u]) {
+			writeVarint(pos, 0);
+			continue;
+		}
+		const auto& list = sortedList(u);
+		pos = writeVarint(pos, list.size());
+		for (index i = 0; i < list.size(); ++i) {
+			pos = writeVarint(pos, i == 0 ? zigzag(list[0].first, u) : list[i].first - list[i - 1].first);
+			if (weighted) {
+				adjacency.weights[adjacency.weightOffsets[u] + i] = list[i].second;
+			}
+		}
+		assert(pos == adjacency.bytes.data() + adjacency.offsets[u + 1]);
+	}
+}
+
+Graph CompressedGraph::toGraph() const {
+	Graph G(z, weighted, directed);
+	for (node u = 0; u < z; ++u) {
+		if (!exists[u]) {
+			G.removeNode(u);
+		}
+	}
+	forEdges([&](node u, node v, edgeweight ew) {
+		G.addEdge(u, v, ew);
+	});
+	if (name != "") {
+		G.setName(name);
+	}
+	return G;
+}
+
+bool CompressedGraph::hasEdge(node u, node v) const {
+	if (!hasNode(u) || !hasNode(v)) {
+		return false;
+	}
+	const uint8_t* pos = out.bytes.data() + out.offsets[u];
+	const count deg = readVarint(pos);
+	if (deg == 0) {
+		return false;
+	}
+	const uint64_t first = readVarint(pos);
+	node w = u + ((first >> 1) ^ (~(first & 1) + 1));
+	for (index i = 1; w < v && i < deg; ++i) {
+		w += readVarint(pos);
+	}
+	return w == v;
+}
+
+edgeweight CompressedGraph::weightedDegree(node v) const {
+	if (!weighted) {
+		return degree(v) * defaultEdgeWeight;
+	}
+	edgeweight sum = 0.0;
+	for (index i = out.weightOffsets[v]; i < out.weightOffsets[v + 1]; ++i) {
+		sum += out.weights[i];
+	}
+	return sum;
+}
+
+edgeweight CompressedGraph::totalEdgeWeight() const {
+	if (!weighted) {
+		return m * defaultEdgeWeight;
+	}
+	return parallelSumForEdges([](node, node, edgeweight ew) {
+		return ew;
+	});
+}
+
+count CompressedGraph::memoryUsage() const {
+	return sizeof(uint64_t) * (out.offsets.size() + in.offsets.size())
+		+ out.bytes.size() + in.bytes.size()
+		+ sizeof(index) * (out.weightOffsets.size() + in.weightOffsets.size())
+		+ sizeof(edgeweight) * (out.weights.size() + in.weights.size())
+		+ exists.size() / 8;
+}
+
+} /* namespace NetworKit */
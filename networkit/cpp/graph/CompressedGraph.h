@@ -0,0 +1,462 @@
+/*
+ * CompressedGraph.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef COMPRESSED_GRAPH_H_
+#define COMPRESSED_GRAPH_H_
+
+#include <cstdint>
+#include <queue>
+#include <string>
+#include <vector>
+
+#include "../Globals.h"
+#include "Graph.h"
+#include "EdgeLambda.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup graph
+ * An immutable snapshot of a Graph whose adjacency lists are compressed with gap and varint encoding.
+ *
+ * The neighbors of every node are sorted, and the neighbors of u are stored in a byte array as the
+ * degree of u, the difference between the first neighbor and u (zigzag encoded, as it may be negative)
+ * and the gaps between consecutive neighbors, each as a varint of 7 bits per byte. For graphs with
+ * local neighborhoods, e.g. web and social graphs with a locality preserving node order, most gaps take
+ * a single byte instead of the 8 bytes of a node id. The lists are decoded on the fly by the iterators,
+ * which accept the same lambdas as the corresponding methods of Graph and StaticGraph, so template code
+ * written against the iterator interface of Graph runs unchanged on a CompressedGraph.
+ *
+ * Unlike StaticGraph, the neighbors are visited in increasing order of their ids and edge ids are not
+ * stored. Edge weights are stored uncompressed in the order of the neighbors. For directed graphs the
+ * incoming edges are stored in a second compressed structure.
+ */
+class CompressedGraph final {
+
+private:
+	/**
+	 * One compressed adjacency structure, see the class description.
+	 */
+	struct Adjacency {
+		std::vector<uint64_t> offsets; //!< the list of u is stored from bytes[offsets[u]] on
+		std::vector<uint8_t> bytes;
+		std::vector<index> weightOffsets; //!< only used for weighted graphs, weights of u start at weights[weightOffsets[u]]
+		std::vector<edgeweight> weights;
+	};
+
+	std::string name;
+
+	count n; //!< number of nodes
+	count m; //!< number of edges
+	count storedNumberOfSelfLoops; //!< number of self loops
+	node z; //!< upper bound of node ids
+
+	bool weighted;
+	bool directed;
+
+	std::vector<bool> exists; //!< exists[v] is true if node v exists
+
+	Adjacency out;
+	Adjacency in; //!< only used for directed graphs
+
+	static inline uint64_t readVarint(const uint8_t*& pos);
+
+	template<bool hasWeights>
+	static inline edgeweight getWeight(const Adjacency& adjacency, index i);
+
+	template<bool graphIsDirected, bool hasWeights, typename L>
+	inline void forAdjacentImpl(const Adjacency& adjacency, node u, L handle) const;
+
+	template<bool graphIsDirected, bool hasWeights, typename L>
+	inline void forEdgeImpl(L handle) const;
+
+	template<bool graphIsDirected, bool hasWeights, typename L>
+	inline void parallelForEdgesImpl(L handle) const;
+
+	template<bool graphIsDirected, bool hasWeights, typename L>
+	inline double parallelSumForEdgesImpl(L handle) const;
+
+	/**
+	 * Fills @a adjacency with the outgoing (or incoming if @a incoming is set) edges of @a G.
+	 */
+	void compress(const Graph& G, bool incoming, Adjacency& adjacency);
+
+public:
+
+	/**
+	 * Creates an empty compressed graph.
+	 */
+	CompressedGraph();
+
+	/**
+	 * Creates a compressed snapshot of @a G. The lists are sorted and encoded in parallel.
+	 *
+	 * @param G The graph to compress.
+	 */
+	explicit CompressedGraph(const Graph& G);
+
+	/**
+	 * Converts the snapshot back to a (mutable) Graph with sorted adjacency lists.
+	 */
+	Graph toGraph() const;
+
+	/** GRAPH INFORMATION **/
+
+	std::string getName() const { return name; }
+
+	bool isWeighted() const { return weighted; }
+
+	bool isDirected() const { return directed; }
+
+	/**
+	 * Edge ids are not stored, so algorithms that need them, e.g. edge centralities, reject a CompressedGraph.
+	 */
+	bool hasEdgeIds() const { return false; }
+
+	bool isEmpty() const { return n == 0; }
+
+	count numberOfNodes() const { return n; }
+
+	count numberOfEdges() const { return m; }
+
+	count numberOfSelfLoops() const { return storedNumberOfSelfLoops; }
+
+	index upperNodeIdBound() const { return z; }
+
+	bool hasNode(node v) const { return (v < z) && exists[v]; }
+
+	/**
+	 * Checks if edge (@a u, @a v) exists. Running time is O(deg(u)), the search stops at the
+	 * first neighbor larger than @a v.
+	 */
+	bool hasEdge(node u, node v) const;
+
+	/**
+	 * Returns the number of outgoing neighbors of @a v.
+	 */
+	count degree(node v) const {
+		const uint8_t* pos = out.bytes.data() + out.offsets[v];
+		return readVarint(pos);
+	}
+
+	/**
+	 * Returns the number of incoming neighbors of @a v (outgoing for undirected graphs).
+	 */
+	count degreeIn(node v) const {
+		if (!directed) return degree(v);
+		const uint8_t* pos = in.bytes.data() + in.offsets[v];
+		return readVarint(pos);
+	}
+
+	count degreeOut(node v) const { return degree(v); }
+
+	bool isIsolated(node v) const { return degree(v) == 0 && (!directed || degreeIn(v) == 0); }
+
+	/**
+	 * Returns the weighted degree of @a v, for directed graphs only outgoing edges count.
+	 */
+	edgeweight weightedDegree(node v) const;
+
+	/**
+	 * Returns the sum of all edge weights.
+	 */
+	edgeweight totalEdgeWeight() const;
+
+	/**
+	 * Returns the number of bytes occupied by the adjacency structure.
+	 */
+	count memoryUsage() const;
+
+	/* NODE ITERATORS */
+
+	template<typename L> void forNodes(L handle) const;
+
+	template<typename L> void parallelForNodes(L handle) const;
+
+	template<typename L> void balancedParallelForNodes(L handle) const;
+
+	/* EDGE ITERATORS */
+
+	/**
+	 * Iterate over all edges and call @a handle (lambda closure), @see Graph::forEdges.
+	 */
+	template<typename L> void forEdges(L handle) const;
+
+	/**
+	 * Iterate in parallel over all edges and call @a handle (lambda closure), @see Graph::parallelForEdges.
+	 */
+	template<typename L> void parallelForEdges(L handle) const;
+
+	/* NEIGHBORHOOD ITERATORS */
+
+	/**
+	 * Iterate over all (outgoing) neighbors of @a u in increasing order, @see Graph::forNeighborsOf.
+	 */
+	template<typename L> void forNeighborsOf(node u, L handle) const;
+
+	template<typename L> void forEdgesOf(node u, L handle) const;
+
+	/**
+	 * Iterate over all incoming neighbors of @a u in increasing order, @see Graph::forInNeighborsOf.
+	 */
+	template<typename L> void forInNeighborsOf(node u, L handle) const;
+
+	template<typename L> void forInEdgesOf(node u, L handle) const;
+
+	/* REDUCTION ITERATORS */
+
+	template<typename L> double parallelSumForNodes(L handle) const;
+
+	template<typename L> double parallelSumForEdges(L handle) const;
+
+	/* GRAPH SEARCHES */
+
+	/**
+	 * Iterate over nodes in breadth-first search order starting from r, @see Graph::BFSfrom.
+	 */
+	template<typename L> void BFSfrom(node r, L handle) const;
+};
+
+/* NODE ITERATORS */
+
+template<typename L>
+void CompressedGraph::forNodes(L handle) const {
+	for (node v = 0; v < z; ++v) {
+		if (exists[v]) {
+			handle(v);
+		}
+	}
+}
+
+template<typename L>
+void CompressedGraph::parallelForNodes(L handle) const {
+	#pragma omp parallel for
+	for (omp_index v = 0; v < static_cast<omp_index>(z); ++v) {
+		if (exists[v]) {
+			handle(v);
+		}
+	}
+}
+
+template<typename L>
+void CompressedGraph::balancedParallelForNodes(L handle) const {
+	#pragma omp parallel for schedule(guided)
+	for (omp_index v = 0; v < static_cast<omp_index>(z); ++v) {
+		if (exists[v]) {
+			handle(v);
+		}
+	}
+}
+
+/* HELPERS */
+
+inline uint64_t CompressedGraph::readVarint(const uint8_t*& pos) {
+	uint64_t value = 0;
+	unsigned shift = 0;
+	uint8_t byte;
+	do {
+		byte = *pos++;
+		value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+		shift += 7;
+	} while (byte & 0x80);
+	return value;
+}
+
+template<bool hasWeights>
+inline edgeweight CompressedGraph::getWeight(const Adjacency& adjacency, index i) {
+	return adjacency.weights[i];
+}
+
+template<>
+inline edgeweight CompressedGraph::getWeight<false>(const Adjacency&, index) {
+	return defaultEdgeWeight;
+}
+
+template<bool graphIsDirected, bool hasWeights, typename L>
+inline void CompressedGraph::forAdjacentImpl(const Adjacency& adjacency, node u, L handle) const {
+	const uint8_t* pos = adjacency.bytes.data() + adjacency.offsets[u];
+	const count deg = readVarint(pos);
+	if (deg == 0) return;
+	const index firstWeight = hasWeights ? adjacency.weightOffsets[u] : 0;
+
+	const uint64_t first = readVarint(pos);
+	// zigzag decoding of v - u
+	node v = u + ((first >> 1) ^ (~(first & 1) + 1));
+	for (index i = 0; ; ) {
+		// undirected, do not iterate over edges twice; the neighbors are sorted
+		if (!graphIsDirected && v > u) break;
+		GraphDetails::edgeLambda<L>(handle, u, v, getWeight<hasWeights>(adjacency, firstWeight + i), 0);
+		if (++i == deg) break;
+		v += readVarint(pos);
+	}
+}
+
+template<bool graphIsDirected, bool hasWeights, typename L>
+inline void CompressedGraph::forEdgeImpl(L handle) const {
+	for (node u = 0; u < z; ++u) {
+		forAdjacentImpl<graphIsDirected, hasWeights, L>(out, u, handle);
+	}
+}
+
+template<bool graphIsDirected, bool hasWeights, typename L>
+inline void CompressedGraph::parallelForEdgesImpl(L handle) const {
+	#pragma omp parallel for schedule(guided)
+	for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+		forAdjacentImpl<graphIsDirected, hasWeights, L>(out, u, handle);
+	}
+}
+
+template<bool graphIsDirected, bool hasWeights, typename L>
+inline double CompressedGraph::parallelSumForEdgesImpl(L handle) const {
+	double sum = 0.0;
+
+	#pragma omp parallel for reduction(+:sum)
+	for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+		forAdjacentImpl<graphIsDirected, hasWeights>(out, u, [&](node u, node v, edgeweight ew) {
+			sum += GraphDetails::edgeLambda<L>(handle, u, v, ew, 0);
+		});
+	}
+
+	return sum;
+}
+
+/* EDGE ITERATORS */
+
+template<typename L>
+void CompressedGraph::forEdges(L handle) const {
+	switch (weighted + 2 * directed) {
+	case 0: // unweighted, undirected
+		forEdgeImpl<false, false, L>(handle);
+		break;
+
+	case 1: // weighted,   undirected
+		forEdgeImpl<false, true, L>(handle);
+		break;
+
+	case 2: // unweighted, directed
+		forEdgeImpl<true, false, L>(handle);
+		break;
+
+	case 3: // weighted,   directed
+		forEdgeImpl<true, true, L>(handle);
+		break;
+	}
+}
+
+template<typename L>
+void CompressedGraph::parallelForEdges(L handle) const {
+	switch (weighted + 2 * directed) {
+	case 0: // unweighted, undirected
+		parallelForEdgesImpl<false, false, L>(handle);
+		break;
+
+	case 1: // weighted,   undirected
+		parallelForEdgesImpl<false, true, L>(handle);
+		break;
+
+	case 2: // unweighted, directed
+		parallelForEdgesImpl<true, false, L>(handle);
+		break;
+
+	case 3: // weighted,   directed
+		parallelForEdgesImpl<true, true, L>(handle);
+		break;
+	}
+}
+
+/* NEIGHBORHOOD ITERATORS */
+
+template<typename L>
+void CompressedGraph::forNeighborsOf(node u, L handle) const {
+	forEdgesOf(u, handle);
+}
+
+template<typename L>
+void CompressedGraph::forEdgesOf(node u, L handle) const {
+	if (weighted) {
+		forAdjacentImpl<true, true, L>(out, u, handle);
+	} else {
+		forAdjacentImpl<true, false, L>(out, u, handle);
+	}
+}
+
+template<typename L>
+void CompressedGraph::forInNeighborsOf(node u, L handle) const {
+	forInEdgesOf(u, handle);
+}
+
+template<typename L>
+void CompressedGraph::forInEdgesOf(node u, L handle) const {
+	const Adjacency& adjacency = directed ? in : out;
+	if (weighted) {
+		forAdjacentImpl<true, true, L>(adjacency, u, handle);
+	} else {
+		forAdjacentImpl<true, false, L>(adjacency, u, handle);
+	}
+}
+
+/* REDUCTION ITERATORS */
+
+template<typename L>
+double CompressedGraph::parallelSumForNodes(L handle) const {
+	double sum = 0.0;
+
+	#pragma omp parallel for reduction(+:sum)
+	for (omp_index v = 0; v < static_cast<omp_index>(z); ++v) {
+		if (exists[v]) {
+			sum += handle(v);
+		}
+	}
+
+	return sum;
+}
+
+template<typename L>
+double CompressedGraph::parallelSumForEdges(L handle) const {
+	switch (weighted + 2 * directed) {
+	case 0: // unweighted, undirected
+		return parallelSumForEdgesImpl<false, false, L>(handle);
+
+	case 1: // weighted,   undirected
+		return parallelSumForEdgesImpl<false, true, L>(handle);
+
+	case 2: // unweighted, directed
+		return parallelSumForEdgesImpl<true, false, L>(handle);
+
+	default: // weighted,   directed
+		return parallelSumForEdgesImpl<true, true, L>(handle);
+	}
+}
+
+/* GRAPH SEARCHES */
+
+template<typename L>
+void CompressedGraph::BFSfrom(node r, L handle) const {
+	std::vector<bool> marked(z);
+	std::queue<node> q, qNext;
+	count dist = 0;
+	q.push(r);
+	marked[r] = true;
+	do {
+		node u = q.front();
+		q.pop();
+		GraphDetails::callBFSHandle(handle, u, dist);
+		forNeighborsOf(u, [&](node v) {
+			if (!marked[v]) {
+				qNext.push(v);
+				marked[v] = true;
+			}
+		});
+		if (q.empty() && !qNext.empty()) {
+			q.swap(qNext);
+			++dist;
+		}
+	} while (!q.empty());
+}
+
+} /* namespace NetworKit */
+
+#endif /* COMPRESSED_GRAPH_H_ */
@@ -0,0 +1,185 @@
+/*
+ * DirectionOptimizingBFS.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include <algorithm>
+#include <omp.h>
+
+#include "DirectionOptimizingBFS.h"
+
+namespace NetworKit {
+
+DirectionOptimizingBFS::DirectionOptimizingBFS(const Graph& G, double alpha, double beta) :
+	G(G),
+	alpha(alpha),
+	beta(beta),
+	distances(G.upperNodeIdBound(), none),
+	reached(0),
+	bottomUpSteps(0),
+	frontier(0),
+	visited(G.upperNodeIdBound()),
+	front(visited.numberOfWords()),
+	next(visited.numberOfWords()) {
+}
+
+void DirectionOptimizingBFS::run(node source) {
+	run(std::vector<node>(1, source));
+}
+
+void DirectionOptimizingBFS::run(const std::vector<node>& sources) {
+	const count z = G.upperNodeIdBound();
+
+	// non-existing nodes are marked as visited so that bottom-up steps skip them
+	#pragma omp parallel for
+	for (omp_index w = 0; w < static_cast<omp_index>(visited.numberOfWords()); ++w) {
+		uint64_t skip = 0;
+		for (index b = 0; b < 64; ++b) {
+			node v = 64 * w + b;
+			if (v >= z) {
+				skip |= uint64_t(1) << b;
+			} else {
+				distances[v] = none;
+				if (!G.hasNode(v)) {
+					skip |= uint64_t(1) << b;
+				}
+			}
+		}
+		visited.storeWord(w, skip);
+	}
+
+	frontier.setNumberOfThreads(omp_get_max_threads());
+	levelSizes.clear();
+	bottomUpSteps = 0;
+	frontier.current().clear();
+
+	count scout = 0; // number of edges to check from the frontier
+	for (node s : sources) {
+		if (visited.claim(s)) {
+			distances[s] = 0;
+			frontier.current().push_back(s);
+			scout += G.degreeOut(s);
+		}
+	}
+	levelSizes.push_back(frontier.current().size());
+
+	count edgesToCheck = G.isDirected() ? G.numberOfEdges() : 2 * G.numberOfEdges();
+	count level = 0;
+	while (!frontier.empty()) {
+		if (scout > edgesToCheck / alpha) {
+			queueToBitmap();
+			count awake = frontier.current().size();
+			count oldAwake;
+			// stay bottom-up while the frontier grows or is still large
+			do {
+				oldAwake = awake;
+				awake = bottomUpStep(level);
+				++level;
+				++bottomUpSteps;
+				if (awake > 0) {
+					levelSizes.push_back(awake);
+				}
+				std::swap(front, next);
+			} while (awake >= oldAwake || awake > G.numberOfNodes() / beta);
+			bitmapToQueue();
+			scout = 1;
+		} else {
+			edgesToCheck = scout > edgesToCheck ? 0 : edgesToCheck - scout;
+			scout = topDownStep(level);
+			++level;
+			if (!frontier.empty()) {
+				levelSizes.push_back(frontier.current().size());
+			}
+		}
+	}
+
+	reached = 0;
+	for (count size : levelSizes) {
+		reached += size;
+	}
+}
+
+count DirectionOptimizingBFS::topDownStep(count level) {
+	count scout = 0;
+	const std::vector<node>& current = frontier.current();
+	#pragma omp parallel for schedule(dynamic, 64) reduction(+:scout)
+	for (omp_index i = 0; i < static_cast<omp_index>(current.size()); ++i) {
+		G.forNeighborsOf(current[i], [&](node v) {
+			if (visited.claim(v)) {
+				distances[v] = level + 1;
+				frontier.push(v);
+				scout += G.degreeOut(v);
+			}
+		});
+	}
+
+	frontier.advance();
+	return scout;
+}
+
+count DirectionOptimizingBFS::bottomUpStep(count level) {
+	count awake = 0;
+	#pragma omp parallel for schedule(dynamic, 64) reduction(+:awake)
+	for (omp_index w = 0; w < static_cast<omp_index>(visited.numberOfWords()); ++w) {
+		// the thread owns word w of visited and next, so no atomic read-modify-write is needed
+		const uint64_t visitedWord = visited.loadWord(w);
+		uint64_t nextWord = 0;
+		if (~visitedWord) {
+			for (index b = 0; b < 64; ++b) {
+				const uint64_t bit = uint64_t(1) << b;
+				if (visitedWord & bit) {
+					continue;
+				}
+				const node v = 64 * w + b;
+				bool found = false;
+				G.forInNeighborsOfWhile(v, [&]() {
+					return !found;
+				}, [&](node u) {
+					found = (front[u / 64] >> (u % 64)) & 1;
+				});
+				if (found) {
+					distances[v] = level + 1;
+					nextWord |= bit;
+					++awake;
+				}
+			}
+			visited.storeWord(w, visitedWord | nextWord);
+		}
+		next[w] = nextWord;
+	}
+	return awake;
+}
+
+void DirectionOptimizingBFS::queueToBitmap() {
+	std::fill(front.begin(), front.end(), 0);
+	for (node u : frontier.current()) {
+		front[u / 64] |= uint64_t(1) << (u % 64);
+	}
+}
+
+void DirectionOptimizingBFS::bitmapToQueue() {
+	std::vector<node>& current = frontier.current();
+	current.clear();
+	for (index w = 0; w < front.size(); ++w) {
+		for (uint64_t word = front[w]; word != 0; word &= word - 1) {
+			index b = 0;
+			while (!((word >> b) & 1)) {
+				++b;
+			}
+			current.push_back(64 * w + b);
+		}
+	}
+}
+
+node DirectionOptimizingBFS::farthestNode() const {
+	const count maxDist = maxDistance();
+	for (node v = 0; v < distances.size(); ++v) {
+		if (distances[v] == maxDist) {
+			return v;
+		}
+	}
+	return none;
+}
+
+} /* namespace NetworKit */
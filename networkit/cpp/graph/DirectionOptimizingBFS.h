@@ -0,0 +1,119 @@
+/*
+ * DirectionOptimizingBFS.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef DIRECTIONOPTIMIZINGBFS_H_
+#define DIRECTIONOPTIMIZINGBFS_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "Graph.h"
+#include "../auxiliary/AtomicBitmap.h"
+#include "../auxiliary/ConcurrentWorklist.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup graph
+ * Parallel level-synchronous breadth-first search that switches between top-down steps
+ * (expanding the frontier) and bottom-up steps (unvisited nodes look for a parent in the
+ * frontier) as proposed by Beamer, Asanovic and Patterson, "Direction-Optimizing
+ * Breadth-First Search", SC 2012. Bottom-up steps work on bitmaps and each thread owns
+ * whole words of them, so they need no atomic operations.
+ *
+ * Only distances are computed. The object can be run repeatedly and keeps its memory.
+ */
+class DirectionOptimizingBFS {
+public:
+	/**
+	 * Prepares the search on @a G; @a G must not change while this object is used.
+	 *
+	 * @param G The graph.
+	 * @param alpha Switch to bottom-up once the frontier has more than 1/alpha of the edges of the unvisited nodes.
+	 * @param beta Switch back to top-down once the frontier shrinks below n/beta nodes.
+	 */
+	DirectionOptimizingBFS(const Graph& G, double alpha = 15.0, double beta = 18.0);
+
+	/**
+	 * Computes the distances from @a source.
+	 */
+	void run(node source);
+
+	/**
+	 * Computes the distances from the nearest of the nodes in @a sources.
+	 */
+	void run(const std::vector<node>& sources);
+
+	/**
+	 * @return Distance (number of edges) from the sources to @a v, none if @a v is unreachable.
+	 */
+	count distance(node v) const {
+		return distances[v];
+	}
+
+	/**
+	 * @return Distances of all nodes, none for unreachable nodes.
+	 */
+	const std::vector<count>& getDistances() const {
+		return distances;
+	}
+
+	/**
+	 * @return Number of nodes at distance i for each i, the size is the eccentricity of the sources plus one.
+	 */
+	const std::vector<count>& getLevelSizes() const {
+		return levelSizes;
+	}
+
+	/**
+	 * @return Largest distance of a reachable node.
+	 */
+	count maxDistance() const {
+		return levelSizes.size() - 1;
+	}
+
+	/**
+	 * @return A node at the largest distance.
+	 */
+	node farthestNode() const;
+
+	/**
+	 * @return Number of nodes reachable from the sources.
+	 */
+	count numberOfReachedNodes() const {
+		return reached;
+	}
+
+	/**
+	 * @return Number of bottom-up steps in the last run.
+	 */
+	count numberOfBottomUpSteps() const {
+		return bottomUpSteps;
+	}
+
+private:
+	const Graph& G;
+	const double alpha;
+	const double beta;
+
+	std::vector<count> distances;
+	std::vector<count> levelSizes;
+	count reached;
+	count bottomUpSteps;
+
+	Aux::ConcurrentWorklist<node> frontier; //!< frontier of top-down steps
+	Aux::AtomicBitmap visited; //!< bitmap of visited (or non-existing) nodes
+	std::vector<uint64_t> front; //!< frontier bitmap of bottom-up steps
+	std::vector<uint64_t> next;
+
+	count topDownStep(count level);
+	count bottomUpStep(count level);
+	void queueToBitmap();
+	void bitmapToQueue();
+};
+
+} /* namespace NetworKit */
+#endif /* DIRECTIONOPTIMIZINGBFS_H_ */
@@ -197,7 +197,7 @@ index Graph::indexInInEdgeArray(node v, node u) const {
 			return i;
 		}
 	}
-	return none;
+	return noneIndex;
 }
 
 index Graph::indexInOutEdgeArray(node u, node v) const {
@@ -207,7 +207,7 @@ index Graph::indexInOutEdgeArray(node u, node v) const {
 			return i;
 		}
 	}
-	return none;
+	return noneIndex;
 }
 
 
@@ -220,13 +220,13 @@ void Graph::indexEdges(bool force) {
 
 	outEdgeIds.resize(outEdges.size());
 	forNodes([&](node u) {
-		outEdgeIds[u].resize(outEdges[u].size(), none);
+		outEdgeIds[u].resize(outEdges[u].size(), noneIndex);
 	});
 
 	if (directed) {
 		inEdgeIds.resize(inEdges.size());
 		forNodes([&](node u) {
-			inEdgeIds[u].resize(inEdges[u].size(), none);
+			inEdgeIds[u].resize(inEdges[u].size(), noneIndex);
 		});
 	}
 
@@ -248,7 +248,7 @@ void Graph::indexEdges(bool force) {
 		balancedParallelForNodes([&](node u) {
 			for (index i = 0; i < outEdges[u].size(); ++i) {
 				node v = outEdges[u][i];
-				if (v != none && outEdgeIds[u][i] == none) {
+				if (v != none && outEdgeIds[u][i] == noneIndex) {
 					index j = indexInOutEdgeArray(v, u);
 					outEdgeIds[u][i] = outEdgeIds[v][j];
 				}
@@ -276,7 +276,7 @@ edgeid Graph::edgeId(node u, node v) const {
 	}
 	index i = indexInOutEdgeArray(u, v);
 
-	if (i == none) {
+	if (i == noneIndex) {
 		throw std::runtime_error("Edge does not exist");
 	}
 
@@ -659,7 +659,7 @@ void Graph::removeEdge(node u, node v) {
 	index vi = indexInOutEdgeArray(u, v);
 	index ui = indexInInEdgeArray(v, u);
 
-	if (vi == none) {
+	if (vi == noneIndex) {
 		std::stringstream strm;
 		strm << "edge (" << u << "," << v << ") does not exist";
 		throw std::runtime_error(strm.str());
@@ -673,7 +673,7 @@ void Graph::removeEdge(node u, node v) {
 	}
 
 	if (directed) {
-		assert (ui != none);
+		assert (ui != noneIndex);
 
 		inDeg[v]--;
 		inEdges[v][ui] = none;
@@ -730,11 +730,11 @@ void Graph::removeSelfLoops() {
 
 void Graph::swapEdge(node s1, node t1, node s2, node t2) {
 	index s1t1 = indexInOutEdgeArray(s1, t1);
-	if (s1t1 == none) throw std::runtime_error("The first edge does not exist");
+	if (s1t1 == noneIndex) throw std::runtime_error("The first edge does not exist");
 	index t1s1 = indexInInEdgeArray(t1, s1);
 
 	index s2t2 = indexInOutEdgeArray(s2, t2);
-	if (s2t2 == none) throw std::runtime_error("The second edge does not exist");
+	if (s2t2 == noneIndex) throw std::runtime_error("The second edge does not exist");
 	index t2s2 = indexInInEdgeArray(t2, s2);
 
 	std::swap(outEdges[s1][s1t1], outEdges[s2][s2t2]);
@@ -764,11 +764,11 @@ void Graph::swapEdge(node s1, node t1, node s2, node t2) {
 
 bool Graph::hasEdge(node u, node v) const {
 	if (!directed && outDeg[u] > outDeg[v]){
-		return indexInOutEdgeArray(v, u) != none;
+		return indexInOutEdgeArray(v, u) != noneIndex;
 	}else if (directed && outDeg[u] > inDeg[v]){
-		return indexInInEdgeArray(v, u) != none;
+		return indexInInEdgeArray(v, u) != noneIndex;
 	}else{
-		return indexInOutEdgeArray(u, v) != none;
+		return indexInOutEdgeArray(u, v) != noneIndex;
 	}
 }
 
@@ -832,7 +832,7 @@ count Graph::numberOfSelfLoops() const {
 
 edgeweight Graph::weight(node u, node v) const {
 	index vi = indexInOutEdgeArray(u, v);
-	if (vi == none) {
+	if (vi == noneIndex) {
 		return nullWeight;
 	} else {
 		return weighted ? outEdgeWeights[u][vi] : defaultEdgeWeight;
@@ -845,7 +845,7 @@ void Graph::setWeight(node u, node v, edgeweight ew) {
 	}
 
 	index vi = indexInOutEdgeArray(u, v);
-	if (vi == none) {
+	if (vi == noneIndex) {
 		// edge does not exist, create it, but warn user
 		TRACE("Setting edge weight of a nonexisting edge will create the edge.");
 		addEdge(u, v, ew);
@@ -868,7 +868,7 @@ void Graph::increaseWeight(node u, node v, edgeweight ew) {
 	}
 
 	index vi = indexInOutEdgeArray(u, v);
-	if (vi == none) {
+	if (vi == noneIndex) {
 		// edge does not exits, create it, but warn user
 		TRACE("Increasing edge weight of a nonexisting edge will create the edge.");
 		addEdge(u, v, ew);
@@ -22,6 +22,7 @@
 #include "../viz/Point.h"
 #include "../auxiliary/Random.h"
 #include "../auxiliary/FunctionTraits.h"
+#include "EdgeLambda.h"
 #include "../auxiliary/Log.h"
 
 namespace NetworKit {
@@ -83,6 +84,7 @@ class Graph final {
 
 	friend class ParallelPartitionCoarsening;
 	friend class GraphBuilder;
+	friend class NetworKitBinaryReader;
 	friend class CurveballDetails::CurveballMaterialization;
 
 private:
@@ -233,129 +235,6 @@ private:
 	template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
 	inline double parallelSumForEdgesImpl(L handle) const;
 
-	/*
-	 * In the following definition, Aux::FunctionTraits is used in order to only execute lambda functions
-	 * with the appropriate parameters. The decltype-return type is used for determining the return type of
-	 * the lambda (needed for summation) but also determines if the lambda accepts the correct number of parameters.
-	 * Otherwise the return type declaration fails and the function is excluded from overload resoluation.
-	 * Then there are multiple possible lambdas with three (third parameter id or weight) and two (second parameter
-	 * can be second node id or edge weight for neighbor iterators). This is checked using Aux::FunctionTraits and
-	 * std::enable_if. std::enable_if only defines the type member when the given bool is true, this bool comes from
-	 * std::is_same which compares two types. The function traits give either the parameter type or if it is out of bounds
-	 * they define type as void.
-	 */
-
-	/**
-	 * Triggers a static assert error when no other method is chosen. Because of the use of "..." as arguments, the priority
-	 * of this method is lower than the priority of the other methods. This method avoids ugly and unreadable template substitution
-	 * error messages from the other declarations.
-	 */
-	template<class F, void* = (void*)0>
-	typename Aux::FunctionTraits<F>::result_type edgeLambda(F&, ...) const {
-		// the strange condition is used in order to delay the eveluation of the static assert to the moment when this function is actually used
-		static_assert(! std::is_same<F, F>::value, "Your lambda does not support the required parameters or the parameters have the wrong type.");
-		return std::declval<typename Aux::FunctionTraits<F>::result_type>(); // use the correct return type (this won't compile)
-	}
-
-	/**
-	 * Calls the given function f if its fourth argument is of the type edgeid and third of type edgeweight
-	 * Note that the decltype check is not enough as edgeweight can be casted to node and we want to assure that .
-	 */
-	template < class F,
-	         typename std::enable_if <
-	         (Aux::FunctionTraits<F>::arity >= 3) &&
-	         std::is_same<edgeweight, typename Aux::FunctionTraits<F>::template arg<2>::type>::value &&
-	         std::is_same<edgeid, typename Aux::FunctionTraits<F>::template arg<3>::type>::value
-	         >::type * = (void*)0 >
-	auto edgeLambda(F &f, node u, node v, edgeweight ew, edgeid id) const -> decltype(f(u, v, ew, id)) {
-		return f(u, v, ew, id);
-	}
-
-
-	/**
-	 * Calls the given function f if its third argument is of the type edgeid, discards the edge weight
-	 * Note that the decltype check is not enough as edgeweight can be casted to node.
-	 */
-	template<class F,
-			 typename std::enable_if<
-			 (Aux::FunctionTraits<F>::arity >= 2) &&
-			 std::is_same<edgeid, typename Aux::FunctionTraits<F>::template arg<2>::type>::value &&
-			 std::is_same<node, typename Aux::FunctionTraits<F>::template arg<1>::type>::value /* prevent f(v, weight, eid) */
-			 >::type* = (void*)0>
-	auto edgeLambda(F&f, node u, node v, edgeweight, edgeid id) const -> decltype(f(u, v, id)) {
-		return f(u, v, id);
-	}
-
-	/**
-	 * Calls the given function f if its third argument is of type edgeweight, discards the edge id
-	 * Note that the decltype check is not enough as node can be casted to edgeweight.
-	 */
-	template<class F,
-			 typename std::enable_if<
-			 (Aux::FunctionTraits<F>::arity >= 2) &&
-			 std::is_same<edgeweight, typename Aux::FunctionTraits<F>::template arg<2>::type>::value
-			 >::type* = (void*)0>
-	auto edgeLambda(F&f, node u, node v, edgeweight ew, edgeid /*id*/) const -> decltype(f(u, v, ew)) {
-		return f(u, v, ew);
-	}
-
-
-	/**
-	 * Calls the given function f if it has only two arguments and the second argument is of type node,
-	 * discards edge weight and id
-	 * Note that the decltype check is not enough as edgeweight can be casted to node.
-	 */
-	template<class F,
-			 typename std::enable_if<
-			 (Aux::FunctionTraits<F>::arity >= 1) &&
-			 std::is_same<node, typename Aux::FunctionTraits<F>::template arg<1>::type>::value
-			 >::type* = (void*)0>
-	auto edgeLambda(F&f, node u, node v, edgeweight /*ew*/, edgeid /*id*/) const -> decltype(f(u, v)) {
-			return f(u, v);
-	}
-
-	/**
-	 * Calls the given function f if it has only two arguments and the second argument is of type edgeweight,
-	 * discards the first node and the edge id
-	 * Note that the decltype check is not enough as edgeweight can be casted to node.
-	 */
-	template<class F,
-			 typename std::enable_if<
-			 (Aux::FunctionTraits<F>::arity >= 1) &&
-			 std::is_same<edgeweight, typename Aux::FunctionTraits<F>::template arg<1>::type>::value
-			 >::type* = (void*)0>
-	auto edgeLambda(F&f, node u, node v, edgeweight ew, edgeid /*id*/) const -> decltype(f(u, ew)) {
-		return f(v, ew);
-	}
-
-
-	/**
-	 * Calls the given function f if it has only one argument, discards the first
-	 * node id, the edge weight and the edge id
-	 */
-	template<class F,
-			 void* = (void*)0>
-	auto edgeLambda(F&f, node, node v, edgeweight, edgeid) const -> decltype(f(v)) {
-		return f(v);
-	}
-
-
-	/**
-	 * Calls the given BFS handle with distance parameter
-	 */
-	template <class F>
-	auto callBFSHandle(F &f, node u, count dist) const -> decltype(f(u, dist)) {
-		return f(u, dist);
-	}
-
-	/**
-	 * Calls the given BFS handle without distance parameter
-	 */
-	template <class F>
-	auto callBFSHandle(F &f, node u, count) const -> decltype(f(u)) {
-		return f(u);
-	}
-
 public:
 
 	/**
@@ -1052,6 +931,15 @@ public:
 	 */
 	template<typename L> void forInNeighborsOf(node u, L handle) const;
 
+	/**
+	 * Iterate over all neighbors of a node and call @a handle (lambda closure) as long as @a condition remains true.
+	 * For directed graphs only incoming edges from u are considered.
+	 *
+	 * @param condition Returning <code>false</code> breaks the loop.
+	 * @param handle Takes parameter <code>(node)</code>.
+	 */
+	template<typename C, typename L> void forInNeighborsOfWhile(node u, C condition, L handle) const;
+
 	/**
 	 * Iterate over all incoming edges of a node and call handler (lamdba closure).
 	 * @note For undirected graphs all edges incident to u are also incoming edges.
@@ -1242,7 +1130,7 @@ inline void Graph::forOutEdgesOfImpl(node u, L handle) const {
 		node v = outEdges[u][i];
 
 		if (useEdgeInIteration<graphIsDirected>(u, v)) {
-			edgeLambda<L>(handle, u, v, getOutEdgeWeight<hasWeights>(u, i), getOutEdgeId<graphHasEdgeIds>(u, i));
+			GraphDetails::edgeLambda<L>(handle, u, v, getOutEdgeWeight<hasWeights>(u, i), getOutEdgeId<graphHasEdgeIds>(u, i));
 		}
 	}
 }
@@ -1254,7 +1142,7 @@ inline void Graph::forInEdgesOfImpl(node u, L handle) const {
 			node v = inEdges[u][i];
 
 			if (useEdgeInIteration<true>(u, v)) {
-				edgeLambda<L>(handle, u, v, getInEdgeWeight<hasWeights>(u, i), getInEdgeId<graphHasEdgeIds>(u, i));
+				GraphDetails::edgeLambda<L>(handle, u, v, getInEdgeWeight<hasWeights>(u, i), getInEdgeId<graphHasEdgeIds>(u, i));
 			}
 		}
 	} else {
@@ -1262,7 +1150,7 @@ inline void Graph::forInEdgesOfImpl(node u, L handle) const {
 			node v = outEdges[u][i];
 
 			if (useEdgeInIteration<true>(u, v)) {
-				edgeLambda<L>(handle, u, v, getOutEdgeWeight<hasWeights>(u, i), getOutEdgeId<graphHasEdgeIds>(u, i));
+				GraphDetails::edgeLambda<L>(handle, u, v, getOutEdgeWeight<hasWeights>(u, i), getOutEdgeId<graphHasEdgeIds>(u, i));
 			}
 		}
 	}
@@ -1295,7 +1183,7 @@ inline double Graph::parallelSumForEdgesImpl(L handle) const {
 			// undirected, do not iterate over edges twice
 			// {u, v} instead of (u, v); if v == none, u > v is not fulfilled
 			if (useEdgeInIteration<graphIsDirected>(u, v)) {
-				sum += edgeLambda<L>(handle, u, v, getOutEdgeWeight<hasWeights>(u, i), getOutEdgeId<graphHasEdgeIds>(u, i));
+				sum += GraphDetails::edgeLambda<L>(handle, u, v, getOutEdgeWeight<hasWeights>(u, i), getOutEdgeId<graphHasEdgeIds>(u, i));
 			}
 		}
 	}
@@ -1413,6 +1301,16 @@ void Graph::forInNeighborsOf(node u, L handle) const {
 	forInEdgesOf(u, handle);
 }
 
+template<typename C, typename L>
+void Graph::forInNeighborsOfWhile(node u, C condition, L handle) const {
+	const std::vector<node>& neighbors = directed ? inEdges[u] : outEdges[u];
+	for (index i = 0; i < neighbors.size() && condition(); ++i) {
+		if (useEdgeInIteration<true>(u, neighbors[i])) {
+			handle(neighbors[i]);
+		}
+	}
+}
+
 template<typename L>
 void Graph::forInEdgesOf(node u, L handle) const {
 	switch (weighted + 2 * directed + 4 * edgesIndexed) {
@@ -1530,7 +1428,7 @@ void Graph::BFSfrom(const std::vector<node> &startNodes, L handle) const {
 		node u = q.front();
 		q.pop();
 		// apply function
-		callBFSHandle(handle, u, dist);
+		GraphDetails::callBFSHandle(handle, u, dist);
 		forNeighborsOf(u, [&](node v) {
 			if (!marked[v]) {
 				qNext.push(v);
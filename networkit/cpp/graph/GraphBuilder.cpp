@@ -5,6 +5,7 @@
  *      Author: Marvin Ritter (marvin.ritter@gmail.com)
  */
 
+#include <algorithm>
 #include <stdexcept>
 #include <omp.h>
 
@@ -42,7 +43,7 @@ index GraphBuilder::indexInOutEdgeArray(node u, node v) const {
 			return i;
 		}
 	}
-	return none;
+	return noneIndex;
 }
 
 index GraphBuilder::indexInInEdgeArray(node u, node v) const {
@@ -53,7 +54,7 @@ index GraphBuilder::indexInInEdgeArray(node u, node v) const {
 			return i;
 		}
 	}
-	return none;
+	return noneIndex;
 }
 
 node GraphBuilder::addNode() {
@@ -71,7 +72,7 @@ node GraphBuilder::addNode() {
 }
 
 void GraphBuilder::addHalfOutEdge(node u, node v, edgeweight ew) {
-	assert(indexInOutEdgeArray(u, v) == none);
+	assert(indexInOutEdgeArray(u, v) == noneIndex);
 	outEdges[u].push_back(v);
 	if (weighted) {
 		outEdgeWeights[u].push_back(ew);
@@ -83,7 +84,7 @@ void GraphBuilder::addHalfOutEdge(node u, node v, edgeweight ew) {
 }
 
 void GraphBuilder::addHalfInEdge(node u, node v, edgeweight ew) {
-	assert(indexInInEdgeArray(u, v) == none);
+	assert(indexInInEdgeArray(u, v) == noneIndex);
 	inEdges[u].push_back(v);
 	if (weighted) {
 		inEdgeWeights[u].push_back(ew);
@@ -109,7 +110,7 @@ void GraphBuilder::swapNeighborhood(node u, std::vector<node> &neighbours, std::
 void GraphBuilder::setOutWeight(node u, node v, edgeweight ew) {
 	assert(isWeighted());
 	index vi = indexInOutEdgeArray(u, v);
-	if (vi != none) {
+	if (vi != noneIndex) {
 		outEdgeWeights[u][vi] = ew;
 	} else {
 		addHalfOutEdge(u, v, ew);
@@ -120,7 +121,7 @@ void GraphBuilder::setInWeight(node u, node v, edgeweight ew) {
 	assert(isWeighted());
 	assert(isDirected());
 	index vi = indexInInEdgeArray(u, v);
-	if (vi != none) {
+	if (vi != noneIndex) {
 		inEdgeWeights[u][vi] = ew;
 	} else {
 		addHalfInEdge(u, v, ew);
@@ -130,7 +131,7 @@ void GraphBuilder::setInWeight(node u, node v, edgeweight ew) {
 void GraphBuilder::increaseOutWeight(node u, node v, edgeweight ew) {
 	assert(isWeighted());
 	index vi = indexInOutEdgeArray(u, v);
-	if (vi != none) {
+	if (vi != noneIndex) {
 		outEdgeWeights[u][vi] += ew;
 	} else {
 		addHalfOutEdge(u, v, ew);
@@ -141,14 +142,14 @@ void GraphBuilder::increaseInWeight(node u, node v, edgeweight ew) {
 	assert(isWeighted());
 	assert(isDirected());
 	index vi = indexInInEdgeArray(u, v);
-	if (vi != none) {
+	if (vi != noneIndex) {
 		inEdgeWeights[u][vi] += ew;
 	} else {
 		addHalfInEdge(u, v, ew);
 	}
 }
 
-Graph GraphBuilder::toGraph(bool autoCompleteEdges, bool parallel) {
+Graph GraphBuilder::toGraph(bool autoCompleteEdges, bool parallel, bool sortAndDeduplicate) {
 	Graph G(n, weighted, directed);
 	if (name != "") {
 		G.setName(name);
@@ -170,6 +171,10 @@ Graph GraphBuilder::toGraph(bool autoCompleteEdges, bool parallel) {
 		toGraphDirectSwap(G);
 	}
 
+	if (sortAndDeduplicate) {
+		sortAndDeduplicateEdges(G);
+	}
+
 	assert(G.outEdges.size() == n);
 	assert(G.outEdgeWeights.size() == (weighted ? n : 0));
 	assert(G.inEdges.size() == (directed ? n : 0));
@@ -201,97 +206,122 @@ void GraphBuilder::toGraphDirectSwap(Graph& G) {
 }
 
 void GraphBuilder::toGraphParallel(Graph& G) {
-	// basic idea of the parallelization:
-	// 1) each threads collects its own data
-	// 2) each node collects all its data from all threads
+	// basic idea of the parallelization (a semi-sort of the missing half edges by their target):
+	// 1) count the missing half edges of each node
+	// 2) turn the counts into offsets of the half edges of each target in one array
+	// 3) scatter the (source, position) pairs of the missing half edges to their targets
+	// 4) sort the pairs of each target, which restores the order of toGraphSequential independently of the
+	//    number of threads, and copy them into the final adjacency arrays
+	// besides the graph this needs one offset per node and one pair per missing half edge
 
-	int maxThreads = omp_get_max_threads();
-
-	using Adjacencylists = std::vector< std::vector<node> >;
-	using Weightlists = std::vector< std::vector<edgeweight> >;
+	// we have already half of the edges
+	G.outEdges.swap(outEdges);
+	G.outEdgeWeights.swap(outEdgeWeights);
 
-	std::vector<Adjacencylists> inEdgesPerThread(maxThreads, Adjacencylists(n));
-	std::vector<Weightlists> inWeightsPerThread(weighted ? maxThreads : 0, Weightlists(n));
-	std::vector<count> numberOfSelfLoopsPerThread(maxThreads, 0);
+	#pragma omp parallel for
+	for (omp_index v = 0; v < static_cast<omp_index>(n); v++) {
+		G.outDeg[v] = G.outEdges[v].size();
+	}
 
-	// step 1
-	parallelForNodes([&](node v) {
-		int tid = omp_get_thread_num();
-		for (index i = 0; i < outEdges[v].size(); i++) {
-			node u = outEdges[v][i];
+	// step 1, offset[u + 1] counts the half edges that are missing at u
+	std::vector<index> offset(n + 1, 0);
+	count numSelfLoops = 0;
+	#pragma omp parallel for schedule(guided) reduction(+:numSelfLoops)
+	for (omp_index v = 0; v < static_cast<omp_index>(n); v++) {
+		for (node u : G.outEdges[v]) {
 			if (directed || u != v) { // self loops don't need to be added twice in undirected graphs
-				inEdgesPerThread[tid][u].push_back(v);
-				if (weighted) {
-					edgeweight ew = outEdgeWeights[v][i];
-					inWeightsPerThread[tid][u].push_back(ew);
-				}
+				#pragma omp atomic
+				offset[u + 1]++;
 			}
 			if (u == v) {
-				numberOfSelfLoopsPerThread[tid]++;
+				numSelfLoops++;
 			}
 		}
-	});
-
-	// we have already half of the edges
-	G.outEdges.swap(outEdges);
-	G.outEdgeWeights.swap(outEdgeWeights);
+	}
 
 	// step 2
-	parallelForNodes([&](node v) {
-		count inDeg = 0;
-		count outDeg = G.outEdges[v].size();
-		for (int tid = 0; tid < maxThreads; tid++) {
-			inDeg += inEdgesPerThread[tid][v].size();
-		}
+	for (node u = 0; u < n; u++) {
+		offset[u + 1] += offset[u];
+	}
 
-		assert(inDeg <= n);
-		assert(outDeg <= n);
-		// allocate enough memory for all edges/weights
-		if (directed) {
-			G.inEdges[v].reserve(inDeg);
-			if (weighted) {
-				G.inEdgeWeights[v].reserve(inDeg);
-			}
-		} else {
-			G.outEdges[v].reserve(outDeg + inDeg);
-			if (weighted) {
-				G.outEdgeWeights[v].reserve(outDeg + inDeg);
+	// step 3, offset[u] is the write cursor of u and ends at the beginning of u + 1
+	std::vector< std::pair<node, index> > missing(offset[n]);
+	#pragma omp parallel for schedule(guided)
+	for (omp_index v = 0; v < static_cast<omp_index>(n); v++) {
+		for (index i = 0; i < G.outDeg[v]; i++) {
+			const node u = G.outEdges[v][i];
+			if (directed || u != v) {
+				index pos;
+				#pragma omp atomic capture
+				pos = offset[u]++;
+				missing[pos] = std::make_pair(static_cast<node>(v), i);
 			}
 		}
+	}
 
-		// collect 'second' half of the edges
-		if (directed) {
-			G.inDeg[v] = inDeg;
-			G.outDeg[v] = outDeg;
-			for (int tid = 0; tid < maxThreads; tid++) {
-				copyAndClear(inEdgesPerThread[tid][v], G.inEdges[v]);
-			}
-			assert(G.inDeg[v] == G.inEdges[v].size());
+	// step 4, for undirected graphs the second half edges are appended to the first ones; all arrays are
+	// resized before the weights of the first half edges are read in the copy loop
+	std::vector< std::vector<node> >& secondHalves = directed ? G.inEdges : G.outEdges;
+	std::vector< std::vector<edgeweight> >& secondHalfWeights = directed ? G.inEdgeWeights : G.outEdgeWeights;
+	#pragma omp parallel for schedule(dynamic, 100)
+	for (omp_index u = 0; u < static_cast<omp_index>(n); u++) {
+		const count size = (directed ? 0 : G.outDeg[u]) + offset[u] - (u == 0 ? 0 : offset[u - 1]);
+		secondHalves[u].resize(size);
+		if (weighted) {
+			secondHalfWeights[u].resize(size);
+		}
+	}
+	#pragma omp parallel for schedule(guided)
+	for (omp_index u = 0; u < static_cast<omp_index>(n); u++) {
+		const index begin = u == 0 ? 0 : offset[u - 1];
+		const index end = offset[u];
+		std::sort(missing.begin() + begin, missing.begin() + end);
+		const index first = directed ? 0 : G.outDeg[u];
+		for (index j = begin; j < end; j++) {
+			const node v = missing[j].first;
+			secondHalves[u][first + j - begin] = v;
 			if (weighted) {
-				for (int tid = 0; tid < maxThreads; tid++) {
-					copyAndClear(inWeightsPerThread[tid][v], G.inEdgeWeights[v]);
-				}
-				assert(G.inDeg[v] == G.inEdgeWeights[v].size());
+				secondHalfWeights[u][first + j - begin] = G.outEdgeWeights[v][missing[j].second];
 			}
+		}
+	}
 
-		} else {
-			G.outDeg[v] = inDeg + outDeg;
-			assert(G.outDeg[v] <= n);
-			for (int tid = 0; tid < maxThreads; tid++) {
-				copyAndClear(inEdgesPerThread[tid][v], G.outEdges[v]);
-			}
-			assert(G.outDeg[v] == G.outEdges[v].size());
-			if (weighted) {
-				for (int tid = 0; tid < maxThreads; tid++) {
-					copyAndClear(inWeightsPerThread[tid][v], G.outEdgeWeights[v]);
-				}
+	G.storedNumberOfSelfLoops = numSelfLoops;
+}
+
+void GraphBuilder::sortAndDeduplicateEdges(Graph& G) {
+	auto sortAndDeduplicate = [&](std::vector<node>& neighbors, std::vector<edgeweight>& weights) {
+		if (!weighted) {
+			std::sort(neighbors.begin(), neighbors.end());
+			neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+			return;
+		}
+		// sorting by weight as well makes the kept weight independent of the insertion order
+		std::vector< std::pair<node, edgeweight> > edges(neighbors.size());
+		for (index i = 0; i < neighbors.size(); i++) {
+			edges[i] = std::make_pair(neighbors[i], weights[i]);
+		}
+		std::sort(edges.begin(), edges.end());
+		neighbors.clear();
+		weights.clear();
+		for (index i = 0; i < edges.size(); i++) {
+			if (i == 0 || edges[i].first != edges[i - 1].first) {
+				neighbors.push_back(edges[i].first);
+				weights.push_back(edges[i].second);
 			}
 		}
-	});
+	};
+
+	std::vector<edgeweight> noWeights; // never touched for unweighted graphs
 	count numSelfLoops = 0;
-	#pragma omp parallel for reduction(+:numSelfLoops)
-	for (omp_index i = 0; i < static_cast<omp_index>(maxThreads); ++i)
-		numSelfLoops += numberOfSelfLoopsPerThread[i];
+	#pragma omp parallel for schedule(dynamic, 100) reduction(+:numSelfLoops)
+	for (omp_index v = 0; v < static_cast<omp_index>(n); v++) {
+		sortAndDeduplicate(G.outEdges[v], weighted ? G.outEdgeWeights[v] : noWeights);
+		if (directed) {
+			sortAndDeduplicate(G.inEdges[v], weighted ? G.inEdgeWeights[v] : noWeights);
+		}
+		numSelfLoops += std::binary_search(G.outEdges[v].begin(), G.outEdges[v].end(), static_cast<node>(v));
+	}
 	G.storedNumberOfSelfLoops = numSelfLoops;
 }
 
@@ -404,7 +434,7 @@ count GraphBuilder::numberOfEdges(const Graph& G) {
 		return m;
 	} else {
 		// self loops are just counted once
-		return (m - selfloops) / 2 + selfloops;
+		return (m - G.storedNumberOfSelfLoops) / 2 + G.storedNumberOfSelfLoops;
 	}
 }
 
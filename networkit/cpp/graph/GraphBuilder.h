@@ -20,8 +20,7 @@ namespace NetworKit {
  * In the Graph class for an edge u -> v, v is stored in the adjacent array of u (first half) and u in the adjacent array of v (second half). (For directed graphs these might be in and out adjacent arrays.). So each edge can be seen as a pair of 2 half edges. To allow optimization and mainly parallelization GraphBuilder lets you add both half edges yourself. You are responsible for adding both half edges, otherwise you might end up with an invalid Graph object.
  * As adding the first half edge of an edge u -> v only requires access to the adjacent array of u, other threads can add edges a -> b as long as a != u. Some goes for the methods setWeight and increaseWeight. Note: If you add the first half edge of u -> v, you can change the weight by calling setWeight(u, v, ew) or increaseWeight(u, v, ew), but calling setWeight(v, u, ew) or increaseWeight(v, u, ew) will add the second half edge.
  * GraphBuilder allows you to be lazy and only add one half of each edge. Calling toGraph with autoCompleteEdges set to true, will make each half Edge in GraphBuilder to one full edge in Graph.
- *
- * So far I didn't came up with a good parallelization for toGraph, so at some point I might omit the parallel parameter for toGraph.
+ * The parallel completion sorts the missing half edges by their target with one offset per node and one entry per missing half edge, so it needs O(n + m) memory independent of the number of threads.
  */
 
 class GraphBuilder {
@@ -139,8 +138,14 @@ public:
 
 	/**
 	 * Generates a Graph instance. The graph builder will be reseted at the end.
+	 *
+	 * @param autoCompleteEdges If set to @c true, the second half of each edge is added.
+	 * @param parallel If set to @c true, the edges are completed in parallel. The adjacencies are the same as
+	 * without @a parallel, independently of the number of threads.
+	 * @param sortAndDeduplicate If set to @c true, the neighbors of each node are sorted by id and
+	 * multiple edges are merged into one that keeps the smallest weight.
 	 */
-	Graph toGraph(bool autoCompleteEdges, bool parallel = false);
+	Graph toGraph(bool autoCompleteEdges, bool parallel = false, bool sortAndDeduplicate = false);
 
 	/**
 	 * Iterate over all nodes of the graph and call @a handle (lambda closure).
@@ -174,10 +179,8 @@ private:
 	void toGraphDirectSwap(Graph &G);
 	void toGraphSequential(Graph &G);
 	void toGraphParallel(Graph &G);
+	void sortAndDeduplicateEdges(Graph &G);
 
-	template <typename T>
-	static void copyAndClear(std::vector<T>& source, std::vector<T>& target);
-	
 	void setDegrees(Graph& G);
 	count numberOfEdges(const Graph& G);
 };
@@ -216,12 +219,6 @@ void GraphBuilder::parallelForNodePairs(L handle) const {
 	}
 }
 
-template <typename T>
-void GraphBuilder::copyAndClear(std::vector<T>& source, std::vector<T>& target) {
-	std::copy(source.begin(), source.end(), std::back_inserter(target));
-	source.clear();
-}
-
 } /* namespace NetworKit */
 
 #endif /* GRAPH_BUILDER_H */
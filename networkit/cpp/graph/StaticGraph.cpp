@@ -0,0 +1,149 @@
+/*
+ * StaticGraph.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include "StaticGraph.h"
+
+namespace NetworKit {
+
+StaticGraph::StaticGraph() :
+	name(""),
+	n(0),
+	m(0),
+	storedNumberOfSelfLoops(0),
+	z(0),
+	omega(0),
+	weighted(false),
+	directed(false),
+	edgesIndexed(false),
+	outOffsets(1, 0),
+	inOffsets(0) {
+}
+
+StaticGraph::StaticGraph(const Graph& G) :
+	name(G.getName()),
+	n(G.numberOfNodes()),
+	m(G.numberOfEdges()),
+	storedNumberOfSelfLoops(G.numberOfSelfLoops()),
+	z(G.upperNodeIdBound()),
+	omega(G.upperEdgeIdBound()),
+	weighted(G.isWeighted()),
+	directed(G.isDirected()),
+	edgesIndexed(G.hasEdgeIds()),
+	exists(G.upperNodeIdBound(), false) {
+
+	G.forNodes([&](node u) {
+		exists[u] = true;
+	});
+
+	fillCSR(G, false, outOffsets, outEdges, outEdgeWeights, outEdgeIds);
+	if (directed) {
+		fillCSR(G, true, inOffsets, inEdges, inEdgeWeights, inEdgeIds);
+	}
+}
+
+void StaticGraph::fillCSR(const Graph& G, bool incoming, std::vector<index>& offsets, std::vector<node>& edges,
+	std::vector<edgeweight>& weights, std::vector<edgeid>& ids) {
+	offsets.assign(z + 1, 0);
+	for (node u = 0; u < z; ++u) {
+		offsets[u + 1] = offsets[u] + (exists[u] ? (incoming ? G.degreeIn(u) : G.degreeOut(u)) : 0);
+	}
+
+	const count total = offsets[z];
+	edges.resize(total);
+	weights.resize(weighted ? total : 0);
+	ids.resize(edgesIndexed ? total : 0);
+
+	#pragma omp parallel for schedule(guided)
+	for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+		if (!exists[u]) continue;
+		index pos = offsets[u];
+		auto store = [&](node, node v, edgeweight ew, edgeid eid) {
+			edges[pos] = v;
+			if (weighted) weights[pos] = ew;
+			if (edgesIndexed) ids[pos] = eid;
+			++pos;
+		};
+		if (incoming) {
+			G.forInEdgesOf(u, store);
+		} else {
+			G.forEdgesOf(u, store);
+		}
+		assert(pos == offsets[u + 1]);
+	}
+}
+
+Graph StaticGraph::toGraph() const {
+	Graph G(z, weighted, directed);
+	for (node u = 0; u < z; ++u) {
+		if (!exists[u]) {
+			G.removeNode(u);
+		}
+	}
+	forEdges([&](node u, node v, edgeweight ew) {
+		G.addEdge(u, v, ew);
+	});
+	if (edgesIndexed) {
+		G.indexEdges();
+	}
+	if (name != "") {
+		G.setName(name);
+	}
+	return G;
+}
+
+bool StaticGraph::hasEdge(node u, node v) const {
+	if (!hasNode(u) || !hasNode(v)) {
+		return false;
+	}
+	const index end = outOffsets[u + 1];
+	for (index i = outOffsets[u]; i < end; ++i) {
+		if (outEdges[i] == v) {
+			return true;
+		}
+	}
+	return false;
+}
+
+edgeweight StaticGraph::weight(node u, node v) const {
+	const index end = outOffsets[u + 1];
+	for (index i = outOffsets[u]; i < end; ++i) {
+		if (outEdges[i] == v) {
+			return weighted ? outEdgeWeights[i] : defaultEdgeWeight;
+		}
+	}
+	return nullWeight;
+}
+
+edgeweight StaticGraph::weightedDegree(node v) const {
+	if (!weighted) {
+		return degree(v) * defaultEdgeWeight;
+	}
+	edgeweight sum = 0.0;
+	const index end = outOffsets[v + 1];
+	for (index i = outOffsets[v]; i < end; ++i) {
+		sum += outEdgeWeights[i];
+	}
+	return sum;
+}
+
+edgeweight StaticGraph::totalEdgeWeight() const {
+	if (!weighted) {
+		return m * defaultEdgeWeight;
+	}
+	return parallelSumForEdges([](node, node, edgeweight ew) {
+		return ew;
+	});
+}
+
+count StaticGraph::memoryUsage() const {
+	return sizeof(index) * (outOffsets.size() + inOffsets.size())
+		+ sizeof(node) * (outEdges.size() + inEdges.size())
+		+ sizeof(edgeweight) * (outEdgeWeights.size() + inEdgeWeights.size())
+		+ sizeof(edgeid) * (outEdgeIds.size() + inEdgeIds.size())
+		+ exists.size() / 8;
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,599 @@
+/*
+ * StaticGraph.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef STATIC_GRAPH_H_
+#define STATIC_GRAPH_H_
+
+#include <vector>
+#include <queue>
+#include <string>
+
+#include "../Globals.h"
+#include "Graph.h"
+#include "EdgeLambda.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup graph
+ * An immutable snapshot of a Graph in compressed sparse row (CSR) format.
+ *
+ * All neighbors of all nodes are stored in a single contiguous array which is indexed by an
+ * offsets array of size upperNodeIdBound() + 1; weights and edge ids (if present) follow the
+ * same layout. For directed graphs the incoming edges are stored in a second CSR structure.
+ * The iteration methods accept the same lambdas as the corresponding methods of Graph and
+ * visit the neighbors in the same order, so template code written against the iterator
+ * interface of Graph runs unchanged on a StaticGraph.
+ *
+ * Algorithms that only read the graph are templated on its type as Basic<Name><GraphType>, with a
+ * typedef of the Graph instantiation under the original name (e.g. BasicBFS and BFS), and are
+ * instantiated for Graph, StaticGraph and CompressedGraph. On the snapshots their traversals read
+ * contiguous arrays instead of one vector per node. This is done for SSSP, BFS, Dijkstra and PageRank
+ * (with Centrality and IterativeCentrality); Betweenness, PLM and all other algorithms still take a Graph.
+ *
+ * Node ids (including deleted ones) and edge ids are preserved. The snapshot does not
+ * support any modification; create a new one if the underlying graph changes.
+ */
+class StaticGraph final {
+
+private:
+	std::string name;
+
+	count n; //!< number of nodes
+	count m; //!< number of edges
+	count storedNumberOfSelfLoops; //!< number of self loops
+	node z; //!< upper bound of node ids
+	edgeid omega; //!< upper bound of edge ids
+
+	bool weighted;
+	bool directed;
+	bool edgesIndexed;
+
+	std::vector<bool> exists; //!< exists[v] is true if node v exists
+
+	std::vector<index> outOffsets; //!< outgoing edges of u are stored in [outOffsets[u], outOffsets[u+1])
+	std::vector<node> outEdges; //!< targets of the outgoing edges, for undirected graphs every edge is stored twice
+	std::vector<edgeweight> outEdgeWeights; //!< same layout as outEdges, empty if unweighted
+	std::vector<edgeid> outEdgeIds; //!< same layout as outEdges, empty if edges are not indexed
+
+	std::vector<index> inOffsets; //!< only used for directed graphs, same schema as outOffsets
+	std::vector<node> inEdges; //!< only used for directed graphs, sources of the incoming edges
+	std::vector<edgeweight> inEdgeWeights; //!< only used for directed weighted graphs
+	std::vector<edgeid> inEdgeIds; //!< only used for directed graphs with edge ids
+
+	template<bool hasWeights>
+	inline edgeweight getOutEdgeWeight(index i) const;
+
+	template<bool hasWeights>
+	inline edgeweight getInEdgeWeight(index i) const;
+
+	template<bool graphHasEdgeIds>
+	inline edgeid getOutEdgeId(index i) const;
+
+	template<bool graphHasEdgeIds>
+	inline edgeid getInEdgeId(index i) const;
+
+	template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+	inline void forOutEdgesOfImpl(node u, L handle) const;
+
+	template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+	inline void forInEdgesOfImpl(node u, L handle) const;
+
+	template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+	inline void forEdgeImpl(L handle) const;
+
+	template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+	inline void parallelForEdgesImpl(L handle) const;
+
+	template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+	inline double parallelSumForEdgesImpl(L handle) const;
+
+	/**
+	 * Fills one CSR structure with the outgoing (or incoming if @a incoming is set) edges of @a G.
+	 */
+	void fillCSR(const Graph& G, bool incoming, std::vector<index>& offsets, std::vector<node>& edges,
+		std::vector<edgeweight>& weights, std::vector<edgeid>& ids);
+
+public:
+
+	/**
+	 * Creates an empty static graph.
+	 */
+	StaticGraph();
+
+	/**
+	 * Creates a CSR snapshot of @a G. The adjacency arrays are filled in parallel,
+	 * the memory consumption is O(n + m) independent of the number of threads.
+	 *
+	 * @param G The graph to freeze.
+	 */
+	explicit StaticGraph(const Graph& G);
+
+	/**
+	 * Converts the snapshot back to a (mutable) Graph. If the snapshot has edge ids,
+	 * the edges of the returned graph are re-indexed.
+	 */
+	Graph toGraph() const;
+
+	/** GRAPH INFORMATION **/
+
+	std::string getName() const { return name; }
+
+	bool isWeighted() const { return weighted; }
+
+	bool isDirected() const { return directed; }
+
+	bool hasEdgeIds() const { return edgesIndexed; }
+
+	bool isEmpty() const { return n == 0; }
+
+	count numberOfNodes() const { return n; }
+
+	count numberOfEdges() const { return m; }
+
+	count numberOfSelfLoops() const { return storedNumberOfSelfLoops; }
+
+	index upperNodeIdBound() const { return z; }
+
+	index upperEdgeIdBound() const { return omega; }
+
+	bool hasNode(node v) const { return (v < z) && exists[v]; }
+
+	/**
+	 * Checks if edge (@a u, @a v) exists. Running time is O(deg(u)).
+	 */
+	bool hasEdge(node u, node v) const;
+
+	/**
+	 * Returns the weight of edge (@a u, @a v) or nullWeight if the edge does not exist.
+	 * Running time is O(deg(u)).
+	 */
+	edgeweight weight(node u, node v) const;
+
+	/**
+	 * Returns the number of outgoing neighbors of @a v.
+	 */
+	count degree(node v) const { return outOffsets[v + 1] - outOffsets[v]; }
+
+	/**
+	 * Returns the number of incoming neighbors of @a v (outgoing for undirected graphs).
+	 */
+	count degreeIn(node v) const { return directed ? inOffsets[v + 1] - inOffsets[v] : degree(v); }
+
+	count degreeOut(node v) const { return degree(v); }
+
+	bool isIsolated(node v) const { return degree(v) == 0 && (!directed || degreeIn(v) == 0); }
+
+	/**
+	 * Returns the weighted degree of @a v, for directed graphs only outgoing edges count.
+	 */
+	edgeweight weightedDegree(node v) const;
+
+	/**
+	 * Returns the sum of all edge weights.
+	 */
+	edgeweight totalEdgeWeight() const;
+
+	/**
+	 * Returns the number of bytes occupied by the adjacency structure.
+	 */
+	count memoryUsage() const;
+
+	/* NODE ITERATORS */
+
+	template<typename L> void forNodes(L handle) const;
+
+	template<typename L> void parallelForNodes(L handle) const;
+
+	template<typename C, typename L> void forNodesWhile(C condition, L handle) const;
+
+	template<typename L> void balancedParallelForNodes(L handle) const;
+
+	/* EDGE ITERATORS */
+
+	/**
+	 * Iterate over all edges and call @a handle (lambda closure), @see Graph::forEdges.
+	 */
+	template<typename L> void forEdges(L handle) const;
+
+	/**
+	 * Iterate in parallel over all edges and call @a handle (lambda closure), @see Graph::parallelForEdges.
+	 */
+	template<typename L> void parallelForEdges(L handle) const;
+
+	/* NEIGHBORHOOD ITERATORS */
+
+	/**
+	 * Iterate over all (outgoing) neighbors of @a u, @see Graph::forNeighborsOf.
+	 */
+	template<typename L> void forNeighborsOf(node u, L handle) const;
+
+	template<typename L> void forEdgesOf(node u, L handle) const;
+
+	/**
+	 * Iterate over all incoming neighbors of @a u, @see Graph::forInNeighborsOf.
+	 */
+	template<typename L> void forInNeighborsOf(node u, L handle) const;
+
+	template<typename L> void forInEdgesOf(node u, L handle) const;
+
+	/* REDUCTION ITERATORS */
+
+	template<typename L> double parallelSumForNodes(L handle) const;
+
+	template<typename L> double parallelSumForEdges(L handle) const;
+
+	/* GRAPH SEARCHES */
+
+	/**
+	 * Iterate over nodes in breadth-first search order starting from r, @see Graph::BFSfrom.
+	 */
+	template<typename L> void BFSfrom(node r, L handle) const;
+};
+
+/* NODE ITERATORS */
+
+template<typename L>
+void StaticGraph::forNodes(L handle) const {
+	for (node v = 0; v < z; ++v) {
+		if (exists[v]) {
+			handle(v);
+		}
+	}
+}
+
+template<typename L>
+void StaticGraph::parallelForNodes(L handle) const {
+	#pragma omp parallel for
+	for (omp_index v = 0; v < static_cast<omp_index>(z); ++v) {
+		if (exists[v]) {
+			handle(v);
+		}
+	}
+}
+
+template<typename C, typename L>
+void StaticGraph::forNodesWhile(C condition, L handle) const {
+	for (node v = 0; v < z; ++v) {
+		if (exists[v]) {
+			if (!condition()) {
+				break;
+			}
+			handle(v);
+		}
+	}
+}
+
+template<typename L>
+void StaticGraph::balancedParallelForNodes(L handle) const {
+	#pragma omp parallel for schedule(guided)
+	for (omp_index v = 0; v < static_cast<omp_index>(z); ++v) {
+		if (exists[v]) {
+			handle(v);
+		}
+	}
+}
+
+/* HELPERS */
+
+template<bool hasWeights>
+inline edgeweight StaticGraph::getOutEdgeWeight(index i) const {
+	return outEdgeWeights[i];
+}
+
+template<>
+inline edgeweight StaticGraph::getOutEdgeWeight<false>(index) const {
+	return defaultEdgeWeight;
+}
+
+template<bool hasWeights>
+inline edgeweight StaticGraph::getInEdgeWeight(index i) const {
+	return inEdgeWeights[i];
+}
+
+template<>
+inline edgeweight StaticGraph::getInEdgeWeight<false>(index) const {
+	return defaultEdgeWeight;
+}
+
+template<bool graphHasEdgeIds>
+inline edgeid StaticGraph::getOutEdgeId(index i) const {
+	return outEdgeIds[i];
+}
+
+template<>
+inline edgeid StaticGraph::getOutEdgeId<false>(index) const {
+	return 0;
+}
+
+template<bool graphHasEdgeIds>
+inline edgeid StaticGraph::getInEdgeId(index i) const {
+	return inEdgeIds[i];
+}
+
+template<>
+inline edgeid StaticGraph::getInEdgeId<false>(index) const {
+	return 0;
+}
+
+template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+inline void StaticGraph::forOutEdgesOfImpl(node u, L handle) const {
+	const index end = outOffsets[u + 1];
+	for (index i = outOffsets[u]; i < end; ++i) {
+		node v = outEdges[i];
+
+		// undirected, do not iterate over edges twice
+		if (graphIsDirected || u >= v) {
+			GraphDetails::edgeLambda<L>(handle, u, v, getOutEdgeWeight<hasWeights>(i), getOutEdgeId<graphHasEdgeIds>(i));
+		}
+	}
+}
+
+template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+inline void StaticGraph::forInEdgesOfImpl(node u, L handle) const {
+	if (graphIsDirected) {
+		const index end = inOffsets[u + 1];
+		for (index i = inOffsets[u]; i < end; ++i) {
+			GraphDetails::edgeLambda<L>(handle, u, inEdges[i], getInEdgeWeight<hasWeights>(i), getInEdgeId<graphHasEdgeIds>(i));
+		}
+	} else {
+		forOutEdgesOfImpl<true, hasWeights, graphHasEdgeIds, L>(u, handle);
+	}
+}
+
+template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+inline void StaticGraph::forEdgeImpl(L handle) const {
+	for (node u = 0; u < z; ++u) {
+		forOutEdgesOfImpl<graphIsDirected, hasWeights, graphHasEdgeIds, L>(u, handle);
+	}
+}
+
+template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+inline void StaticGraph::parallelForEdgesImpl(L handle) const {
+	#pragma omp parallel for schedule(guided)
+	for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+		forOutEdgesOfImpl<graphIsDirected, hasWeights, graphHasEdgeIds, L>(u, handle);
+	}
+}
+
+template<bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+inline double StaticGraph::parallelSumForEdgesImpl(L handle) const {
+	double sum = 0.0;
+
+	#pragma omp parallel for reduction(+:sum)
+	for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+		const index end = outOffsets[u + 1];
+		for (index i = outOffsets[u]; i < end; ++i) {
+			node v = outEdges[i];
+			if (graphIsDirected || static_cast<node>(u) >= v) {
+				sum += GraphDetails::edgeLambda<L>(handle, u, v, getOutEdgeWeight<hasWeights>(i), getOutEdgeId<graphHasEdgeIds>(i));
+			}
+		}
+	}
+
+	return sum;
+}
+
+/* EDGE ITERATORS */
+
+template<typename L>
+void StaticGraph::forEdges(L handle) const {
+	switch (weighted + 2 * directed + 4 * edgesIndexed) {
+	case 0: // unweighted, undirected, no edgeIds
+		forEdgeImpl<false, false, false, L>(handle);
+		break;
+
+	case 1: // weighted,   undirected, no edgeIds
+		forEdgeImpl<false, true, false, L>(handle);
+		break;
+
+	case 2: // unweighted, directed, no edgeIds
+		forEdgeImpl<true, false, false, L>(handle);
+		break;
+
+	case 3: // weighted, directed, no edgeIds
+		forEdgeImpl<true, true, false, L>(handle);
+		break;
+
+	case 4: // unweighted, undirected, with edgeIds
+		forEdgeImpl<false, false, true, L>(handle);
+		break;
+
+	case 5: // weighted,   undirected, with edgeIds
+		forEdgeImpl<false, true, true, L>(handle);
+		break;
+
+	case 6: // unweighted, directed, with edgeIds
+		forEdgeImpl<true, false, true, L>(handle);
+		break;
+
+	case 7: // weighted,   directed, with edgeIds
+		forEdgeImpl<true, true, true, L>(handle);
+		break;
+	}
+}
+
+template<typename L>
+void StaticGraph::parallelForEdges(L handle) const {
+	switch (weighted + 2 * directed + 4 * edgesIndexed) {
+	case 0: // unweighted, undirected, no edgeIds
+		parallelForEdgesImpl<false, false, false, L>(handle);
+		break;
+
+	case 1: // weighted,   undirected, no edgeIds
+		parallelForEdgesImpl<false, true, false, L>(handle);
+		break;
+
+	case 2: // unweighted, directed, no edgeIds
+		parallelForEdgesImpl<true, false, false, L>(handle);
+		break;
+
+	case 3: // weighted, directed, no edgeIds
+		parallelForEdgesImpl<true, true, false, L>(handle);
+		break;
+
+	case 4: // unweighted, undirected, with edgeIds
+		parallelForEdgesImpl<false, false, true, L>(handle);
+		break;
+
+	case 5: // weighted,   undirected, with edgeIds
+		parallelForEdgesImpl<false, true, true, L>(handle);
+		break;
+
+	case 6: // unweighted, directed, with edgeIds
+		parallelForEdgesImpl<true, false, true, L>(handle);
+		break;
+
+	case 7: // weighted,   directed, with edgeIds
+		parallelForEdgesImpl<true, true, true, L>(handle);
+		break;
+	}
+}
+
+/* NEIGHBORHOOD ITERATORS */
+
+template<typename L>
+void StaticGraph::forNeighborsOf(node u, L handle) const {
+	forEdgesOf(u, handle);
+}
+
+template<typename L>
+void StaticGraph::forEdgesOf(node u, L handle) const {
+	switch (weighted + 2 * edgesIndexed) {
+	case 0: //not weighted, no edge ids
+		forOutEdgesOfImpl<true, false, false, L>(u, handle);
+		break;
+
+	case 1:	//weighted, no edge ids
+		forOutEdgesOfImpl<true, true, false, L>(u, handle);
+		break;
+
+	case 2: //not weighted, with edge ids
+		forOutEdgesOfImpl<true, false, true, L>(u, handle);
+		break;
+
+	case 3:	//weighted, with edge ids
+		forOutEdgesOfImpl<true, true, true, L>(u, handle);
+		break;
+	}
+}
+
+template<typename L>
+void StaticGraph::forInNeighborsOf(node u, L handle) const {
+	forInEdgesOf(u, handle);
+}
+
+template<typename L>
+void StaticGraph::forInEdgesOf(node u, L handle) const {
+	switch (weighted + 2 * directed + 4 * edgesIndexed) {
+	case 0: //unweighted, undirected, no edge ids
+		forInEdgesOfImpl<false, false, false, L>(u, handle);
+		break;
+
+	case 1: //weighted, undirected, no edge ids
+		forInEdgesOfImpl<false, true, false, L>(u, handle);
+		break;
+
+	case 2: //unweighted, directed, no edge ids
+		forInEdgesOfImpl<true, false, false, L>(u, handle);
+		break;
+
+	case 3: //weighted, directed, no edge ids
+		forInEdgesOfImpl<true, true, false, L>(u, handle);
+		break;
+
+	case 4: //unweighted, undirected, with edge ids
+		forInEdgesOfImpl<false, false, true, L>(u, handle);
+		break;
+
+	case 5: //weighted, undirected, with edge ids
+		forInEdgesOfImpl<false, true, true, L>(u, handle);
+		break;
+
+	case 6: //unweighted, directed, with edge ids
+		forInEdgesOfImpl<true, false, true, L>(u, handle);
+		break;
+
+	case 7: //weighted, directed, with edge ids
+		forInEdgesOfImpl<true, true, true, L>(u, handle);
+		break;
+	}
+}
+
+/* REDUCTION ITERATORS */
+
+template<typename L>
+double StaticGraph::parallelSumForNodes(L handle) const {
+	double sum = 0.0;
+
+	#pragma omp parallel for reduction(+:sum)
+	for (omp_index v = 0; v < static_cast<omp_index>(z); ++v) {
+		if (exists[v]) {
+			sum += handle(v);
+		}
+	}
+
+	return sum;
+}
+
+template<typename L>
+double StaticGraph::parallelSumForEdges(L handle) const {
+	switch (weighted + 2 * directed + 4 * edgesIndexed) {
+	case 0: // unweighted, undirected, no edge ids
+		return parallelSumForEdgesImpl<false, false, false, L>(handle);
+
+	case 1: // weighted,   undirected, no edge ids
+		return parallelSumForEdgesImpl<false, true, false, L>(handle);
+
+	case 2: // unweighted, directed, no edge ids
+		return parallelSumForEdgesImpl<true, false, false, L>(handle);
+
+	case 3: // weighted,   directed, no edge ids
+		return parallelSumForEdgesImpl<true, true, false, L>(handle);
+
+	case 4: // unweighted, undirected, with edge ids
+		return parallelSumForEdgesImpl<false, false, true, L>(handle);
+
+	case 5: // weighted,   undirected, with edge ids
+		return parallelSumForEdgesImpl<false, true, true, L>(handle);
+
+	case 6: // unweighted, directed, with edge ids
+		return parallelSumForEdgesImpl<true, false, true, L>(handle);
+
+	default: // weighted,   directed, with edge ids
+		return parallelSumForEdgesImpl<true, true, true, L>(handle);
+	}
+}
+
+/* GRAPH SEARCHES */
+
+template<typename L>
+void StaticGraph::BFSfrom(node r, L handle) const {
+	std::vector<bool> marked(z);
+	std::queue<node> q, qNext;
+	count dist = 0;
+	q.push(r);
+	marked[r] = true;
+	do {
+		node u = q.front();
+		q.pop();
+		GraphDetails::callBFSHandle(handle, u, dist);
+		forNeighborsOf(u, [&](node v) {
+			if (!marked[v]) {
+				qNext.push(v);
+				marked[v] = true;
+			}
+		});
+		if (q.empty() && !qNext.empty()) {
+			q.swap(qNext);
+			++dist;
+		}
+	} while (!q.empty());
+}
+
+} /* namespace NetworKit */
+
+#endif /* STATIC_GRAPH_H_ */
@@ -0,0 +1,115 @@
+/*
+ * CompressedGraphBenchmark.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef NOGTEST
+
+#include <algorithm>
+#include <cmath>
+
+#include "CompressedGraphBenchmark.h"
+#include "../CompressedGraph.h"
+#include "../../centrality/PageRank.h"
+#include "../../distance/BFS.h"
+#include "../../auxiliary/Log.h"
+#include "../../auxiliary/Random.h"
+#include "../../auxiliary/Timer.h"
+
+namespace NetworKit {
+
+namespace {
+
+const count benchmarkNodes = 1 << 20;
+const count benchmarkDegree = 16;
+const count repetitions = 5;
+
+template<typename F>
+double medianInMs(F run) {
+	std::vector<double> times;
+	for (index r = 0; r < repetitions; ++r) {
+		Aux::Timer timer;
+		timer.start();
+		run();
+		timer.stop();
+		times.push_back(timer.elapsedMicroseconds() / 1000.0);
+	}
+	std::sort(times.begin(), times.end());
+	return times[repetitions / 2];
+}
+
+} // namespace
+
+Graph CompressedGraphBenchmark::createLocalGraph(count n, count degree, double randomFraction) {
+	Aux::Random::setSeed(42, false);
+	Graph G(n);
+	const count window = 4 * degree;
+	G.forNodes([&](node u) {
+		for (index i = 0; i < degree / 2; ++i) {
+			node v;
+			if (Aux::Random::probability() < randomFraction) {
+				v = Aux::Random::integer(n - 1);
+			} else {
+				v = (u + 1 + Aux::Random::integer(window - 1)) % n;
+			}
+			if (u != v) {
+				G.addEdge(u, v);
+			}
+		}
+	});
+	return G;
+}
+
+TEST_F(CompressedGraphBenchmark, benchBFSAndPageRank) {
+	for (double randomFraction : {0.0, 0.1, 1.0}) {
+		Graph G = createLocalGraph(benchmarkNodes, benchmarkDegree, randomFraction);
+		const count graphBytes = (G.upperNodeIdBound() + 2 * G.numberOfEdges()) * sizeof(node);
+
+		Aux::Timer timer;
+		timer.start();
+		CompressedGraph C(G);
+		timer.stop();
+
+		count reachedG = 0, reachedC = 0;
+		const double bfsG = medianInMs([&]() {
+			BFS bfs(G, 0, false, true);
+			bfs.run();
+			reachedG = bfs.getNodesSortedByDistance().size();
+		});
+		const double bfsC = medianInMs([&]() {
+			BasicBFS<CompressedGraph> bfs(C, 0, false, true);
+			bfs.run();
+			reachedC = bfs.getNodesSortedByDistance().size();
+		});
+		EXPECT_EQ(reachedG, reachedC);
+
+		std::vector<double> rankG, rankC;
+		const double prG = medianInMs([&]() {
+			PageRank pageRank(G);
+			pageRank.run();
+			rankG = pageRank.scores();
+		});
+		const double prC = medianInMs([&]() {
+			BasicPageRank<CompressedGraph> pageRank(C);
+			pageRank.run();
+			rankC = pageRank.scores();
+		});
+		double difference = 0.0;
+		for (index u = 0; u < rankG.size(); ++u) {
+			difference = std::max(difference, std::abs(rankG[u] - rankC[u]));
+		}
+		EXPECT_LT(difference, 1e-12);
+
+		INFO("n = ", G.numberOfNodes(), ", m = ", G.numberOfEdges(), ", random edges: ", randomFraction,
+			", compression: ", timer.elapsedMilliseconds(), " ms");
+		printf("random edges %.1f: adjacency %.1f MB (Graph, ids only) vs %.1f MB (CompressedGraph)\n",
+			randomFraction, graphBytes / 1e6, C.memoryUsage() / 1e6);
+		printf("  BFS:      %8.1f ms vs %8.1f ms\n", bfsG, bfsC);
+		printf("  PageRank: %8.1f ms vs %8.1f ms\n", prG, prC);
+	}
+}
+
+} /* namespace NetworKit */
+
+#endif /* NOGTEST */
@@ -0,0 +1,31 @@
+/*
+ * CompressedGraphBenchmark.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef NOGTEST
+
+#ifndef COMPRESSED_GRAPH_BENCHMARK_H_
+#define COMPRESSED_GRAPH_BENCHMARK_H_
+
+#include <gtest/gtest.h>
+
+#include "../Graph.h"
+
+namespace NetworKit {
+
+class CompressedGraphBenchmark: public testing::Test {
+protected:
+	/**
+	 * Creates a graph with @a n nodes of which most edges connect nodes with close ids, and some
+	 * connect random nodes, as in web graphs or social graphs in a locality preserving order.
+	 */
+	static Graph createLocalGraph(count n, count degree, double randomFraction);
+};
+
+} /* namespace NetworKit */
+
+#endif /* COMPRESSED_GRAPH_BENCHMARK_H_ */
+
+#endif /* NOGTEST */
@@ -0,0 +1,186 @@
+/*
+ * CompressedGraphGTest.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef NOGTEST
+
+#include <algorithm>
+#include <tuple>
+
+#include "CompressedGraphGTest.h"
+#include "../CompressedGraph.h"
+#include "../../auxiliary/Random.h"
+
+namespace NetworKit {
+
+INSTANTIATE_TEST_CASE_P(InstantiationName, CompressedGraphGTest, testing::Values(
+						std::make_tuple(false, false),
+						std::make_tuple(true, false),
+						std::make_tuple(false, true),
+						std::make_tuple(true, true)));
+
+bool CompressedGraphGTest::isWeighted() const {
+	return std::get<0>(GetParam());
+}
+
+bool CompressedGraphGTest::isDirected() const {
+	return std::get<1>(GetParam());
+}
+
+Graph CompressedGraphGTest::createRandomGraph(count n, double p) const {
+	Aux::Random::setSeed(42, false);
+	Graph G(n, isWeighted(), isDirected());
+	G.forNodes([&](node u) {
+		G.forNodes([&](node v) {
+			if ((isDirected() || u <= v) && Aux::Random::probability() < p) {
+				G.addEdge(u, v, Aux::Random::probability());
+			}
+		});
+	});
+	return G;
+}
+
+TEST_P(CompressedGraphGTest, testNeighborsAreSorted) {
+	Graph G = createRandomGraph(100, 0.1);
+	CompressedGraph C(G);
+
+	G.forNodes([&](node u) {
+		std::vector<std::pair<node, edgeweight>> expected, actual;
+		G.forEdgesOf(u, [&](node, node v, edgeweight ew) {
+			expected.emplace_back(v, ew);
+		});
+		C.forEdgesOf(u, [&](node, node v, edgeweight ew) {
+			actual.emplace_back(v, ew);
+		});
+		std::sort(expected.begin(), expected.end());
+		EXPECT_EQ(expected, actual);
+
+		expected.clear();
+		actual.clear();
+		G.forInEdgesOf(u, [&](node, node v, edgeweight ew) {
+			expected.emplace_back(v, ew);
+		});
+		C.forInEdgesOf(u, [&](node, node v, edgeweight ew) {
+			actual.emplace_back(v, ew);
+		});
+		std::sort(expected.begin(), expected.end());
+		EXPECT_EQ(expected, actual);
+	});
+}
+
+TEST_P(CompressedGraphGTest, testLargeGaps) {
+	// gaps and negative first deltas that need several bytes
+	Graph G(1 << 20, isWeighted(), isDirected());
+	const node last = G.upperNodeIdBound() - 1;
+	G.addEdge(last, 0, 0.5);
+	G.addEdge(last, 1 << 14, 2.0);
+	G.addEdge(1, last, 3.0);
+	G.addEdge(1 << 7, 1 << 7);
+	CompressedGraph C(G);
+
+	EXPECT_TRUE(C.hasEdge(last, 0));
+	EXPECT_TRUE(C.hasEdge(last, 1 << 14));
+	EXPECT_TRUE(C.hasEdge(1, last));
+	EXPECT_TRUE(C.hasEdge(1 << 7, 1 << 7));
+	EXPECT_FALSE(C.hasEdge(last, 2));
+	EXPECT_EQ(G.numberOfSelfLoops(), C.numberOfSelfLoops());
+	EXPECT_NEAR(G.totalEdgeWeight(), C.totalEdgeWeight(), 1e-9);
+
+	count edges = 0;
+	C.forEdges([&](node u, node v, edgeweight ew) {
+		EXPECT_TRUE(G.hasEdge(u, v));
+		EXPECT_EQ(G.weight(u, v), ew);
+		edges++;
+	});
+	EXPECT_EQ(G.numberOfEdges(), edges);
+}
+
+TEST_P(CompressedGraphGTest, testVarintBoundaries) {
+	const node u = 1 << 15;
+	// the first neighbor of u is stored as zigzag(d) = 2d and u as the first neighbor of u + d as zigzag(-d) = 2d - 1
+	auto sizeWithDelta = [&](node d) {
+		Graph G(1 << 16, isWeighted(), isDirected());
+		G.addEdge(u, u + d);
+		CompressedGraph C(G);
+		EXPECT_TRUE(C.hasEdge(u, u + d));
+		EXPECT_EQ(!isDirected(), C.hasEdge(u + d, u));
+		C.forInNeighborsOf(u + d, [&](node v) {
+			EXPECT_EQ(u, v);
+		});
+		return C.memoryUsage();
+	};
+	EXPECT_EQ(sizeWithDelta(1), sizeWithDelta(63));
+	EXPECT_EQ(sizeWithDelta(63) + 1, sizeWithDelta(64));
+	EXPECT_EQ(sizeWithDelta(64) + 1, sizeWithDelta(65));
+	EXPECT_EQ(sizeWithDelta(8191) + 1, sizeWithDelta(8192));
+	EXPECT_EQ(sizeWithDelta(8192) + 1, sizeWithDelta(8193));
+
+	// the gap between the neighbors of u is stored as is, the zigzag deltas take 3 bytes for all gaps
+	const node first = u + 10000;
+	auto sizeWithGap = [&](node gap) {
+		Graph G(1 << 16, isWeighted(), isDirected());
+		G.addEdge(u, first, 1.0);
+		G.addEdge(u, first + gap, 2.0);
+		CompressedGraph C(G);
+		std::vector<std::pair<node, edgeweight>> neighbors;
+		C.forEdgesOf(u, [&](node, node v, edgeweight ew) {
+			neighbors.emplace_back(v, ew);
+		});
+		std::vector<std::pair<node, edgeweight>> expected {{first, 1.0}, {first + gap, isWeighted() ? 2.0 : 1.0}};
+		EXPECT_EQ(expected, neighbors);
+		return C.memoryUsage();
+	};
+	EXPECT_EQ(sizeWithGap(1), sizeWithGap(127));
+	EXPECT_EQ(sizeWithGap(127) + 1, sizeWithGap(128));
+	EXPECT_EQ(sizeWithGap(16383) + 1, sizeWithGap(16384));
+}
+
+TEST_P(CompressedGraphGTest, testDeletedNodesAtTheEnds) {
+	// deleted nodes are stored as empty lists, also at both ends of the id range
+	Graph G = createRandomGraph(50, 0.2);
+	const node last = G.upperNodeIdBound() - 1;
+	for (node x : {node(0), node(1), last}) {
+		std::vector<std::pair<node, node>> toRemove;
+		G.forEdges([&](node u, node v) {
+			if (u == x || v == x) {
+				toRemove.emplace_back(u, v);
+			}
+		});
+		for (auto e : toRemove) {
+			G.removeEdge(e.first, e.second);
+		}
+		G.removeNode(x);
+	}
+	CompressedGraph C(G);
+
+	EXPECT_EQ(G.upperNodeIdBound(), C.upperNodeIdBound());
+	EXPECT_EQ(G.numberOfNodes(), C.numberOfNodes());
+	for (node x : {node(0), node(1), last}) {
+		EXPECT_FALSE(C.hasNode(x));
+		EXPECT_EQ(0u, C.degree(x));
+		EXPECT_EQ(0u, C.degreeIn(x));
+	}
+	C.forNodes([&](node u) {
+		EXPECT_TRUE(G.hasNode(u));
+		std::vector<std::pair<node, edgeweight>> expected, actual;
+		G.forEdgesOf(u, [&](node, node v, edgeweight ew) {
+			expected.emplace_back(v, ew);
+		});
+		C.forEdgesOf(u, [&](node, node v, edgeweight ew) {
+			actual.emplace_back(v, ew);
+		});
+		std::sort(expected.begin(), expected.end());
+		EXPECT_EQ(expected, actual);
+	});
+
+	Graph H = C.toGraph();
+	EXPECT_EQ(G.numberOfNodes(), H.numberOfNodes());
+	EXPECT_FALSE(H.hasNode(0));
+	EXPECT_FALSE(H.hasNode(last));
+}
+
+} /* namespace NetworKit */
+
+#endif /* NOGTEST */
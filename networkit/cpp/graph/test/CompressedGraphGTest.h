@@ -0,0 +1,30 @@
+/*
+ * CompressedGraphGTest.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef NOGTEST
+
+#ifndef COMPRESSED_GRAPH_GTEST_H_
+#define COMPRESSED_GRAPH_GTEST_H_
+
+#include <tuple>
+#include <gtest/gtest.h>
+
+#include "../Graph.h"
+
+namespace NetworKit {
+
+class CompressedGraphGTest: public testing::TestWithParam< std::tuple<bool, bool> > {
+protected:
+	bool isWeighted() const;
+	bool isDirected() const;
+	Graph createRandomGraph(count n, double p) const;
+};
+
+} /* namespace NetworKit */
+
+#endif /* COMPRESSED_GRAPH_GTEST_H_ */
+
+#endif /* NOGTEST */
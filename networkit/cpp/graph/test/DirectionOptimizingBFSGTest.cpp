@@ -0,0 +1,102 @@
+/*
+ * DirectionOptimizingBFSGTest.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef NOGTEST
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <tuple>
+
+#include "DirectionOptimizingBFSGTest.h"
+#include "../DirectionOptimizingBFS.h"
+#include "../../auxiliary/Random.h"
+
+namespace NetworKit {
+
+// alpha = 0 never switches to bottom-up steps, alpha = infinity always does
+INSTANTIATE_TEST_CASE_P(InstantiationName, DirectionOptimizingBFSGTest, testing::Combine(
+						testing::Bool(),
+						testing::Values(15.0, 0.0, std::numeric_limits<double>::infinity()),
+						testing::Values(std::make_pair(count(700), 0.01), std::make_pair(count(300), 0.005))));
+
+void DirectionOptimizingBFSGTest::SetUp() {
+	const count n = std::get<2>(GetParam()).first;
+	const double p = std::get<2>(GetParam()).second;
+	Aux::Random::setSeed(42, false);
+	G = Graph(n, false, std::get<0>(GetParam()));
+	G.forNodes([&](node u) {
+		G.forNodes([&](node v) {
+			if (u != v && Aux::Random::probability() < p) {
+				G.addEdge(u, v);
+			}
+		});
+	});
+	// some unreachable nodes and holes in the node ids
+	for (node u = 0; u < n; u += 97) {
+		G.removeNode(u);
+	}
+	G.addNode();
+}
+
+double DirectionOptimizingBFSGTest::alpha() const {
+	return std::get<1>(GetParam());
+}
+
+TEST_P(DirectionOptimizingBFSGTest, testDistances) {
+	DirectionOptimizingBFS bfs(G, alpha());
+
+	// repeated runs must not be affected by the previous ones
+	const node middle = G.upperNodeIdBound() / 2;
+	for (node source : {node(1), middle, node(1)}) {
+		bfs.run(source);
+
+		std::vector<count> expected(G.upperNodeIdBound(), none);
+		G.BFSfrom(source, [&](node v, count dist) {
+			expected[v] = dist;
+		});
+		G.forNodes([&](node v) {
+			EXPECT_EQ(expected[v], bfs.distance(v));
+		});
+
+		const std::vector<count>& levelSizes = bfs.getLevelSizes();
+		count maxDist = *std::max_element(expected.begin(), expected.end(), [](count a, count b) {
+			return b != none && (a == none || a < b);
+		});
+		EXPECT_EQ(maxDist, bfs.maxDistance());
+		EXPECT_EQ(maxDist, bfs.distance(bfs.farthestNode()));
+		EXPECT_EQ(bfs.numberOfReachedNodes(), std::accumulate(levelSizes.begin(), levelSizes.end(), count(0)));
+		for (count dist = 0; dist <= maxDist; ++dist) {
+			EXPECT_EQ(static_cast<count>(std::count(expected.begin(), expected.end(), dist)), levelSizes[dist]);
+		}
+
+		if (alpha() == 0) {
+			EXPECT_EQ(0u, bfs.numberOfBottomUpSteps());
+		} else if (alpha() == std::numeric_limits<double>::infinity()) {
+			EXPECT_EQ(maxDist + 1, bfs.numberOfBottomUpSteps());
+		}
+	}
+}
+
+TEST_P(DirectionOptimizingBFSGTest, testMultipleSources) {
+	const count z = G.upperNodeIdBound();
+	std::vector<node> sources = {1, 2, z / 2, z - 2};
+	DirectionOptimizingBFS bfs(G, alpha());
+	bfs.run(sources);
+
+	std::vector<count> expected(G.upperNodeIdBound(), none);
+	G.BFSfrom(sources, [&](node v, count dist) {
+		expected[v] = dist;
+	});
+	G.forNodes([&](node v) {
+		EXPECT_EQ(expected[v], bfs.distance(v));
+	});
+	EXPECT_EQ(sources.size(), bfs.getLevelSizes()[0]);
+}
+
+} /* namespace NetworKit */
+
+#endif /* NOGTEST */
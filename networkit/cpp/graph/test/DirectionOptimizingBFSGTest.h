@@ -0,0 +1,37 @@
+/*
+ * DirectionOptimizingBFSGTest.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef NOGTEST
+
+#ifndef DIRECTION_OPTIMIZING_BFS_GTEST_H_
+#define DIRECTION_OPTIMIZING_BFS_GTEST_H_
+
+#include <tuple>
+#include <utility>
+#include <gtest/gtest.h>
+
+#include "../Graph.h"
+
+namespace NetworKit {
+
+/**
+ * Parameters: whether the graph is directed, the alpha of the direction switching heuristic and the number
+ * of nodes and edge probability of the random graph the tests run on.
+ */
+class DirectionOptimizingBFSGTest: public testing::TestWithParam< std::tuple<bool, double, std::pair<count, double> > > {
+protected:
+	void SetUp() override;
+
+	double alpha() const;
+
+	Graph G;
+};
+
+} /* namespace NetworKit */
+
+#endif /* DIRECTION_OPTIMIZING_BFS_GTEST_H_ */
+
+#endif /* NOGTEST */
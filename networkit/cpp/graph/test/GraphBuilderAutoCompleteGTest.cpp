@@ -10,6 +10,7 @@
 #include <algorithm>
 
 #include "GraphBuilderAutoCompleteGTest.h"
+#include "GraphTestUtils.h"
 #include "../../auxiliary/Random.h"
 #include "../../auxiliary/Parallel.h"
 
@@ -398,6 +399,54 @@ TEST_P(GraphBuilderAutoCompleteGTest, testSameAsGraph) {
 	}
 }
 
+TEST_P(GraphBuilderAutoCompleteGTest, testSortAndDeduplicate) {
+	// add every edge of the house a second time with a larger weight, for undirected graphs
+	// in the other direction, and a self loop three times
+	auto b = createGraphBuilder(n_house);
+	std::vector< std::vector<node> > neighbors(n_house);
+	std::vector< std::vector<edgeweight> > weights(n_house);
+	for (auto& e : houseEdgesOut) {
+		node u = e.first;
+		node v = e.second;
+		neighbors[u].push_back(v);
+		weights[u].push_back(Ahouse[u][v]);
+		node w = isDirected() ? u : v;
+		neighbors[w].push_back(u + v - w);
+		weights[w].push_back(Ahouse[u][v] + 1.0);
+	}
+	for (index i = 0; i < 3; i++) {
+		neighbors[2].push_back(2);
+		weights[2].push_back(3.0 - i);
+	}
+	for (node u = 0; u < n_house; u++) {
+		b.swapNeighborhood(u, neighbors[u], weights[u], u == 2);
+	}
+
+	Graph G = b.toGraph(true, useParallel(), true);
+
+	EXPECT_EQ(m_house + 1, G.numberOfEdges());
+	EXPECT_EQ(1u, G.numberOfSelfLoops());
+	for (auto& e : houseEdgesOut) {
+		EXPECT_EQ(isWeighted() ? Ahouse[e.first][e.second] : defaultEdgeWeight, G.weight(e.first, e.second));
+	}
+	EXPECT_EQ(isWeighted() ? 1.0 : defaultEdgeWeight, G.weight(2, 2));
+
+	G.forNodes([&](node u) {
+		std::vector<node> neighbors;
+		G.forNeighborsOf(u, [&](node v) {
+			neighbors.push_back(v);
+		});
+		EXPECT_TRUE(std::is_sorted(neighbors.begin(), neighbors.end()));
+		EXPECT_EQ(neighbors.size(), G.degree(u));
+		std::vector<node> inNeighbors;
+		G.forInNeighborsOf(u, [&](node v) {
+			inNeighbors.push_back(v);
+		});
+		EXPECT_TRUE(std::is_sorted(inNeighbors.begin(), inNeighbors.end()));
+		EXPECT_EQ(inNeighbors.size(), G.degreeIn(u));
+	});
+}
+
 TEST_P(GraphBuilderAutoCompleteGTest, testForValidStateAfterToGraph) {
 	Graph Ghouse = toGraph(this->bHouse);
 
@@ -436,6 +485,35 @@ TEST_P(GraphBuilderAutoCompleteGTest, testForValidStateAfterToGraph) {
 	}
 }
 
+TEST_P(GraphBuilderAutoCompleteGTest, testDeterministicAdjacencies) {
+	const count n = 500;
+	Aux::Random::setSeed(42, false);
+	std::vector<std::vector<node> > halfEdges(n);
+	for (node u = 0; u < n; u++) {
+		// a few nodes of high degree, multi edges and self loops
+		const count degree = (u % 50 == 0) ? 200 : Aux::Random::integer(8);
+		for (index i = 0; i < degree; i++) {
+			halfEdges[u].push_back(Aux::Random::integer(n - 1));
+		}
+	}
+
+	auto build = [&](bool parallel) {
+		GraphBuilder b = createGraphBuilder(n);
+		b.parallelForNodes([&](node u) {
+			for (index i = 0; i < halfEdges[u].size(); i++) {
+				b.addHalfOutEdge(u, halfEdges[u][i], 1.0 + i);
+			}
+		});
+		return b.toGraph(true, parallel);
+	};
+	using GraphTestUtils::adjacencies;
+
+	// two builds from the same input have the same order of neighbors, also the same as a sequential build
+	const auto first = adjacencies(build(useParallel()));
+	EXPECT_EQ(first, adjacencies(build(useParallel())));
+	EXPECT_EQ(first, adjacencies(build(false)));
+}
+
 /** NODE ITERATORS **/
 
 TEST_P(GraphBuilderAutoCompleteGTest, testForNodes) {
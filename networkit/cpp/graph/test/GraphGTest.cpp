@@ -227,6 +227,30 @@ TEST_P(GraphGTest, testGetId) {
 	ASSERT_TRUE(G1.getId() < G2.getId());
 }
 
+TEST_P(GraphGTest, testNodeIdWidth) {
+	// fails if a build configured with NETWORKIT_NODE32 still uses 64 bit node ids
+#ifdef NETWORKIT_NODE32
+	ASSERT_EQ(4u, sizeof(node));
+#else
+	ASSERT_EQ(8u, sizeof(node));
+#endif
+	// none has to survive the conversion to an index, e.g. in a Partition
+	const index widened = none;
+	ASSERT_EQ(none, widened);
+	// edge ids and other indices stay 64 bit and have their own sentinel, so 2^32 - 1 is a valid edge id
+	ASSERT_EQ(8u, sizeof(edgeid));
+	const edgeid largeId = (edgeid(1) << 32) - 1;
+	ASSERT_NE(noneIndex, largeId);
+
+	Graph G = createGraph(3);
+	G.addEdge(0, 2);
+	std::vector<node> neighbors;
+	G.forNeighborsOf(0, [&](node v) {
+		neighbors.push_back(v);
+	});
+	ASSERT_EQ(std::vector<node>({2}), neighbors);
+}
+
 TEST_P(GraphGTest, testTyp) {
 	Graph G = createGraph();
 	if (isGraph()) {
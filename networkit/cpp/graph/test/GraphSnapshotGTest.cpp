@@ -0,0 +1,217 @@
+/*
+ * GraphSnapshotGTest.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef NOGTEST
+
+#include <algorithm>
+
+#include "GraphSnapshotGTest.h"
+#include "../CompressedGraph.h"
+#include "../StaticGraph.h"
+#include "../../auxiliary/Random.h"
+#include "../../centrality/PageRank.h"
+#include "../../distance/BFS.h"
+#include "../../distance/Dijkstra.h"
+
+namespace NetworKit {
+
+using SnapshotTypes = testing::Types<StaticGraph, CompressedGraph>;
+TYPED_TEST_CASE(GraphSnapshotGTest, SnapshotTypes);
+
+template<typename GraphType>
+std::vector<Graph> GraphSnapshotGTest<GraphType>::createRandomGraphs(count n, double p) const {
+	std::vector<Graph> graphs;
+	for (bool directed : {false, true}) {
+		for (bool weighted : {false, true}) {
+			Aux::Random::setSeed(42, false);
+			Graph G(n, weighted, directed);
+			G.forNodes([&](node u) {
+				G.forNodes([&](node v) {
+					if ((directed || u <= v) && Aux::Random::probability() < p) {
+						G.addEdge(u, v, Aux::Random::probability());
+					}
+				});
+			});
+			graphs.push_back(std::move(G));
+		}
+	}
+	return graphs;
+}
+
+namespace {
+
+std::vector<node> sorted(std::vector<node> nodes) {
+	std::sort(nodes.begin(), nodes.end());
+	return nodes;
+}
+
+} // namespace
+
+TYPED_TEST(GraphSnapshotGTest, testBasicProperties) {
+	for (const Graph& G : this->createRandomGraphs(100, 0.1)) {
+		SCOPED_TRACE(G.toString());
+		TypeParam S(G);
+
+		EXPECT_EQ(G.numberOfNodes(), S.numberOfNodes());
+		EXPECT_EQ(G.numberOfEdges(), S.numberOfEdges());
+		EXPECT_EQ(G.numberOfSelfLoops(), S.numberOfSelfLoops());
+		EXPECT_EQ(G.upperNodeIdBound(), S.upperNodeIdBound());
+		EXPECT_EQ(G.isWeighted(), S.isWeighted());
+		EXPECT_EQ(G.isDirected(), S.isDirected());
+		EXPECT_NEAR(G.totalEdgeWeight(), S.totalEdgeWeight(), 1e-9);
+
+		G.forNodes([&](node u) {
+			EXPECT_EQ(G.degree(u), S.degree(u));
+			EXPECT_EQ(G.degreeIn(u), S.degreeIn(u));
+			EXPECT_NEAR(G.weightedDegree(u), S.weightedDegree(u), 1e-9);
+			G.forNodes([&](node v) {
+				EXPECT_EQ(G.hasEdge(u, v), S.hasEdge(u, v));
+			});
+		});
+	}
+}
+
+TYPED_TEST(GraphSnapshotGTest, testEdgeIterators) {
+	for (const Graph& G : this->createRandomGraphs(200, 0.05)) {
+		SCOPED_TRACE(G.toString());
+		TypeParam S(G);
+
+		std::vector<std::pair<node, node>> expected, actual;
+		G.forEdges([&](node u, node v) {
+			expected.emplace_back(u, v);
+		});
+		S.forEdges([&](node u, node v) {
+			actual.emplace_back(u, v);
+		});
+		std::sort(expected.begin(), expected.end());
+		std::sort(actual.begin(), actual.end());
+		EXPECT_EQ(expected, actual);
+
+		count edges = 0;
+		S.parallelForEdges([&](node, node) {
+			#pragma omp atomic
+			edges++;
+		});
+		EXPECT_EQ(G.numberOfEdges(), edges);
+
+		double sum = S.parallelSumForEdges([](node, node, edgeweight ew) {
+			return ew;
+		});
+		EXPECT_NEAR(G.totalEdgeWeight(), sum, 1e-9);
+	}
+}
+
+TYPED_TEST(GraphSnapshotGTest, testDeletedNodesAndEdges) {
+	for (Graph G : this->createRandomGraphs(50, 0.2)) {
+		SCOPED_TRACE(G.toString());
+		std::vector<std::pair<node, node>> toRemove;
+		G.forEdges([&](node u, node v) {
+			if ((u + v) % 3 == 0 || u == 7 || v == 7) {
+				toRemove.emplace_back(u, v);
+			}
+		});
+		for (auto e : toRemove) {
+			G.removeEdge(e.first, e.second);
+		}
+		G.removeNode(7);
+
+		TypeParam S(G);
+		EXPECT_FALSE(S.hasNode(7));
+		EXPECT_EQ(G.numberOfNodes(), S.numberOfNodes());
+		EXPECT_EQ(G.numberOfEdges(), S.numberOfEdges());
+
+		count edges = 0;
+		S.forEdges([&](node u, node v) {
+			EXPECT_TRUE(G.hasEdge(u, v));
+			edges++;
+		});
+		EXPECT_EQ(G.numberOfEdges(), edges);
+
+		Graph H = S.toGraph();
+		EXPECT_EQ(G.numberOfNodes(), H.numberOfNodes());
+		EXPECT_EQ(G.numberOfEdges(), H.numberOfEdges());
+		G.forEdges([&](node u, node v, edgeweight ew) {
+			EXPECT_TRUE(H.hasEdge(u, v));
+			EXPECT_EQ(ew, H.weight(u, v));
+		});
+	}
+}
+
+TYPED_TEST(GraphSnapshotGTest, testBFSfrom) {
+	for (const Graph& G : this->createRandomGraphs(100, 0.03)) {
+		SCOPED_TRACE(G.toString());
+		TypeParam S(G);
+
+		std::vector<count> expected(G.upperNodeIdBound(), none), actual(G.upperNodeIdBound(), none);
+		G.BFSfrom(0, [&](node u, count dist) {
+			expected[u] = dist;
+		});
+		S.BFSfrom(0, [&](node u, count dist) {
+			actual[u] = dist;
+		});
+		EXPECT_EQ(expected, actual);
+	}
+}
+
+TYPED_TEST(GraphSnapshotGTest, testBFS) {
+	for (const Graph& G : this->createRandomGraphs(200, 0.02)) {
+		SCOPED_TRACE(G.toString());
+		TypeParam S(G);
+
+		BFS bfsG(G, 0, true, true);
+		bfsG.run();
+		BasicBFS<TypeParam> bfsS(S, 0, true, true);
+		bfsS.run();
+
+		// a CompressedGraph visits the neighbors in another order, so only the sets of predecessors match
+		EXPECT_EQ(sorted(bfsG.getNodesSortedByDistance(false)), sorted(bfsS.getNodesSortedByDistance(false)));
+		G.forNodes([&](node u) {
+			EXPECT_EQ(bfsG.distance(u), bfsS.distance(u));
+			EXPECT_EQ(sorted(bfsG.getPredecessors(u)), sorted(bfsS.getPredecessors(u)));
+			EXPECT_EQ(bfsG.numberOfPaths(u), bfsS.numberOfPaths(u));
+		});
+	}
+}
+
+TYPED_TEST(GraphSnapshotGTest, testDijkstra) {
+	for (const Graph& G : this->createRandomGraphs(200, 0.02)) {
+		SCOPED_TRACE(G.toString());
+		TypeParam S(G);
+
+		Dijkstra dijkstraG(G, 0, true, true);
+		dijkstraG.run();
+		BasicDijkstra<TypeParam> dijkstraS(S, 0, true, true);
+		dijkstraS.run();
+
+		EXPECT_EQ(sorted(dijkstraG.getNodesSortedByDistance(false)), sorted(dijkstraS.getNodesSortedByDistance(false)));
+		G.forNodes([&](node u) {
+			EXPECT_EQ(dijkstraG.distance(u), dijkstraS.distance(u));
+			EXPECT_EQ(sorted(dijkstraG.getPredecessors(u)), sorted(dijkstraS.getPredecessors(u)));
+		});
+	}
+}
+
+TYPED_TEST(GraphSnapshotGTest, testPageRank) {
+	for (const Graph& G : this->createRandomGraphs(200, 0.02)) {
+		SCOPED_TRACE(G.toString());
+		TypeParam S(G);
+
+		PageRank pageRankG(G);
+		pageRankG.run();
+		BasicPageRank<TypeParam> pageRankS(S);
+		pageRankS.run();
+
+		// the scores are summed up in another order and normalized with a parallel sum
+		G.forNodes([&](node u) {
+			EXPECT_NEAR(pageRankG.score(u), pageRankS.score(u), 1e-12);
+		});
+		EXPECT_EQ(pageRankG.ranking().size(), pageRankS.ranking().size());
+	}
+}
+
+} /* namespace NetworKit */
+
+#endif /* NOGTEST */
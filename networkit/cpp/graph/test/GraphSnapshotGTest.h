@@ -0,0 +1,37 @@
+/*
+ * GraphSnapshotGTest.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef NOGTEST
+
+#ifndef GRAPH_SNAPSHOT_GTEST_H_
+#define GRAPH_SNAPSHOT_GTEST_H_
+
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "../Graph.h"
+
+namespace NetworKit {
+
+/**
+ * Tests shared by the immutable snapshots of a Graph, i.e. StaticGraph and CompressedGraph, which are
+ * compared to the Graph they are created from.
+ */
+template<typename GraphType>
+class GraphSnapshotGTest: public testing::Test {
+protected:
+	/**
+	 * @return Random graphs with @a n nodes and edge probability @a p, one for each combination of
+	 * weighted and directed.
+	 */
+	std::vector<Graph> createRandomGraphs(count n, double p) const;
+};
+
+} /* namespace NetworKit */
+
+#endif /* GRAPH_SNAPSHOT_GTEST_H_ */
+
+#endif /* NOGTEST */
@@ -0,0 +1,76 @@
+/*
+ * GraphTestUtils.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef NOGTEST
+
+#ifndef GRAPH_TEST_UTILS_H_
+#define GRAPH_TEST_UTILS_H_
+
+#include <utility>
+#include <vector>
+#include <omp.h>
+
+#include "../Graph.h"
+
+namespace NetworKit {
+
+/**
+ * Helpers for tests that check that a result does not depend on the number of threads.
+ */
+namespace GraphTestUtils {
+
+/**
+ * Sets the number of OpenMP threads and restores the previous number when it goes out of scope.
+ */
+class ScopedNumThreads {
+public:
+	explicit ScopedNumThreads(int threads) : previous(omp_get_max_threads()) {
+		omp_set_num_threads(threads);
+	}
+
+	~ScopedNumThreads() {
+		omp_set_num_threads(previous);
+	}
+
+private:
+	const int previous;
+};
+
+/**
+ * @return The result of @a f, called with @a threads OpenMP threads.
+ */
+template<typename F>
+auto withThreads(int threads, F f) -> decltype(f()) {
+	ScopedNumThreads scope(threads);
+	return f();
+}
+
+/**
+ * @return For every node of @a G its neighbors with the weights of the edges in the order in which @a G
+ * visits them; for directed graphs the in-neighbors follow the out-neighbors.
+ */
+inline std::vector<std::vector<std::pair<node, edgeweight> > > adjacencies(const Graph& G) {
+	std::vector<std::vector<std::pair<node, edgeweight> > > edges(G.upperNodeIdBound());
+	G.forNodes([&](node u) {
+		G.forEdgesOf(u, [&](node, node v, edgeweight w) {
+			edges[u].emplace_back(v, w);
+		});
+		if (G.isDirected()) {
+			G.forInEdgesOf(u, [&](node, node v, edgeweight w) {
+				edges[u].emplace_back(v, w);
+			});
+		}
+	});
+	return edges;
+}
+
+} /* namespace GraphTestUtils */
+
+} /* namespace NetworKit */
+
+#endif /* GRAPH_TEST_UTILS_H_ */
+
+#endif /* NOGTEST */
@@ -0,0 +1,88 @@
+/*
+ * StaticGraphGTest.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef NOGTEST
+
+#include <tuple>
+
+#include "StaticGraphGTest.h"
+#include "../StaticGraph.h"
+#include "../../auxiliary/Random.h"
+
+namespace NetworKit {
+
+INSTANTIATE_TEST_CASE_P(InstantiationName, StaticGraphGTest, testing::Values(
+						std::make_tuple(false, false),
+						std::make_tuple(true, false),
+						std::make_tuple(false, true),
+						std::make_tuple(true, true)));
+
+bool StaticGraphGTest::isWeighted() const {
+	return std::get<0>(GetParam());
+}
+
+bool StaticGraphGTest::isDirected() const {
+	return std::get<1>(GetParam());
+}
+
+Graph StaticGraphGTest::createRandomGraph(count n, double p) const {
+	Aux::Random::setSeed(42, false);
+	Graph G(n, isWeighted(), isDirected());
+	G.forNodes([&](node u) {
+		G.forNodes([&](node v) {
+			if ((isDirected() || u <= v) && Aux::Random::probability() < p) {
+				G.addEdge(u, v, Aux::Random::probability());
+			}
+		});
+	});
+	return G;
+}
+
+TEST_P(StaticGraphGTest, testNeighborOrderIsPreserved) {
+	Graph G = createRandomGraph(100, 0.1);
+	G.indexEdges();
+	StaticGraph S(G);
+	EXPECT_TRUE(S.hasEdgeIds());
+
+	G.forNodes([&](node u) {
+		std::vector<std::tuple<node, edgeweight, edgeid>> expected, actual;
+		G.forEdgesOf(u, [&](node, node v, edgeweight ew, edgeid eid) {
+			expected.emplace_back(v, ew, eid);
+		});
+		S.forEdgesOf(u, [&](node, node v, edgeweight ew, edgeid eid) {
+			actual.emplace_back(v, ew, eid);
+		});
+		EXPECT_EQ(expected, actual);
+
+		expected.clear();
+		actual.clear();
+		G.forInEdgesOf(u, [&](node, node v, edgeweight ew, edgeid eid) {
+			expected.emplace_back(v, ew, eid);
+		});
+		S.forInEdgesOf(u, [&](node, node v, edgeweight ew, edgeid eid) {
+			actual.emplace_back(v, ew, eid);
+		});
+		EXPECT_EQ(expected, actual);
+	});
+}
+
+TEST_P(StaticGraphGTest, testEdgeOrderIsPreserved) {
+	Graph G = createRandomGraph(200, 0.05);
+	StaticGraph S(G);
+
+	std::vector<std::pair<node, node>> expected, actual;
+	G.forEdges([&](node u, node v) {
+		expected.emplace_back(u, v);
+	});
+	S.forEdges([&](node u, node v) {
+		actual.emplace_back(u, v);
+	});
+	EXPECT_EQ(expected, actual);
+}
+
+} /* namespace NetworKit */
+
+#endif /* NOGTEST */
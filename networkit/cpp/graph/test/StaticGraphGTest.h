@@ -0,0 +1,30 @@
+/*
+ * StaticGraphGTest.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef NOGTEST
+
+#ifndef STATIC_GRAPH_GTEST_H_
+#define STATIC_GRAPH_GTEST_H_
+
+#include <tuple>
+#include <gtest/gtest.h>
+
+#include "../Graph.h"
+
+namespace NetworKit {
+
+class StaticGraphGTest: public testing::TestWithParam< std::tuple<bool, bool> > {
+protected:
+	bool isWeighted() const;
+	bool isDirected() const;
+	Graph createRandomGraph(count n, double p) const;
+};
+
+} /* namespace NetworKit */
+
+#endif /* STATIC_GRAPH_GTEST_H_ */
+
+#endif /* NOGTEST */
@@ -6,17 +6,26 @@
  */
 
 #include "DotGraphWriter.h"
+#include "ParallelTextWriter.h"
 
 namespace NetworKit {
 
 void DotGraphWriter::write(Graph& graph, std::string path) const {
-	std::ofstream file{path};
-	
-	file << "graph {\n";
-	graph.forEdges([&](node u, node v){
-		file << u << " -- " << v << ";\n";
+	ParallelTextWriter file(path);
+
+	file.write("graph {\n");
+	// same order as forEdges()
+	file.writeItems(graph.upperNodeIdBound(), [&](node u, std::string& buffer) {
+		graph.forNeighborsOf(u, [&](node v) {
+			if (!graph.isDirected() && v > u) return;
+			ParallelTextWriter::appendInteger(buffer, u);
+			buffer += " -- ";
+			ParallelTextWriter::appendInteger(buffer, v);
+			buffer += ";\n";
+		});
 	});
-	file << "}\n";
+	file.write("}\n");
+	file.close();
 }
 
 } /* namespace NetworKit */
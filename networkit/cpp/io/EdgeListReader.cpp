@@ -6,8 +6,15 @@
  */
 
 #include "EdgeListReader.h"
+#include "MemoryMappedFile.h"
+#include "TextChunks.h"
 #include "../auxiliary/Log.h"
+#include "../auxiliary/NumberParsing.h"
+#include "../graph/GraphBuilder.h"
 
+#include <algorithm>
+#include <cstring>
+#include <omp.h>
 #include <sstream>
 
 #include "../auxiliary/Enforce.h"
@@ -37,109 +44,187 @@ std::map<std::string,node> EdgeListReader::getNodeMap() {
 }
 
 Graph EdgeListReader::readContinuous(const std::string& path) {
-	std::ifstream file(path);
-	Aux::enforceOpened(file);
-	std::string line; // the current line
+	MemoryMappedFile file(path);
+	const char* begin = file.cbegin();
+	const char* end = file.cend();
+
+	DEBUG("separator: " , this->separator);
+	DEBUG("first node: " , this->firstNode);
 
-	// read file once to get to the last line and figure out the number of nodes
-	// unfortunately there is an empty line at the ending of the file, so we need to get the line before that
+	auto isComment = [&](const char* lineBegin, const char* lineEnd) {
+		return static_cast<count>(lineEnd - lineBegin) >= commentPrefix.length()
+			&& std::equal(commentPrefix.begin(), commentPrefix.end(), lineBegin);
+	};
 
-	node maxNode = 0;
+	auto malformed = [&](const char* lineBegin, const char* lineEnd) {
+		std::stringstream message;
+		message << "malformed line ";
+		message << TextChunks::lineNumber(begin, lineBegin) << ": ";
+		message << std::string(lineBegin, lineEnd);
+		return std::runtime_error(message.str());
+	};
+
+	// the first edge decides whether the graph is weighted
 	bool weighted = false;
-	bool checkedWeighted = false;
+	for (const char* it = begin; it != end;) {
+		const char* lineBreak = static_cast<const char*>(std::memchr(it, '\n', end - it));
+		const char* lineEnd = lineBreak ? lineBreak : end;
+		if (lineEnd != it && lineEnd[-1] == '\r') {
+			--lineEnd;
+		}
+		if (lineEnd != it && !isComment(it, lineEnd)) {
+			if (Aux::StringTools::split(it, lineEnd, separator).size() == 3) {
+				INFO("Identified graph as weighted.");
+				weighted = true;
+			}
+			break;
+		}
+		it = lineBreak ? lineBreak + 1 : end;
+	}
 
-	DEBUG("separator: " , this->separator);
-	DEBUG("first node: " , this->firstNode);
+	struct ParsedEdge {
+		node u, v;
+		edgeweight weight;
+	};
 
-	// first find out the maximum node id
-	DEBUG("first pass");
-	count i = 0;
-	while (file.good()) {
-		++i;
-		std::getline(file, line);
-		TRACE("read line: " , line);
-		if (!line.empty()) {
-			if (line.back() == '\r') line.pop_back();
-			if (line.compare(0, this->commentPrefix.length(), this->commentPrefix) == 0) {
-				TRACE("ignoring comment: " , line);
-			} else {
-				std::vector<std::string> split = Aux::StringTools::split(line, this->separator);
-				if (!checkedWeighted) {
-					if (split.size() == 2) {
-						weighted = false;
-					} else if (split.size() == 3) {
-						INFO("Identified graph as weighted.");
-						weighted = true;
-					}
-					checkedWeighted = true;
+	// parse the chunks of the file in parallel into one buffer per chunk
+	const std::vector<const char*> bounds = TextChunks::splitAtLines(begin, end, 4 * omp_get_max_threads());
+	const count chunks = bounds.size() - 1;
+	std::vector<std::vector<ParsedEdge>> parsed(chunks);
+	std::vector<node> maxNodes(chunks, 0);
+	TextChunks::parallelForChunks(chunks, [&](index c) {
+		TextChunks::forLines(bounds[c], bounds[c + 1], [&](const char* lineBegin, const char* lineEnd) {
+			if (lineBegin == lineEnd || isComment(lineBegin, lineEnd)) {
+				return;
+			}
+
+			// split the line at the separator, a trailing separator does not start another field
+			const char* fields[4];
+			const char* fieldEnds[4];
+			count numFields = 0;
+			for (const char* it = lineBegin; it != lineEnd;) {
+				const char* fieldEnd = std::find(it, lineEnd, separator);
+				if (numFields == (weighted ? 3 : 2)) {
+					throw malformed(lineBegin, lineEnd);
 				}
-				if (split.size() == 2 || split.size() == 3) {
-					TRACE("split into : " , split[0] , " and " , split[1]);
-					node u = std::stoul(split[0]);
-					if (u > maxNode) {
-						maxNode = u;
-					}
-					node v = std::stoul(split[1]);
-					if (v > maxNode) {
-						maxNode = v;
+				fields[numFields] = it;
+				fieldEnds[numFields] = fieldEnd;
+				++numFields;
+				it = fieldEnd == lineEnd ? lineEnd : fieldEnd + 1;
+			}
+			if (numFields < 2) {
+				throw malformed(lineBegin, lineEnd);
+			}
+
+			auto parseNode = [&](index i) {
+				try {
+					node u;
+					const char* it;
+					std::tie(u, it) = Aux::Parsing::strTo<node, const char*, Aux::Checkers::Enforcer>(fields[i], fieldEnds[i]);
+					if (it != fieldEnds[i] || u < firstNode) {
+						throw malformed(lineBegin, lineEnd);
 					}
-				} else {
-					std::stringstream message;
-					message << "malformed line ";
-					message << i << ": ";
-					message << line;
-					throw std::runtime_error(message.str());
+					maxNodes[c] = std::max(maxNodes[c], u);
+					return u - firstNode;
+				} catch (std::exception& e) {
+					throw malformed(lineBegin, lineEnd);
+				}
+			};
+			ParsedEdge edge;
+			edge.u = parseNode(0);
+			edge.v = parseNode(1);
+			edge.weight = defaultEdgeWeight;
+			if (numFields == 3) {
+				try {
+					std::tie(edge.weight, std::ignore) = Aux::Parsing::strTo<double, const char*, Aux::Checkers::Enforcer>(fields[2], fieldEnds[2]);
+				} catch (std::exception& e) {
+					throw malformed(lineBegin, lineEnd);
 				}
 			}
-		} else {
-			DEBUG("line ", i, " is empty.");
+			parsed[c].push_back(edge);
+		});
+	});
+
+	node maxNode = *std::max_element(maxNodes.begin(), maxNodes.end());
+	maxNode = maxNode + 1 >= this->firstNode ? maxNode + 1 - this->firstNode : 0;
+	DEBUG("max. node id found: " , maxNode);
+
+	// Each thread builds the adjacencies of a range of nodes. For undirected graphs, an edge is
+	// stored at its larger endpoint, so both orientations of an edge meet in the same row.
+	const count n = maxNode;
+	const count threads = omp_get_max_threads();
+	auto owner = [&](node u) {
+		return static_cast<index>(static_cast<double>(u) / n * threads);
+	};
+	auto row = [&](const ParsedEdge& edge) {
+		return directed ? edge.u : std::max(edge.u, edge.v);
+	};
+	std::vector<std::vector<std::vector<ParsedEdge>>> buckets(chunks, std::vector<std::vector<ParsedEdge>>(threads));
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (omp_index c = 0; c < static_cast<omp_index>(chunks); ++c) {
+		for (const ParsedEdge& edge : parsed[c]) {
+			buckets[c][std::min(owner(row(edge)), threads - 1)].push_back(edge);
 		}
+		std::vector<ParsedEdge>().swap(parsed[c]);
 	}
-	file.close();
-	maxNode = maxNode - this->firstNode + 1;
-	DEBUG("max. node id found: " , maxNode);
 
-	Graph G(maxNode, weighted, directed);
+	GraphBuilder builder(n, weighted, directed);
+	#pragma omp parallel for schedule(static, 1)
+	for (omp_index t = 0; t < static_cast<omp_index>(threads); ++t) {
+		// gather the edges of this thread in the order of the file, grouped by rows
+		std::vector<ParsedEdge> edges;
+		for (index c = 0; c < chunks; ++c) {
+			edges.insert(edges.end(), buckets[c][t].begin(), buckets[c][t].end());
+			std::vector<ParsedEdge>().swap(buckets[c][t]);
+		}
+		std::stable_sort(edges.begin(), edges.end(), [&](const ParsedEdge& a, const ParsedEdge& b) {
+			return row(a) < row(b);
+		});
 
-	DEBUG("second pass");
-	file.open(path);
-	// split the line into start and end node. since the edges are sorted, the start node has the highest id of all nodes
-	i = 0; // count lines
-	while(std::getline(file,line)){
-		if (line.empty()) continue;
-		if(*line.rbegin() == '\r') line.pop_back();
-		++i;
-		if (line.compare(0, this->commentPrefix.length(), this->commentPrefix) == 0) {
-			// TRACE("ignoring comment: " , line);
-		} else {
-			// TRACE("edge line: " , line);
-			std::vector<std::string> split = Aux::StringTools::split(line, this->separator);
-			if (split.size() == 2) {
-				node u = std::stoul(split[0]) - this->firstNode;
-				node v = std::stoul(split[1]) - this->firstNode;
-			    if (!G.hasEdge(u,v)) {
-					G.addEdge(u, v);
-				}
-			} else if (weighted && split.size() == 3) {
-				node u = std::stoul(split[0]) - this->firstNode;
-				node v = std::stoul(split[1]) - this->firstNode;
-				double weight = std::stod(split[2]);
-			    if (!G.hasEdge(u,v)) {
-					G.addEdge(u, v, weight);
+		// keep the first occurrence of each edge
+		std::vector<index> order;
+		std::vector<bool> keep;
+		std::vector<node> neighbors;
+		std::vector<edgeweight> weights;
+		for (index i = 0; i < edges.size();) {
+			const node u = row(edges[i]);
+			index j = i;
+			while (j < edges.size() && row(edges[j]) == u) {
+				++j;
+			}
+			auto column = [&](index k) {
+				return edges[k].u + edges[k].v - u;
+			};
+			order.resize(j - i);
+			for (index k = 0; k < order.size(); ++k) {
+				order[k] = i + k;
+			}
+			std::stable_sort(order.begin(), order.end(), [&](index a, index b) {
+				return column(a) < column(b);
+			});
+			keep.assign(j - i, false);
+			for (index k = 0; k < order.size(); ++k) {
+				keep[order[k] - i] = k == 0 || column(order[k]) != column(order[k - 1]);
+			}
+
+			neighbors.clear();
+			weights.clear();
+			bool selfloop = false;
+			for (index k = i; k < j; ++k) {
+				if (keep[k - i]) {
+					neighbors.push_back(column(k));
+					if (weighted) {
+						weights.push_back(edges[k].weight);
+					}
+					selfloop |= column(k) == u;
 				}
-			} else {
-				std::stringstream message;
-				message << "malformed line ";
-				message << i << ": ";
-				message << line;
-				throw std::runtime_error(message.str());
 			}
+			builder.swapNeighborhood(u, neighbors, weights, selfloop);
+			i = j;
 		}
 	}
-	file.close();
 
-	G.shrinkToFit();
-	return G;
+	return builder.toGraph(true, true);
 }
 
 
@@ -23,6 +23,11 @@ namespace NetworKit {
  * A reader for various edge list formats, in which each line contains an edge as
  * two node ids.
  *
+ * Files with continuous node ids are parsed in parallel. The neighbors of a node are then not in the
+ * order of the file, but their order only depends on the file and not on the number of threads: in
+ * undirected graphs the smaller neighbors come first in the order of the file, followed by the larger
+ * neighbors in increasing order; in directed graphs the out-neighbors are in the order of the file and
+ * the in-neighbors in increasing order. Multiple edges are merged into the first of them.
  */
 class EdgeListReader: public NetworKit::GraphReader {
 
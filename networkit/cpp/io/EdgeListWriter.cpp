@@ -6,49 +6,33 @@
  */
 
 #include "EdgeListWriter.h"
-#include "../auxiliary/Log.h"
-
-#include <sstream>
-
-#include "../auxiliary/Enforce.h"
+#include "ParallelTextWriter.h"
 
 namespace NetworKit {
 
 EdgeListWriter::EdgeListWriter(char separator, node firstNode, bool bothDirections) : separator(separator), firstNode(firstNode), bothDirections(bothDirections) {}
 
 void EdgeListWriter::write(const Graph& G, std::string path) {
-	std::ofstream file(path);
-	Aux::enforceOpened(file);
-
-	auto writeWeightedEdge = [&](node u, node v, edgeweight weight) {
-		file << (u + firstNode) << separator << (v + firstNode) << separator << weight << std::endl;
-	};
-
-	auto writeUnweightedEdge = [&](node u, node v){
-		file << (u + firstNode) << separator << (v + firstNode) << std::endl;
-	};
-
-	if (G.isWeighted()) {
-		if (bothDirections) {
-			G.forNodes([&](node u) {
-				G.forEdgesOf(u, writeWeightedEdge);
-			});
-		} else {
-			G.forEdges(writeWeightedEdge);
-		}
-	} else {
-		if (bothDirections) {
-			G.forNodes([&](node u) {
-				G.forEdgesOf(u, writeUnweightedEdge);
-			});
-		} else {
-			G.forEdges(writeUnweightedEdge);
-		}
-	}
-
+	ParallelTextWriter file(path);
+
+	const bool weighted = G.isWeighted();
+	// forEdges() visits the edges of u in the order of its neighbors, undirected edges only at the larger node
+	const bool allEdgesOfNode = bothDirections || G.isDirected();
+	file.writeItems(G.upperNodeIdBound(), [&](node u, std::string& buffer) {
+		G.forNeighborsOf(u, [&](node v, edgeweight weight) {
+			if (!allEdgesOfNode && v > u) return;
+			ParallelTextWriter::appendInteger(buffer, u + firstNode);
+			buffer += separator;
+			ParallelTextWriter::appendInteger(buffer, v + firstNode);
+			if (weighted) {
+				buffer += separator;
+				ParallelTextWriter::appendDouble(buffer, weight);
+			}
+			buffer += '\n';
+		});
+	});
 
 	file.close();
-
 }
 
 } /* namespace NetworKit */
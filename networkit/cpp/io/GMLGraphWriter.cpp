@@ -6,32 +6,38 @@
  */
 
 #include "GMLGraphWriter.h"
-#include "../auxiliary/Enforce.h"
+#include "ParallelTextWriter.h"
 
 namespace NetworKit {
 
 void GMLGraphWriter::write(const Graph& G, const std::string& path) {
-	std::ofstream file(path);
-	Aux::enforceOpened(file);
-	
-	file << "graph [\n";
+	ParallelTextWriter file(path);
+
+	file.write("graph [\n");
 	if (G.isDirected()) {
-		file << "  directed 1\n";
+		file.write("  directed 1\n");
 	}
-	
-	G.forNodes([&](node u) {
-		file << "  node [\n";
-		file << "    id " << u << "\n";
-                file << "  ]\n";
+
+	file.writeItems(G.upperNodeIdBound(), [&](node u, std::string& buffer) {
+		if (!G.hasNode(u)) return;
+		buffer += "  node [\n    id ";
+		ParallelTextWriter::appendInteger(buffer, u);
+		buffer += "\n  ]\n";
 	});
-		
-	G.forEdges([&](node u, node v) {
-			file << "  edge [\n";
-			file << "    source "<< u << "\n";
-			file << "    target "<< v << "\n";
-			file << "  ]\n";
+
+	// same order as forEdges()
+	file.writeItems(G.upperNodeIdBound(), [&](node u, std::string& buffer) {
+		G.forNeighborsOf(u, [&](node v) {
+			if (!G.isDirected() && v > u) return;
+			buffer += "  edge [\n    source ";
+			ParallelTextWriter::appendInteger(buffer, u);
+			buffer += "\n    target ";
+			ParallelTextWriter::appendInteger(buffer, v);
+			buffer += "\n  ]\n";
+		});
 	});
-	file << "]\n";
+	file.write("]\n");
+	file.close();
 }
 
 } /* namespace NetworKit */
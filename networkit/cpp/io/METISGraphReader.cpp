@@ -5,20 +5,76 @@
  *      Author: Christian Staudt (christian.staudt@kit.edu)
  */
 
+#include <omp.h>
+
 #include "METISGraphReader.h"
-#include "METISParser.h"
+#include "MemoryMappedFile.h"
+#include "TextChunks.h"
 #include "../auxiliary/Enforce.h"
 #include "../auxiliary/Log.h"
+#include "../auxiliary/NumberParsing.h"
 #include "../auxiliary/StringTools.h"
 #include "../graph/GraphBuilder.h"
 
 namespace NetworKit {
 
+namespace {
+
+bool isComment(const char* begin, const char* end) {
+	return begin != end && *begin == '%';
+}
+
+/**
+ * Parses the header line [@a it, @a end) into (n, m, fmt, ncon).
+ */
+std::tuple<count, count, index, count> parseHeader(const char* it, const char* end) {
+	std::vector<count> tokens;
+	while (it != end) {
+		count token;
+		std::tie(token, it) = Aux::Parsing::strTo<count, const char*, Aux::Checkers::Enforcer>(it, end);
+		tokens.push_back(token);
+	}
+	if (tokens.size() < 2) {
+		throw std::runtime_error("getting METIS file header failed");
+	}
+	index fmt = 0;
+	count ncon = 0;
+	if (tokens.size() >= 3) {
+		fmt = tokens[2];
+		if (fmt >= 2) {
+			WARN("nodes are weighted; node weights will be ignored");
+		}
+		ncon = tokens.size() == 4 ? tokens[3] : 1;
+	}
+	return std::make_tuple(tokens[0], tokens[1], fmt, ncon);
+}
+
+} // namespace
+
 Graph METISGraphReader::read(const std::string& path) {
+	MemoryMappedFile file(path);
+	const char* begin = file.cbegin();
+	const char* end = file.cend();
 
-	METISParser parser(path);
+	// the header is the first line which is not a comment
+	const char* body = begin;
+	const char* headerBegin = nullptr;
+	const char* headerEnd = nullptr;
+	while (body != end && !headerBegin) {
+		const char* lineBreak = static_cast<const char*>(std::memchr(body, '\n', end - body));
+		const char* lineEnd = lineBreak ? lineBreak : end;
+		if (!isComment(body, lineEnd)) {
+			headerBegin = body;
+			headerEnd = lineEnd;
+		}
+		body = lineBreak ? lineBreak + 1 : end;
+	}
+	if (!headerBegin) {
+		ERROR("getline not successful");
+		throw std::runtime_error("getting METIS file header failed");
+	}
 
-	std::tuple<count, count, index, count> header = parser.getHeader();
+	std::tuple<count, count, index, count> header = parseHeader(headerBegin, headerEnd);
 	count n = std::get<0>(header);
 	count m = std::get<1>(header);
 	index fmt = std::get<2>(header);
@@ -41,62 +97,70 @@ Graph METISGraphReader::read(const std::string& path) {
 	std::string graphName = Aux::StringTools::split(Aux::StringTools::split(path, '/').back(), '.').front();
 	b.setName(graphName);
 
-	INFO("\n[BEGIN] reading graph G(n=", n, ", m=", m, ") from METIS file: ", graphName);	// progress bar follows
+	INFO("\n[BEGIN] reading graph G(n=", n, ", m=", m, ") from METIS file: ", graphName);
 
-#if (LOG_LEVEL == LOG_LEVEL_TRACE)
-	double p = 0.0; // percentage for progress bar
-#endif
-	node u = 0; // begin with 0
-	count edgeCounter = 0;
-	if (weighted == 0) {
-		while (parser.hasNext() && u < n) {
-			std::vector<node> adjacencies = parser.getNext(ignoreFirst);
-			edgeCounter += adjacencies.size();
-			for (index i=0; i < adjacencies.size(); i++) {
-				if (adjacencies[i] == 0) {
-					ERROR("METIS Node ID should not be 0, edge ignored.");
-					continue;
-				}
-				Aux::Checkers::Enforcer::enforce(adjacencies[i] > 0 && adjacencies[i] <= n);
-				node v = adjacencies[i] - 1; 	// METIS-indices are 1-based
-				// correct edgeCounter for selfloops
-				edgeCounter += (u == v);
-				b.addHalfEdge(u, v);
+	// every line which is not a comment holds the adjacencies of the next node, so the first
+	// node of each chunk follows from the number of such lines in the preceding chunks
+	const std::vector<const char*> bounds = TextChunks::splitAtLines(body, end, 4 * omp_get_max_threads());
+	const count chunks = bounds.size() - 1;
+	std::vector<node> firstNode(chunks + 1, 0);
+	TextChunks::parallelForChunks(chunks, [&](index c) {
+		TextChunks::forLines(bounds[c], bounds[c + 1], [&](const char* lineBegin, const char* lineEnd) {
+			firstNode[c + 1] += !isComment(lineBegin, lineEnd);
+		});
+	});
+	for (index c = 0; c < chunks; ++c) {
+		firstNode[c + 1] += firstNode[c];
+	}
+
+	// each node is read by exactly one thread, so the half edges can be added in parallel
+	std::vector<count> edgeCounters(chunks, 0);
+	TextChunks::parallelForChunks(chunks, [&](index c) {
+		node u = firstNode[c];
+		TextChunks::forLines(bounds[c], bounds[c + 1], [&](const char* it, const char* lineEnd) {
+			if (isComment(it, lineEnd)) {
+				return;
 			}
-			u++; // next node
-#if (LOG_LEVEL == LOG_LEVEL_TRACE)
-			if ((u % ((n + 10)/10)) == 0) {
-				p = ((double) (u-1) / (double) n) * 100;
-				DEBUG(p, "% ");
+			if (u >= n) {
+				++u;
+				return;
 			}
-#endif
-		}
-	} else {
-		while (parser.hasNext() && u < n) {
-			std::vector<std::pair<node,double>> adjacencies = parser.getNextWithWeights(ignoreFirst);
-			edgeCounter += adjacencies.size();
-			DEBUG("node ",u," has ",adjacencies.size()," edges");
-			for (index i=0; i < adjacencies.size(); i++) {
-				if (adjacencies[i].first == 0) {
+			for (index i = 0; i < ignoreFirst; ++i) {
+				// parse first values but ignore them.
+				double dummy;
+				std::tie(dummy, it) = Aux::Parsing::strTo<double>(it, lineEnd);
+			}
+			while (it != lineEnd) {
+				node v;
+				edgeweight weight = defaultEdgeWeight;
+				if (weighted) {
+					try {
+						std::tie(v, it) = Aux::Parsing::strTo<node>(it, lineEnd);
+						std::tie(weight, it) = Aux::Parsing::strTo<double, const char*, Aux::Checkers::Enforcer>(it, lineEnd);
+					} catch (std::exception& e) {
+						ERROR("malformed line; not all edges have been read correctly");
+						break;
+					}
+				} else {
+					std::tie(v, it) = Aux::Parsing::strTo<node>(it, lineEnd);
+				}
+				++edgeCounters[c];
+				if (v == 0) {
 					ERROR("METIS Node ID should not be 0, edge ignored.");
 					continue;
 				}
-				Aux::Checkers::Enforcer::enforce(adjacencies[i].first > 0 && adjacencies[i].first <= n);
-				node v = adjacencies[i].first - 1; 	// METIS-indices are 1-based
+				Aux::Checkers::Enforcer::enforce(v <= n);
+				--v; // METIS-indices are 1-based
 				// correct edgeCounter for selfloops
-				edgeCounter += (u == v);
-				double weight = adjacencies[i].second;
+				edgeCounters[c] += (u == v);
 				b.addHalfEdge(u, v, weight);
-				TRACE("(",u,",",v,",",adjacencies[i].second,")");
 			}
-			u += 1; // next node
-#if (LOG_LEVEL == LOG_LEVEL_TRACE)
-			if ((u % ((n + 10)/10)) == 0) {
-				p = ((double) (u-1) / (double) n) * 100;
-				DEBUG(p, "% ");
-			}
-#endif
-		}
+			++u;
+		});
+	});
+	count edgeCounter = 0;
+	for (count edges : edgeCounters) {
+		edgeCounter += edges;
 	}
 
 	auto G = b.toGraph(false);
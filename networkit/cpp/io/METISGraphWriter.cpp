@@ -6,9 +6,7 @@
  */
 
 #include "METISGraphWriter.h"
-#include "../graph/GraphTools.h"
-
-#include "../auxiliary/Enforce.h"
+#include "ParallelTextWriter.h"
 
 namespace NetworKit {
 
@@ -19,48 +17,39 @@ void METISGraphWriter::write(const Graph& G, bool weighted, std::string path) {
 	if (G.isDirected()) {
 		throw std::invalid_argument{"METIS does not support directed graphs"};
 	}
-	std::ofstream file(path);
-	Aux::enforceOpened(file);
+	ParallelTextWriter file(path);
 
 	count n = G.numberOfNodes();
 	count m = G.numberOfEdges();
 
-	file << n << " " << m << " " << int{weighted} << '\n';
-	if (G.numberOfNodes() != G.upperNodeIdBound()) {
-		auto nodeIds = GraphTools::getContinuousNodeIds(G);
-		if (weighted == false) {
-			G.forNodes([&](node u) {
-				G.forNeighborsOf(u, [&](node v){
-					file << nodeIds[v] + 1 << " ";
-				});
-				file << '\n';
-			});
-		} else {
-				G.forNodes([&](node u) {
-				G.forNeighborsOf(u, [&](node v, edgeweight w){
-					file << nodeIds[v] + 1 << " " << w <<"\t";
-				});
-				file << '\n';
-			});
-		}
-	} else {
-		if (weighted == false) {
-			G.forNodes([&](node u) {
-				G.forNeighborsOf(u, [&](node v){
-					file << v + 1 << " ";
-				});
-				file << '\n';
-			});
-		} else {
-				G.forNodes([&](node u) {
-				G.forNeighborsOf(u, [&](node v, edgeweight w){
-					file << v + 1 << " " << w <<"\t";
-				});
-				file << '\n';
-			});
-		}
+	file.write(std::to_string(n) + " " + std::to_string(m) + " " + std::to_string(int{weighted}) + "\n");
+
+	// ids are continuous in the file even if the graph has deleted nodes
+	std::vector<node> nodeIds;
+	const bool continuous = G.numberOfNodes() == G.upperNodeIdBound();
+	if (!continuous) {
+		nodeIds.resize(G.upperNodeIdBound(), none);
+		node next = 0;
+		G.forNodes([&](node u) {
+			nodeIds[u] = next++;
+		});
 	}
 
+	file.writeItems(G.upperNodeIdBound(), [&](node u, std::string& buffer) {
+		if (!G.hasNode(u)) return;
+		G.forNeighborsOf(u, [&](node v, edgeweight w) {
+			ParallelTextWriter::appendInteger(buffer, (continuous ? v : nodeIds[v]) + 1);
+			if (weighted) {
+				buffer += ' ';
+				ParallelTextWriter::appendDouble(buffer, w);
+				buffer += '\t';
+			} else {
+				buffer += ' ';
+			}
+		});
+		buffer += '\n';
+	});
+	file.close();
 }
 
 } /* namespace NetworKit */
@@ -25,11 +25,12 @@ namespace NetworKit {
  *
  * @param[out]	adjacencies	node indices extracted from line
  */
-static std::vector<node> parseLine(const std::string& line, count ignoreFirst = 0) {
+template<typename T = node>
+static std::vector<T> parseLine(const std::string& line, count ignoreFirst = 0) {
 	auto it = line.begin();
 	auto end = line.end();
-	std::vector<node> adjacencies;
-	node v;
+	std::vector<T> adjacencies;
+	T v;
 	index i = 0;
 	DEBUG(ignoreFirst);
 	while (i < ignoreFirst) {
@@ -40,7 +41,7 @@ static std::vector<node> parseLine(const std::string& line, count ignoreFirst =
 		++i;
 	}
 	while(it != end) {
-		std::tie(v, it) = Aux::Parsing::strTo<node>(it,end);
+		std::tie(v, it) = Aux::Parsing::strTo<T>(it,end);
 		adjacencies.push_back(v);
 	}
 	return adjacencies;
@@ -110,7 +111,7 @@ std::tuple<count, count, index, count> METISParser::getHeader() {
 			std::getline(this->graphFile, line);
 		}
 
-		std::vector<uint64_t> tokens = parseLine(line);
+		std::vector<uint64_t> tokens = parseLine<uint64_t>(line);
 		n = tokens[0];
 		m = tokens[1];
 		if (tokens.size() == 2) {
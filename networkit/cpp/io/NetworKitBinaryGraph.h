@@ -0,0 +1,71 @@
+/*
+ * NetworKitBinaryGraph.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef NETWORKITBINARYGRAPH_H_
+#define NETWORKITBINARYGRAPH_H_
+
+#include <cstdint>
+
+namespace NetworKit {
+
+/**
+ * Layout of the NetworKit binary graph format shared by NetworKitBinaryWriter and
+ * NetworKitBinaryReader. All values are stored in the byte order of the writing machine;
+ * the reader recognizes files of the other byte order by the magic number and rejects them.
+ *
+ * The file starts with a Header of 64 bytes followed by the payload which consists of 8 byte words:
+ * 		for the outgoing (and for directed graphs also the incoming) adjacencies
+ * 			offsets:   upperNodeIdBound + 1 words, the neighbors of u are at offsets[u] ... offsets[u+1]-1
+ * 			neighbors: offsets[upperNodeIdBound] node ids
+ * 			weights:   one double per neighbor, only if the graph is weighted
+ * 			edge ids:  one edge id per neighbor, only if edges are indexed
+ * 		one byte per node telling whether the node exists, padded to a multiple of 8 bytes,
+ * 		only if nodes have been deleted
+ * The adjacencies are stored exactly in the order of the graph, so a graph read from the file
+ * iterates its edges in the same order as the graph that has been written.
+ */
+namespace NetworKitBinaryGraph {
+
+const uint32_t magic = 0x47424B4E; //!< "NKBG"
+const uint32_t swappedMagic = 0x4E4B4247; //!< magic as read on a machine of the other byte order
+const uint32_t version = 1;
+
+enum Flags : uint64_t {
+	DIRECTED = 1,
+	WEIGHTED = 2,
+	EDGE_IDS = 4,
+	DELETED_NODES = 8
+};
+
+struct Header {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t flags;
+	uint64_t upperNodeIdBound;
+	uint64_t numberOfNodes;
+	uint64_t numberOfEdges;
+	uint64_t numberOfSelfLoops;
+	uint64_t upperEdgeIdBound;
+	uint64_t checksum; //!< sum of checksumWord() over all payload words
+};
+
+static_assert(sizeof(Header) == 64, "the header has to be 64 bytes");
+
+/**
+ * Contribution of the payload word @a word at position @a pos to the checksum. Since the
+ * checksum is a sum of these values, it can be computed in parallel in any order.
+ */
+inline uint64_t checksumWord(uint64_t word, uint64_t pos) {
+	uint64_t z = word + (pos + 1) * 0x9E3779B97F4A7C15ull;
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return z ^ (z >> 31);
+}
+
+} /* namespace NetworKitBinaryGraph */
+
+} /* namespace NetworKit */
+#endif /* NETWORKITBINARYGRAPH_H_ */
@@ -0,0 +1,146 @@
+/*
+ * NetworKitBinaryReader.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include <cstring>
+#include <stdexcept>
+
+#include "NetworKitBinaryReader.h"
+#include "NetworKitBinaryGraph.h"
+#include "MemoryMappedFile.h"
+
+namespace NetworKit {
+
+NetworKitBinaryReader::NetworKitBinaryReader(bool verifyChecksum) : verifyChecksum(verifyChecksum) {
+}
+
+Graph NetworKitBinaryReader::read(const std::string& path) {
+	using namespace NetworKitBinaryGraph;
+
+	MemoryMappedFile file(path);
+	Header header;
+	if (file.size() < sizeof(header)) {
+		throw std::runtime_error("Error: file is too small to be a NetworKit binary graph");
+	}
+	std::memcpy(&header, file.cbegin(), sizeof(header));
+	if (header.magic != magic) {
+		if (header.magic == swappedMagic) {
+			throw std::runtime_error("Error: NetworKit binary graph has been written with a different byte order");
+		}
+		throw std::runtime_error("Error: file is not a NetworKit binary graph");
+	}
+	if (header.version != version) {
+		throw std::runtime_error("Error: unsupported version of the NetworKit binary graph format");
+	}
+	if ((file.size() - sizeof(header)) % sizeof(uint64_t) != 0) {
+		throw std::runtime_error("Error: NetworKit binary graph is truncated");
+	}
+
+	// mappings are page aligned and the header has 64 bytes, so the payload words are aligned
+	const uint64_t* payload = reinterpret_cast<const uint64_t*>(file.cbegin() + sizeof(header));
+	const count words = (file.size() - sizeof(header)) / sizeof(uint64_t);
+
+	if (verifyChecksum) {
+		uint64_t checksum = 0;
+		#pragma omp parallel for reduction(+:checksum)
+		for (omp_index i = 0; i < static_cast<omp_index>(words); ++i) {
+			checksum += checksumWord(payload[i], i);
+		}
+		if (checksum != header.checksum) {
+			throw std::runtime_error("Error: checksum of NetworKit binary graph does not match");
+		}
+	}
+
+	index position = 0;
+	auto take = [&](count length) {
+		if (length > words - position) {
+			throw std::runtime_error("Error: NetworKit binary graph is truncated");
+		}
+		const uint64_t* section = payload + position;
+		position += length;
+		return section;
+	};
+
+	const count z = header.upperNodeIdBound;
+	const bool directed = header.flags & DIRECTED;
+	const bool weighted = header.flags & WEIGHTED;
+	const bool indexed = header.flags & EDGE_IDS;
+	if (z >= words) {
+		throw std::runtime_error("Error: NetworKit binary graph is truncated");
+	}
+
+	Graph G(z, weighted, directed);
+	bool valid = true;
+
+	auto readAdjacencies = [&](std::vector<std::vector<node>>& edges, std::vector<count>& degrees,
+			std::vector<std::vector<edgeweight>>& edgeWeights, std::vector<std::vector<edgeid>>& edgeIds) {
+		const uint64_t* offsets = take(z + 1);
+		if (offsets[0] != 0) {
+			throw std::runtime_error("Error: invalid offsets in NetworKit binary graph");
+		}
+		const count total = offsets[z];
+		const uint64_t* neighbors = take(total);
+		const uint64_t* weights = weighted ? take(total) : nullptr;
+		const uint64_t* ids = indexed ? take(total) : nullptr;
+		if (indexed) {
+			edgeIds.resize(z);
+		}
+
+		#pragma omp parallel for schedule(guided) reduction(&&:valid)
+		for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+			const uint64_t begin = offsets[u];
+			const uint64_t end = offsets[u + 1];
+			if (begin > end || end > total) {
+				valid = false;
+				continue;
+			}
+			edges[u].assign(neighbors + begin, neighbors + end);
+			for (node v : edges[u]) {
+				valid = valid && v < z;
+			}
+			degrees[u] = end - begin;
+			if (weighted) {
+				edgeWeights[u].resize(end - begin);
+				std::memcpy(edgeWeights[u].data(), weights + begin, (end - begin) * sizeof(edgeweight));
+			}
+			if (indexed) {
+				edgeIds[u].assign(ids + begin, ids + end);
+			}
+		}
+	};
+
+	readAdjacencies(G.outEdges, G.outDeg, G.outEdgeWeights, G.outEdgeIds);
+	if (directed) {
+		readAdjacencies(G.inEdges, G.inDeg, G.inEdgeWeights, G.inEdgeIds);
+	}
+	if (!valid) {
+		throw std::runtime_error("Error: invalid adjacencies in NetworKit binary graph");
+	}
+
+	if (header.flags & DELETED_NODES) {
+		const uint64_t* exists = take((z + 7) / 8);
+		count n = 0;
+		for (node u = 0; u < z; ++u) {
+			G.exists[u] = (exists[u / 8] >> (8 * (u % 8))) & 0xFF;
+			n += G.exists[u];
+		}
+		if (n != header.numberOfNodes) {
+			throw std::runtime_error("Error: number of nodes in NetworKit binary graph does not match");
+		}
+	}
+	if (position != words) {
+		throw std::runtime_error("Error: unexpected data at the end of NetworKit binary graph");
+	}
+
+	G.n = header.numberOfNodes;
+	G.m = header.numberOfEdges;
+	G.storedNumberOfSelfLoops = header.numberOfSelfLoops;
+	G.omega = header.upperEdgeIdBound;
+	G.edgesIndexed = indexed;
+
+	return G;
+}
+
+} /* namespace NetworKit */
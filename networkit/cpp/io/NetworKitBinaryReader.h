@@ -0,0 +1,46 @@
+/*
+ * NetworKitBinaryReader.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef NETWORKITBINARYREADER_H_
+#define NETWORKITBINARYREADER_H_
+
+#include <string>
+
+#include "GraphReader.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ * Reads graphs written by NetworKitBinaryWriter. The file is memory mapped and the adjacency
+ * arrays are copied into the graph in parallel, so no parsing is involved and reading is
+ * bounded by the memory bandwidth.
+ *
+ * The graph does not refer to the mapping: Graph stores one vector per node, so the adjacencies are
+ * copied and the graph needs as much memory as one read from any other format, in addition to the
+ * mapping while reading.
+ */
+class NetworKitBinaryReader: public GraphReader {
+
+public:
+	/**
+	 * @param[in]	verifyChecksum	if true, the checksum of the file is verified before reading.
+	 */
+	NetworKitBinaryReader(bool verifyChecksum = true);
+
+	/**
+	 * Given the path of an input file, read the graph contained.
+	 *
+	 * @param[in]	path	input file path
+	 */
+	Graph read(const std::string& path) override;
+
+private:
+	bool verifyChecksum;
+};
+
+} /* namespace NetworKit */
+#endif /* NETWORKITBINARYREADER_H_ */
@@ -0,0 +1,164 @@
+/*
+ * NetworKitBinaryWriter.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include "NetworKitBinaryWriter.h"
+#include "NetworKitBinaryGraph.h"
+
+namespace NetworKit {
+
+namespace {
+
+/**
+ * Writes payload words through a buffer and sums up their checksum.
+ */
+class PayloadWriter {
+public:
+	explicit PayloadWriter(std::ofstream& out) : out(out), position(0), checksum(0) {
+		buffer.reserve(bufferSize);
+	}
+
+	void put(uint64_t word) {
+		checksum += NetworKitBinaryGraph::checksumWord(word, position++);
+		buffer.push_back(word);
+		if (buffer.size() == bufferSize) {
+			flush();
+		}
+	}
+
+	void put(double value) {
+		uint64_t word;
+		std::memcpy(&word, &value, sizeof(word));
+		put(word);
+	}
+
+	void flush() {
+		out.write(reinterpret_cast<const char*>(buffer.data()), buffer.size() * sizeof(uint64_t));
+		buffer.clear();
+	}
+
+	uint64_t getChecksum() const {
+		return checksum;
+	}
+
+private:
+	static const size_t bufferSize = 1 << 16;
+
+	std::ofstream& out;
+	std::vector<uint64_t> buffer;
+	uint64_t position;
+	uint64_t checksum;
+};
+
+template<typename L>
+void forAdjacentEdgesOf(const Graph& G, bool incoming, node u, L handle) {
+	if (incoming) {
+		G.forInEdgesOf(u, handle);
+	} else {
+		G.forEdgesOf(u, handle);
+	}
+}
+
+/**
+ * Writes the offsets, neighbors, weights and edge ids of the outgoing or @a incoming adjacencies.
+ */
+void writeAdjacencies(const Graph& G, PayloadWriter& payload, bool incoming) {
+	const count z = G.upperNodeIdBound();
+	uint64_t offset = 0;
+	payload.put(offset);
+	for (node u = 0; u < z; ++u) {
+		offset += incoming ? G.degreeIn(u) : G.degreeOut(u);
+		payload.put(offset);
+	}
+
+	for (node u = 0; u < z; ++u) {
+		forAdjacentEdgesOf(G, incoming, u, [&](node, node v, edgeweight, edgeid) {
+			payload.put(static_cast<uint64_t>(v));
+		});
+	}
+
+	if (G.isWeighted()) {
+		for (node u = 0; u < z; ++u) {
+			forAdjacentEdgesOf(G, incoming, u, [&](node, node, edgeweight w, edgeid) {
+				payload.put(static_cast<double>(w));
+			});
+		}
+	}
+
+	if (G.hasEdgeIds()) {
+		for (node u = 0; u < z; ++u) {
+			forAdjacentEdgesOf(G, incoming, u, [&](node, node, edgeweight, edgeid eid) {
+				payload.put(static_cast<uint64_t>(eid));
+			});
+		}
+	}
+}
+
+} // namespace
+
+void NetworKitBinaryWriter::write(const Graph& G, const std::string& path) {
+	std::ofstream out(path, std::ios::trunc | std::ios::binary);
+	if (!out) {
+		throw std::runtime_error("Error: graph file couldn't be opened");
+	}
+	out.exceptions(std::ofstream::badbit | std::ofstream::failbit);
+
+	const count z = G.upperNodeIdBound();
+	const bool deletedNodes = G.numberOfNodes() != z;
+
+	NetworKitBinaryGraph::Header header;
+	header.magic = NetworKitBinaryGraph::magic;
+	header.version = NetworKitBinaryGraph::version;
+	uint64_t flags = 0;
+	if (G.isDirected()) {
+		flags |= NetworKitBinaryGraph::DIRECTED;
+	}
+	if (G.isWeighted()) {
+		flags |= NetworKitBinaryGraph::WEIGHTED;
+	}
+	if (G.hasEdgeIds()) {
+		flags |= NetworKitBinaryGraph::EDGE_IDS;
+	}
+	if (deletedNodes) {
+		flags |= NetworKitBinaryGraph::DELETED_NODES;
+	}
+	header.flags = flags;
+	header.upperNodeIdBound = z;
+	header.numberOfNodes = G.numberOfNodes();
+	header.numberOfEdges = G.numberOfEdges();
+	header.numberOfSelfLoops = G.numberOfSelfLoops();
+	header.upperEdgeIdBound = G.upperEdgeIdBound();
+	header.checksum = 0;
+	// the header is written again with the checksum once the payload is complete
+	out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+	PayloadWriter payload(out);
+	writeAdjacencies(G, payload, false);
+	if (G.isDirected()) {
+		writeAdjacencies(G, payload, true);
+	}
+
+	if (deletedNodes) {
+		for (node u = 0; u < z; u += 8) {
+			uint64_t word = 0;
+			for (node v = u; v < std::min<node>(u + 8, z); ++v) {
+				word |= static_cast<uint64_t>(G.hasNode(v)) << (8 * (v - u));
+			}
+			payload.put(word);
+		}
+	}
+
+	payload.flush();
+	header.checksum = payload.getChecksum();
+	out.seekp(0);
+	out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+}
+
+} /* namespace NetworKit */
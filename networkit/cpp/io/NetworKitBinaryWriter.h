@@ -0,0 +1,39 @@
+/*
+ * NetworKitBinaryWriter.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef NETWORKITBINARYWRITER_H_
+#define NETWORKITBINARYWRITER_H_
+
+#include <string>
+
+#include "GraphWriter.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ * Writes graphs in the NetworKit binary format (see NetworKitBinaryGraph.h) that
+ * NetworKitBinaryReader loads without parsing. Weights, edge ids and deleted nodes are preserved.
+ *
+ * The file is written sequentially by one thread through a buffered stream, so writing is bounded
+ * by the speed of a single core or of the disk, whichever is lower.
+ */
+class NetworKitBinaryWriter: public GraphWriter {
+
+public:
+	NetworKitBinaryWriter() = default; //nullary constructor for Python shell
+
+	/**
+	 * Writes the graph @a G to the file at @a path.
+	 *
+	 * @param[in]	G	graph
+	 * @param[in]	path	output file path
+	 */
+	void write(const Graph& G, const std::string& path) override;
+};
+
+} /* namespace NetworKit */
+#endif /* NETWORKITBINARYWRITER_H_ */
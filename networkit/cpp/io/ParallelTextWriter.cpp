@@ -0,0 +1,127 @@
+/*
+ * ParallelTextWriter.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+
+#include "ParallelTextWriter.h"
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace NetworKit {
+
+namespace {
+
+/**
+ * Writes @a size bytes at @a offset, retrying partial writes.
+ * @return false if writing failed.
+ */
+bool writeAt(int fd, const char* data, uint64_t size, uint64_t offset) {
+	while (size > 0) {
+#ifdef _WIN32
+		// there are no positioned writes, the buffers are written in order instead
+		(void) offset;
+		const int written = _write(fd, data, static_cast<unsigned>(std::min<uint64_t>(size, 1 << 30)));
+#else
+		const ssize_t written = pwrite(fd, data, size, offset);
+#endif
+		if (written <= 0) {
+			return false;
+		}
+		data += written;
+		size -= written;
+		offset += written;
+	}
+	return true;
+}
+
+} // namespace
+
+const count ParallelTextWriter::chunkSize;
+
+ParallelTextWriter::ParallelTextWriter(const std::string& path) : offset(0), failed(false) {
+#ifdef _WIN32
+	fd = _open(path.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+	fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+#endif
+	if (fd < 0) {
+		throw std::runtime_error("Unable to open file " + path);
+	}
+}
+
+ParallelTextWriter::~ParallelTextWriter() {
+	if (fd >= 0) {
+#ifdef _WIN32
+		_close(fd);
+#else
+		::close(fd);
+#endif
+	}
+}
+
+void ParallelTextWriter::write(const std::string& text) {
+	failed = failed || !writeAt(fd, text.data(), text.size(), offset);
+	offset += text.size();
+}
+
+void ParallelTextWriter::writeBuffers(count used) {
+	std::vector<uint64_t> offsets(used + 1, offset);
+	for (index c = 0; c < used; ++c) {
+		offsets[c + 1] = offsets[c] + buffers[c].size();
+	}
+	bool roundFailed = false;
+#ifdef _WIN32
+	const bool parallel = false;
+#else
+	const bool parallel = true;
+#endif
+	#pragma omp parallel for schedule(dynamic, 1) reduction(||:roundFailed) if(parallel)
+	for (omp_index c = 0; c < static_cast<omp_index>(used); ++c) {
+		roundFailed = !writeAt(fd, buffers[c].data(), buffers[c].size(), offsets[c]) || roundFailed;
+	}
+	failed = failed || roundFailed;
+	offset = offsets[used];
+}
+
+void ParallelTextWriter::close() {
+	if (fd < 0) {
+		return;
+	}
+#ifdef _WIN32
+	failed = _close(fd) != 0 || failed;
+#else
+	failed = ::close(fd) != 0 || failed;
+#endif
+	fd = -1;
+	if (failed) {
+		throw std::runtime_error("Writing the file failed");
+	}
+}
+
+void ParallelTextWriter::appendDouble(std::string& buffer, double x) {
+	// "%g" prints integers below 10^6 without exponent, which covers the usual weights
+	if (x == std::floor(x) && std::abs(x) < 1e6 && !(x == 0 && std::signbit(x))) {
+		if (x < 0) {
+			buffer.push_back('-');
+		}
+		appendInteger(buffer, static_cast<uint64_t>(std::abs(x)));
+		return;
+	}
+	char text[32];
+	const int length = std::snprintf(text, sizeof(text), "%g", x);
+	buffer.append(text, length);
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,113 @@
+/*
+ * ParallelTextWriter.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef PARALLELTEXTWRITER_H_
+#define PARALLELTEXTWRITER_H_
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <omp.h>
+
+#include "../Globals.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ * Writes text files whose content is formatted in parallel. writeItems() splits the items into
+ * chunks which are formatted into private buffers by the threads and then written at their final
+ * offsets with positioned writes, so the file has the same bytes as if the items were written one
+ * after another. Only a bounded number of chunks is buffered at a time.
+ *
+ * The formatting functions produce the same text as writing to a std::ostream with default flags.
+ */
+class ParallelTextWriter {
+public:
+	/**
+	 * Creates or truncates the file at @a path and throws std::runtime_error if this fails.
+	 */
+	explicit ParallelTextWriter(const std::string& path);
+
+	~ParallelTextWriter();
+
+	ParallelTextWriter(const ParallelTextWriter&) = delete;
+	ParallelTextWriter& operator=(const ParallelTextWriter&) = delete;
+
+	/**
+	 * Appends @a text to the file.
+	 */
+	void write(const std::string& text);
+
+	/**
+	 * Appends the text of the items 0, ..., @a n - 1 in this order. @a format(i, buffer) is called in
+	 * parallel and appends the text of item i to the string @a buffer.
+	 */
+	template<typename F>
+	void writeItems(count n, F format);
+
+	/**
+	 * Closes the file and throws std::runtime_error if writing failed.
+	 */
+	void close();
+
+	/**
+	 * Appends the decimal representation of @a x to @a buffer.
+	 */
+	static void appendInteger(std::string& buffer, uint64_t x) {
+		char digits[20];
+		char* begin = digits + sizeof(digits);
+		do {
+			*--begin = static_cast<char>('0' + x % 10);
+			x /= 10;
+		} while (x);
+		buffer.append(begin, digits + sizeof(digits));
+	}
+
+	/**
+	 * Appends @a x to @a buffer as std::ostream formats doubles by default, i.e. like "%g".
+	 */
+	static void appendDouble(std::string& buffer, double x);
+
+private:
+	/**
+	 * Items per chunk of writeItems().
+	 */
+	static const count chunkSize = 1 << 12;
+
+	/**
+	 * Writes buffers[0], ..., buffers[@a used - 1] consecutively at the current offset.
+	 */
+	void writeBuffers(count used);
+
+	int fd;
+	uint64_t offset;
+	bool failed;
+	std::vector<std::string> buffers;
+};
+
+template<typename F>
+void ParallelTextWriter::writeItems(count n, F format) {
+	const count chunks = (n + chunkSize - 1) / chunkSize;
+	const count chunksPerRound = 4 * omp_get_max_threads();
+	buffers.resize(chunksPerRound);
+	for (index first = 0; first < chunks; first += chunksPerRound) {
+		const count used = std::min(chunksPerRound, chunks - first);
+		#pragma omp parallel for schedule(dynamic, 1)
+		for (omp_index c = 0; c < static_cast<omp_index>(used); ++c) {
+			std::string& buffer = buffers[c];
+			buffer.clear();
+			const index end = std::min(n, (first + c + 1) * chunkSize);
+			for (index i = (first + c) * chunkSize; i < end; ++i) {
+				format(i, buffer);
+			}
+		}
+		writeBuffers(used);
+	}
+}
+
+} /* namespace NetworKit */
+#endif /* PARALLELTEXTWRITER_H_ */
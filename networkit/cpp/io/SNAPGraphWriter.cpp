@@ -6,19 +6,25 @@
  */
 
 #include "SNAPGraphWriter.h"
-#include "../auxiliary/Enforce.h"
+#include "ParallelTextWriter.h"
 
 namespace NetworKit {
 
 void SNAPGraphWriter::write(const Graph& G, const std::string& path) {
-    std::ofstream file(path);
-    Aux::enforceOpened(file);
+    ParallelTextWriter file(path);
 
     // write "problem line" - n, m, directed/undirected, weighted/weight type
-    file << "p " << G.numberOfNodes() << " " << G.numberOfEdges() << " u u 0\n"; // FIXME: makeshift
+    file.write("p " + std::to_string(G.numberOfNodes()) + " " + std::to_string(G.numberOfEdges()) + " u u 0\n"); // FIXME: makeshift
 
-    G.forEdges([&](node u, node v){
-        file << u << " " << v << '\n';
+    // same order as forEdges()
+    file.writeItems(G.upperNodeIdBound(), [&](node u, std::string& buffer) {
+        G.forNeighborsOf(u, [&](node v) {
+            if (!G.isDirected() && v > u) return;
+            ParallelTextWriter::appendInteger(buffer, u);
+            buffer += ' ';
+            ParallelTextWriter::appendInteger(buffer, v);
+            buffer += '\n';
+        });
     });
 
     file.close();
@@ -0,0 +1,99 @@
+/*
+ * TextChunks.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef TEXTCHUNKS_H_
+#define TEXTCHUNKS_H_
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <vector>
+
+#include "../Globals.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ * Helpers to parse memory mapped text files in parallel: the file is split into chunks that
+ * start at the beginning of a line, so each thread can parse its chunks independently.
+ */
+namespace TextChunks {
+
+/**
+ * Splits [@a begin, @a end) into at most @a chunks pieces of about equal size, each starting at
+ * the beginning of a line.
+ * @return The boundaries, chunk i is [bounds[i], bounds[i+1]).
+ */
+inline std::vector<const char*> splitAtLines(const char* begin, const char* end, count chunks) {
+	const count size = end - begin;
+	chunks = std::max<count>(1, std::min(chunks, size));
+	std::vector<const char*> bounds(1, begin);
+	for (index i = 1; i < chunks; ++i) {
+		const char* pos = std::max(begin + size / chunks * i, bounds.back());
+		const char* lineBreak = static_cast<const char*>(std::memchr(pos, '\n', end - pos));
+		pos = lineBreak ? lineBreak + 1 : end;
+		if (pos != bounds.back()) {
+			bounds.push_back(pos);
+		}
+	}
+	if (bounds.back() != end || bounds.size() == 1) {
+		bounds.push_back(end);
+	}
+	return bounds;
+}
+
+/**
+ * Calls @a handle(lineBegin, lineEnd) for each line in [@a begin, @a end), excluding the line break
+ * and a trailing '\r'. A last line without line break is only passed if it is not empty.
+ */
+template<typename L>
+void forLines(const char* begin, const char* end, L handle) {
+	while (begin != end) {
+		const char* lineBreak = static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+		const char* next = lineBreak ? lineBreak + 1 : end;
+		const char* lineEnd = lineBreak ? lineBreak : end;
+		if (lineEnd != begin && lineEnd[-1] == '\r') {
+			--lineEnd;
+		}
+		handle(begin, lineEnd);
+		begin = next;
+	}
+}
+
+/**
+ * @return The number (starting at 1) of the line of the file starting at @a begin that contains @a pos.
+ */
+inline count lineNumber(const char* begin, const char* pos) {
+	return std::count(begin, pos, '\n') + 1;
+}
+
+/**
+ * Runs @a handle(chunk) for all chunks in parallel. Exceptions must not leave an OpenMP region,
+ * so the first exception thrown by any chunk is rethrown after all chunks have been processed.
+ */
+template<typename L>
+void parallelForChunks(count chunks, L handle) {
+	std::vector<std::exception_ptr> errors(chunks);
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (omp_index c = 0; c < static_cast<omp_index>(chunks); ++c) {
+		try {
+			handle(static_cast<index>(c));
+		} catch (...) {
+			errors[c] = std::current_exception();
+		}
+	}
+	for (const std::exception_ptr& error : errors) {
+		if (error) {
+			std::rethrow_exception(error);
+		}
+	}
+}
+
+} /* namespace TextChunks */
+
+} /* namespace NetworKit */
+#endif /* TEXTCHUNKS_H_ */
@@ -9,7 +9,10 @@
 
 #include "IOGTest.h"
 
+#include <algorithm>
 #include <fstream>
+#include <sstream>
+#include <tuple>
 #include <unordered_set>
 #include <vector>
 
@@ -25,6 +28,7 @@
 #include "../SNAPGraphReader.h"
 #include "../SNAPEdgeListPartitionReader.h"
 #include "../SNAPGraphWriter.h"
+#include "../ParallelTextWriter.h"
 #include "../EdgeListReader.h"
 #include "../KONECTGraphReader.h"
 #include "../GMLGraphWriter.h"
@@ -33,17 +37,22 @@
 #include "../CoverWriter.h"
 #include "../GMLGraphReader.h"
 #include "../GraphToolBinaryReader.h"
+#include "../../graph/test/GraphTestUtils.h"
 #include "../GraphToolBinaryWriter.h"
 #include "../ThrillGraphBinaryWriter.h"
 #include "../ThrillGraphBinaryReader.h"
+#include "../NetworKitBinaryReader.h"
+#include "../NetworKitBinaryWriter.h"
 #include "../BinaryPartitionWriter.h"
 #include "../BinaryPartitionReader.h"
 #include "../BinaryEdgeListPartitionWriter.h"
 #include "../BinaryEdgeListPartitionReader.h"
 #include "../../generators/ErdosRenyiGenerator.h"
+#include "../../graph/GraphTools.h"
 
 #include "../../community/GraphClusteringTools.h"
 #include "../../auxiliary/Log.h"
+#include "../../auxiliary/Random.h"
 #include "../../community/ClusteringGenerator.h"
 #include "../../structures/Partition.h"
 #include "../../community/Modularity.h"
@@ -372,6 +381,72 @@ TEST_F(IOGTest, testEdgeListReader) {
 
 }
 
+TEST_F(IOGTest, testParallelTextReaders) {
+	// the chunks of the file must not change the graph
+	auto readWithThreads = [](GraphReader& reader, const std::string& path, int threads) {
+		return GraphTestUtils::withThreads(threads, [&]() { return reader.read(path); });
+	};
+	auto expectSameEdges = [](const Graph& G, const Graph& H) {
+		ASSERT_EQ(G.numberOfNodes(), H.numberOfNodes());
+		EXPECT_EQ(G.numberOfEdges(), H.numberOfEdges());
+		EXPECT_EQ(G.numberOfSelfLoops(), H.numberOfSelfLoops());
+		G.forEdges([&](node u, node v, edgeweight w) {
+			EXPECT_TRUE(H.hasEdge(u, v));
+			EXPECT_EQ(w, H.weight(u, v));
+		});
+	};
+
+	METISGraphReader metis;
+	Graph G = readWithThreads(metis, "input/PGPgiantcompo.graph", 1);
+	EXPECT_EQ(10680u, G.numberOfNodes());
+	EXPECT_EQ(24316u, G.numberOfEdges());
+	expectSameEdges(G, readWithThreads(metis, "input/PGPgiantcompo.graph", 7));
+
+	// duplicates (also in the other direction) keep the weight of their first occurrence
+	std::string path = "output/parallel.edgelist";
+	{
+		std::ofstream file(path);
+		file << "# comment\n";
+		for (node u = 1; u <= 200; ++u) {
+			file << u << " " << (u % 200) + 1 << " " << u << "\r\n";
+			file << "\n# comment\n";
+			file << (u % 200) + 1 << " " << u << " " << 1000 << "\n";
+		}
+		file << "7 7 7";
+	}
+	EdgeListReader edgeList(' ', 1);
+	Graph H = readWithThreads(edgeList, path, 1);
+	EXPECT_EQ(200u, H.numberOfNodes());
+	EXPECT_EQ(201u, H.numberOfEdges());
+	EXPECT_EQ(1u, H.numberOfSelfLoops());
+	H.forEdges([&](node u, node v, edgeweight w) {
+		if (u != v) {
+			// the first occurrence of {u, v} is the line of the smaller file id, except for {200, 1}
+			EXPECT_EQ(std::max(u, v) == 199 && std::min(u, v) == 0 ? 200 : std::min(u, v) + 1, w);
+		}
+	});
+	expectSameEdges(H, readWithThreads(edgeList, path, 7));
+
+	EdgeListReader directedEdgeList(' ', 1, "#", true, true);
+	Graph D = readWithThreads(directedEdgeList, path, 3);
+	EXPECT_EQ(401u, D.numberOfEdges());
+	EXPECT_EQ(2.0, D.weight(1, 2));
+	EXPECT_EQ(1000.0, D.weight(2, 1));
+
+	// the order of the neighbors only depends on the file
+	using GraphTestUtils::adjacencies;
+	EXPECT_EQ(adjacencies(H), adjacencies(readWithThreads(edgeList, path, 1)));
+	EXPECT_EQ(adjacencies(H), adjacencies(readWithThreads(edgeList, path, 7)));
+	EXPECT_EQ(adjacencies(D), adjacencies(readWithThreads(directedEdgeList, path, 3)));
+	EXPECT_EQ(adjacencies(D), adjacencies(readWithThreads(directedEdgeList, path, 5)));
+
+	{
+		std::ofstream file(path);
+		file << "1 2\n2 x\n";
+	}
+	EXPECT_THROW(edgeList.read(path), std::runtime_error);
+}
+
 TEST_F(IOGTest, testEdgeListPartitionReader) {
 	EdgeListPartitionReader reader(1);
 
@@ -518,6 +593,101 @@ TEST_F(IOGTest, testSNAPGraphWriter) {
 	EXPECT_TRUE(exists) << "graph file should have been written to: " << path;
 }
 
+TEST_F(IOGTest, testParallelTextWritersMatchStreams) {
+	for (double x : {0.0, -0.0, 1.0, -3.0, 0.5, 1.0 / 3, 123456.0, 999999.0, 1e6, -2.5e-7, 1e300}) {
+		std::string formatted;
+		ParallelTextWriter::appendDouble(formatted, x);
+		std::ostringstream expected;
+		expected << x;
+		EXPECT_EQ(expected.str(), formatted);
+	}
+
+	auto readFile = [](const std::string& path) {
+		std::ifstream file(path, std::ios::binary);
+		std::stringstream content;
+		content << file.rdbuf();
+		return content.str();
+	};
+
+	// several chunks of nodes, deleted nodes and fractional weights
+	for (bool directed : {false, true}) {
+		Graph G = ErdosRenyiGenerator(10000, 0.001, directed).generate();
+		G = Graph(G, true, directed);
+		G.forEdges([&](node u, node v) {
+			G.setWeight(u, v, 0.5 + (u * 7 + v) % 11 / 3.0);
+		});
+		G.removeNode(17);
+		G.removeNode(5000);
+
+		std::ostringstream edgeList;
+		G.forEdges([&](node u, node v, edgeweight w) {
+			edgeList << (u + 1) << '\t' << (v + 1) << '\t' << w << std::endl;
+		});
+		EdgeListWriter('\t', 1, false).write(G, "output/parallel.edgelist");
+		EXPECT_EQ(edgeList.str(), readFile("output/parallel.edgelist"));
+
+		std::ostringstream bothDirections;
+		G.forNodes([&](node u) {
+			G.forEdgesOf(u, [&](node u, node v, edgeweight w) {
+				bothDirections << u << ' ' << v << ' ' << w << std::endl;
+			});
+		});
+		EdgeListWriter(' ', 0, true).write(G, "output/parallel.edgelist");
+		EXPECT_EQ(bothDirections.str(), readFile("output/parallel.edgelist"));
+
+		std::ostringstream snap;
+		snap << "p " << G.numberOfNodes() << " " << G.numberOfEdges() << " u u 0\n";
+		G.forEdges([&](node u, node v) {
+			snap << u << " " << v << '\n';
+		});
+		SNAPGraphWriter().write(G, "output/parallel.snap");
+		EXPECT_EQ(snap.str(), readFile("output/parallel.snap"));
+
+		std::ostringstream gml;
+		gml << "graph [\n";
+		if (directed) {
+			gml << "  directed 1\n";
+		}
+		G.forNodes([&](node u) {
+			gml << "  node [\n" << "    id " << u << "\n" << "  ]\n";
+		});
+		G.forEdges([&](node u, node v) {
+			gml << "  edge [\n" << "    source " << u << "\n" << "    target " << v << "\n" << "  ]\n";
+		});
+		gml << "]\n";
+		GMLGraphWriter().write(G, "output/parallel.gml");
+		EXPECT_EQ(gml.str(), readFile("output/parallel.gml"));
+
+		std::ostringstream dot;
+		dot << "graph {\n";
+		G.forEdges([&](node u, node v) {
+			dot << u << " -- " << v << ";\n";
+		});
+		dot << "}\n";
+		DotGraphWriter().write(G, "output/parallel.dot");
+		EXPECT_EQ(dot.str(), readFile("output/parallel.dot"));
+
+		if (!directed) {
+			for (bool weighted : {false, true}) {
+				std::ostringstream metis;
+				metis << G.numberOfNodes() << " " << G.numberOfEdges() << " " << int{weighted} << '\n';
+				auto nodeIds = GraphTools::getContinuousNodeIds(G);
+				G.forNodes([&](node u) {
+					G.forNeighborsOf(u, [&](node v, edgeweight w) {
+						metis << nodeIds[v] + 1 << " ";
+						if (weighted) {
+							metis << w << "\t";
+						}
+					});
+					metis << '\n';
+				});
+				METISGraphWriter().write(G, weighted, "output/parallel.graph");
+				EXPECT_EQ(metis.str(), readFile("output/parallel.graph"));
+			}
+		}
+	}
+}
+
 TEST_F(IOGTest, debugReadingMETISFile) {
 	std::string graphPath;
 	std::cout << "[INPUT] graph file path >" << std::endl;
@@ -726,6 +896,73 @@ TEST_F(IOGTest, testThrillGraphBinaryWriterAndReader) {
 	EXPECT_EQ(diff.getEdits().size(), 0);
 }
 
+TEST_F(IOGTest, testNetworKitBinaryWriterAndReader) {
+	std::string path = "output/test.nkbg";
+	auto expectSameGraph = [&](const Graph& G, const Graph& H) {
+		ASSERT_EQ(G.upperNodeIdBound(), H.upperNodeIdBound());
+		EXPECT_EQ(G.numberOfNodes(), H.numberOfNodes());
+		EXPECT_EQ(G.numberOfEdges(), H.numberOfEdges());
+		EXPECT_EQ(G.numberOfSelfLoops(), H.numberOfSelfLoops());
+		EXPECT_EQ(G.isDirected(), H.isDirected());
+		EXPECT_EQ(G.isWeighted(), H.isWeighted());
+		EXPECT_EQ(G.hasEdgeIds(), H.hasEdgeIds());
+		EXPECT_EQ(G.upperEdgeIdBound(), H.upperEdgeIdBound());
+		G.forNodes([&](node u) {
+			ASSERT_TRUE(H.hasNode(u));
+			// the edges have to be stored in the same order
+			std::vector<std::tuple<node, edgeweight, edgeid>> expected, actual;
+			G.forEdgesOf(u, [&](node, node v, edgeweight w, edgeid eid) {
+				expected.emplace_back(v, w, eid);
+			});
+			H.forEdgesOf(u, [&](node, node v, edgeweight w, edgeid eid) {
+				actual.emplace_back(v, w, eid);
+			});
+			EXPECT_EQ(expected, actual);
+			EXPECT_EQ(G.degreeIn(u), H.degreeIn(u));
+			G.forInNeighborsOf(u, [&](node v) {
+				EXPECT_TRUE(H.hasEdge(v, u));
+			});
+		});
+	};
+
+	for (bool directed : {false, true}) {
+		for (bool weighted : {false, true}) {
+			Graph G = ErdosRenyiGenerator(200, 0.05, directed).generate();
+			if (weighted) {
+				G = Graph(G, true, directed);
+				G.forEdges([&](node u, node v) {
+					G.setWeight(u, v, Aux::Random::real());
+				});
+			}
+			G.addEdge(3, 3);
+			G.removeNode(17);
+			std::pair<node, node> e = G.randomEdge();
+			G.removeEdge(e.first, e.second);
+			if (directed) {
+				G.indexEdges();
+			}
+
+			NetworKitBinaryWriter().write(G, path);
+			Graph H = NetworKitBinaryReader().read(path);
+			expectSameGraph(G, H);
+		}
+	}
+
+	// empty graph
+	NetworKitBinaryWriter().write(Graph(0), path);
+	EXPECT_EQ(NetworKitBinaryReader().read(path).upperNodeIdBound(), 0u);
+
+	// corrupt a neighbor, the checksum has to detect it
+	Graph G = ErdosRenyiGenerator(100, 0.1, false).generate();
+	NetworKitBinaryWriter().write(G, path);
+	{
+		std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+		file.seekp(64 + 8 * (G.upperNodeIdBound() + 1));
+		file.put(char(0x7F));
+	}
+	EXPECT_THROW(NetworKitBinaryReader().read(path), std::runtime_error);
+}
+
 TEST_F(IOGTest, testBinaryPartitionWriterAndReader) {
 	Partition P(5);
 	P.setUpperBound((1ull<<32));
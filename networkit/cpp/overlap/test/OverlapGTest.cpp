@@ -93,8 +93,8 @@ TEST_F(OverlapGTest, testHashingOverlapperForCorrectness) {
 	std::vector<Partition> clusterings = {zeta, eta};
 	HashingOverlapper overlapper;
 	Partition overlap = overlapper.run(G, clusterings);
-	std::vector<node> overlapping_comparison = {0, 1, 2, 3};
-	std::vector<node> overlapping_origin = overlap.getVector();
+	std::vector<index> overlapping_comparison = {0, 1, 2, 3};
+	std::vector<index> overlapping_origin = overlap.getVector();
 	EXPECT_EQ(overlap.numberOfSubsets(), 4);
 	EXPECT_TRUE(std::is_permutation(overlapping_origin.begin(),overlapping_origin.end(),overlapping_comparison.begin()));
 }
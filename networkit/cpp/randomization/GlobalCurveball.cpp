@@ -35,7 +35,8 @@ void GlobalCurveball::run() {
 
     auto& prng = Aux::Random::getURNG();
 
-    CurveballDetails::GlobalTradeSequence<CurveballDetails::FixedLinearCongruentialMap<node> > hash{
+    // the map multiplies values below 2^31, which needs 64 bit arithmetic also for 32 bit node ids
+    CurveballDetails::GlobalTradeSequence<CurveballDetails::FixedLinearCongruentialMap<uint64_t> > hash{
         impl->getInputGraph().numberOfNodes(), numGlobalTrades, prng};
     impl->run(hash);
 
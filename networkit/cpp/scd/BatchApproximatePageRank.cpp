@@ -0,0 +1,120 @@
+/*
+ * BatchApproximatePageRank.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include <algorithm>
+#include <queue>
+#include <sstream>
+#include <stdexcept>
+
+#include "BatchApproximatePageRank.h"
+
+namespace NetworKit {
+
+BatchApproximatePageRank::BatchApproximatePageRank(const Graph& G, std::vector<node> seeds, double alpha, double epsilon, count k) :
+		G(G), seeds(std::move(seeds)), alpha(alpha), eps(epsilon), k(k) {
+}
+
+void BatchApproximatePageRank::run() {
+	for (node seed : seeds) {
+		if (!G.hasNode(seed)) {
+			throw std::runtime_error("Seed is not a node of the graph");
+		}
+	}
+
+	const count z = G.upperNodeIdBound();
+	std::vector<edgeweight> volume(z, 0.0);
+	G.parallelForNodes([&](node u) {
+		volume[u] = G.volume(u);
+	});
+
+	topNodes.assign(seeds.size(), std::vector<std::pair<node, double>>());
+
+	#pragma omp parallel
+	{
+		// the entries of a node are valid for the seed that has touched it last
+		std::vector<double> estimate(z);
+		std::vector<double> residual(z);
+		std::vector<index> touchedBy(z, none);
+		std::vector<node> touched;
+		std::queue<node> activeNodes;
+		std::vector<std::pair<node, double>> candidates;
+
+		#pragma omp for schedule(dynamic)
+		for (omp_index s = 0; s < static_cast<omp_index>(seeds.size()); ++s) {
+			auto touch = [&](node v) {
+				if (touchedBy[v] != static_cast<index>(s)) {
+					touchedBy[v] = s;
+					estimate[v] = 0.0;
+					residual[v] = 0.0;
+					touched.push_back(v);
+				}
+			};
+
+			// the pushes are the same as in ApproximatePageRank
+			const node seed = seeds[s];
+			touch(seed);
+			residual[seed] = 1.0;
+			activeNodes.push(seed);
+
+			while (!activeNodes.empty()) {
+				const node u = activeNodes.front();
+				activeNodes.pop();
+
+				const double res = residual[u];
+				G.forNeighborsOf(u, [&](node, node v, edgeweight w) {
+					touch(v);
+					double mass = (1.0 - alpha) * res * w / (2.0 * volume[u]);
+					// the first check is for making sure the node is not added twice.
+					// the second check ensures that enough residual is left.
+					if (residual[v] < volume[v] * eps && (residual[v] + mass) >= eps * volume[v]) {
+						activeNodes.push(v);
+					}
+					residual[v] += mass;
+				});
+
+				estimate[u] += alpha * res;
+				residual[u] = (1.0 - alpha) * res / 2;
+				if ((residual[u] / volume[u]) >= eps) {
+					activeNodes.push(u);
+				}
+			}
+
+			// select the nodes with the highest estimates, the smaller node on ties
+			candidates.clear();
+			for (node v : touched) {
+				if (estimate[v] > 0.0) {
+					candidates.emplace_back(v, estimate[v]);
+				}
+			}
+			touched.clear();
+			auto higher = [](const std::pair<node, double>& a, const std::pair<node, double>& b) {
+				return a.second > b.second || (a.second == b.second && a.first < b.first);
+			};
+			const count kept = std::min<count>(k, candidates.size());
+			std::partial_sort(candidates.begin(), candidates.begin() + kept, candidates.end(), higher);
+			topNodes[s].assign(candidates.begin(), candidates.begin() + kept);
+		}
+	}
+
+	hasRun = true;
+}
+
+const std::vector<std::vector<std::pair<node, double>>>& BatchApproximatePageRank::getTopNodes() const {
+	assureFinished();
+	return topNodes;
+}
+
+std::string BatchApproximatePageRank::toString() const {
+	std::stringstream stream;
+	stream << "BatchApproximatePageRank(" << alpha << "," << eps << "," << k << ")";
+	return stream.str();
+}
+
+bool BatchApproximatePageRank::isParallel() const {
+	return true;
+}
+
+} /* namespace NetworKit */
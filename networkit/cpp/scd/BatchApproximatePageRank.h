@@ -0,0 +1,61 @@
+/*
+ * BatchApproximatePageRank.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef BATCHAPPROXIMATEPAGERANK_H_
+#define BATCHAPPROXIMATEPAGERANK_H_
+
+#include <vector>
+#include "../graph/Graph.h"
+#include "../base/Algorithm.h"
+
+namespace NetworKit {
+
+/**
+ * Computes the approximate PageRank vectors of many seeds, see ApproximatePageRank, and keeps the @a k nodes
+ * with the highest approximate PageRank of every seed.
+ *
+ * The seeds are distributed dynamically over the threads. Every thread keeps its estimate and residual
+ * vectors for all seeds and only initializes the entries a seed touches, so a seed takes time proportional
+ * to its pushes and there is no hashing. This needs 24 bytes per node and thread.
+ */
+class BatchApproximatePageRank : public Algorithm {
+public:
+	/**
+	 * @param G Graph for which the approximate PageRank vectors are computed.
+	 * @param seeds The seeds.
+	 * @param alpha Loop probability of random walk.
+	 * @param epsilon Error tolerance.
+	 * @param k Number of nodes to keep per seed.
+	 */
+	BatchApproximatePageRank(const Graph& G, std::vector<node> seeds, double alpha, double epsilon = 1e-12, count k = 10);
+
+	/**
+	 * Computes the approximate PageRank vectors of all seeds.
+	 */
+	void run() override;
+
+	/**
+	 * @return For every seed in the order of the seeds, the at most @a k nodes with the highest positive
+	 *         approximate PageRank and their approximate PageRank, in decreasing order of it.
+	 */
+	const std::vector<std::vector<std::pair<node, double>>>& getTopNodes() const;
+
+	std::string toString() const override;
+
+	bool isParallel() const override;
+
+private:
+	const Graph& G;
+	std::vector<node> seeds;
+	double alpha;
+	double eps;
+	count k;
+
+	std::vector<std::vector<std::pair<node, double>>> topNodes;
+};
+
+} /* namespace NetworKit */
+#endif /* BATCHAPPROXIMATEPAGERANK_H_ */
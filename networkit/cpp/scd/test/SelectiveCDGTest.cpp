@@ -1,6 +1,8 @@
 #include "SelectiveCDGTest.h"
 
 #include "../PageRankNibble.h"
+#include "../ApproximatePageRank.h"
+#include "../BatchApproximatePageRank.h"
 #include "../GCE.h"
 #include "../../community/Modularity.h"
 #include "../../community/Conductance.h"
@@ -8,6 +10,7 @@
 #include "../../io/METISGraphReader.h"
 #include "../../auxiliary/Log.h"
 
+#include <algorithm>
 #include <memory>
 
 #ifndef NOGTEST
@@ -56,6 +59,46 @@ TEST_F(SCDGTest2, testSCD) {
 }
 
 
+TEST_F(SCDGTest2, testBatchApproximatePageRank) {
+	METISGraphReader reader;
+	Graph G = reader.read("input/hep-th.graph");
+	double alpha = 0.1;
+	double epsilon = 1e-5;
+	count k = 20;
+
+	std::vector<node> seeds;
+	for (node seed = 0; seed < G.upperNodeIdBound(); seed += 97) {
+		if (G.degree(seed) > 0) {
+			seeds.push_back(seed);
+		}
+	}
+
+	BatchApproximatePageRank batch(G, seeds, alpha, epsilon, k);
+	batch.run();
+	auto topNodes = batch.getTopNodes();
+	ASSERT_EQ(seeds.size(), topNodes.size());
+
+	// every seed gets the same pushes as in ApproximatePageRank
+	for (index i = 0; i < seeds.size(); ++i) {
+		ApproximatePageRank apr(G, alpha, epsilon);
+		std::vector<std::pair<node, double>> expected = apr.run(seeds[i]);
+		expected.erase(std::remove_if(expected.begin(), expected.end(), [](const std::pair<node, double>& entry) {
+			return entry.second <= 0.0;
+		}), expected.end());
+		std::sort(expected.begin(), expected.end(), [](const std::pair<node, double>& a, const std::pair<node, double>& b) {
+			return a.second > b.second || (a.second == b.second && a.first < b.first);
+		});
+		expected.resize(std::min<count>(k, expected.size()));
+
+		ASSERT_EQ(expected.size(), topNodes[i].size());
+		EXPECT_GT(topNodes[i].size(), 0u);
+		for (index j = 0; j < expected.size(); ++j) {
+			EXPECT_EQ(expected[j].first, topNodes[i][j].first);
+			EXPECT_DOUBLE_EQ(expected[j].second, topNodes[i][j].second);
+		}
+	}
+}
+
 } /* namespace NetworKit */
 
 #endif /*NOGTEST */
@@ -18,7 +18,7 @@ Partition::Partition() : z(0), omega(0), data(0) {
 }
 
 
-Partition::Partition(const std::vector<index>& data) : z(data.size()), omega(), data(data) {
+Partition::Partition(const std::vector<index>& data) : z(data.size()), omega(), data(data.begin(), data.end()) {
 	auto max_elem = *std::max_element(data.begin(), data.end());
 	this->omega = (max_elem == none) ? 0 : max_elem;
 }
@@ -91,7 +91,7 @@ count Partition::numberOfSubsets() const {
 void Partition::compact(bool useTurbo) {
 	index i = 0;
 	if (!useTurbo) {
-		std::vector<index> usedIds(data);
+		std::vector<index> usedIds(data.begin(), data.end());
 		Aux::Parallel::sort(usedIds.begin(), usedIds.end());
 		auto last = std::unique(usedIds.begin(), usedIds.end());
 		usedIds.erase(last, usedIds.end());
@@ -151,7 +151,7 @@ std::set<index> Partition::getMembers(const index s) const {
 }
 
 std::vector<index> Partition::getVector() const {
-	return this->data; //FIXME is this appropriate? - why not?
+	return std::vector<index>(data.begin(), data.end());
 }
 
 
@@ -23,6 +23,9 @@ namespace NetworKit {
  * @ingroup structures
  * Implements a partition of a set, i.e. a subdivision of the
  * set into disjoint subsets.
+ *
+ * The subset ids are stored with the width of node ids, so with NETWORKIT_NODE32 a partition of the
+ * nodes takes 4 bytes per node; the ids (and the number of elements) must then stay below none.
  */
 class Partition {
 
@@ -56,7 +59,7 @@ public:
 	 *
 	 *  @param[in]	e	an element
 	 */
-	inline index& operator [](const index& e) {
+	inline node& operator [](const index& e) {
 		return this->data[e];
 	}
 	/**
@@ -64,7 +67,7 @@ public:
 	 *
 	 * @param[in]	e	an element
 	 */
-	inline const index& operator [](const index& e) const {
+	inline const node& operator [](const index& e) const {
 		return this->data[e];
 	}
 
@@ -315,7 +318,7 @@ public:
 private:
 	index z;	//!< maximum element index that can be mapped
 	index omega;	//!< maximum subset index ever assigned
-	std::vector<index> data;  	//!< data container, indexed by element index, containing subset index
+	std::vector<node> data;  	//!< data container, indexed by element index, containing subset index
 	std::string name;
 
 	/**
@@ -323,6 +326,7 @@ private:
 	 */
 	inline index newSubsetId() {
 		index s = ++omega;
+		assert(s < none);
 		return s;
 	}
 };
@@ -10,6 +10,7 @@
 #include "../algebraic/CSRMatrix.h"
 #include "../algebraic/Vector.h"
 
+#include "../auxiliary/PrioQueue.h"
 #include "../auxiliary/Random.h"
 
 #include "../distance/BFS.h"
@@ -4,7 +4,7 @@ from _NetworKit import (METISGraphReader, METISGraphWriter, DotGraphWriter, Edge
 						GraphToolBinaryReader, DGSStreamParser, GraphUpdater, SNAPEdgeListPartitionReader, \
 						SNAPGraphReader, EdgeListReader, CoverReader, CoverWriter, EdgeListCoverReader, \
 						KONECTGraphReader, GMLGraphReader, MultipleEdgesHandling, ThrillGraphBinaryReader, \
-						ThrillGraphBinaryWriter)
+						ThrillGraphBinaryWriter, NetworKitBinaryReader, NetworKitBinaryWriter)
 from _NetworKit import Graph as __Graph
 # local imports
 from .GraphMLIO import GraphMLReader, GraphMLWriter
@@ -38,7 +38,8 @@ try:
 	class Format(__AutoNumber):
 		""" Simple enumeration class to list supported file types. Currently supported
 		file types: SNAP, EdgeListSpaceZero, EdgeListSpaceOne, EdgeListTabZero, EdgeListTabOne,
-		METIS, GraphML, GEXF, GML, EdgeListCommaOne, GraphViz, DOT, EdgeList, LFR, KONEC, GraphToolBinary"""
+		METIS, GraphML, GEXF, GML, EdgeListCommaOne, GraphViz, DOT, EdgeList, LFR, KONEC, GraphToolBinary,
+		NetworKitBinary"""
 		SNAP = ()
 		EdgeListSpaceZero = ()
 		EdgeListSpaceOne = ()
@@ -57,6 +58,7 @@ try:
 		GraphToolBinary = ()
 		MAT = ()
 		ThrillBinary = ()
+		NetworKitBinary = ()
 
 except ImportError:
 	print("Update to Python >=3.4 recommended - support for < 3.4 may be discontinued in the future")
@@ -79,6 +81,7 @@ except ImportError:
 		GraphToolBinary = "gtbin"
 		MAT = "mat"
 		ThrillBinary = "thrillbinary"
+		NetworKitBinary = "nkbg"
 
 
 
@@ -104,6 +107,7 @@ def getReader(fileformat, **kwargs):
 			Format.GraphToolBinary:		GraphToolBinaryReader(),
 			Format.MAT:			MatReader(),
 			Format.ThrillBinary:		ThrillGraphBinaryReader(),
+			Format.NetworKitBinary:		NetworKitBinaryReader(),
 			}
 
 	try:
@@ -124,7 +128,8 @@ def readGraph(path, fileformat, **kwargs):
 	    Parameters:
 		- fileformat: An element of the Format enumeration. Currently supported file types:
 		SNAP, EdgeListSpaceZero, EdgeListSpaceOne, EdgeListTabZero, EdgeListTabOne, METIS,
-		GraphML, GEXF, GML, EdgeListCommaOne, GraphViz, DOT, EdgeList, LFR, KONECT, GraphToolBinary, ThrillBinary
+		GraphML, GEXF, GML, EdgeListCommaOne, GraphViz, DOT, EdgeList, LFR, KONECT, GraphToolBinary, ThrillBinary,
+		NetworKitBinary
 		- **kwargs: in case of a custom edge list, pass the genereic Fromat.EdgeList accompanied by
 			the defining paramaters as follows:
 			"separator=CHAR, firstNode=NODE, commentPrefix=STRING, continuous=BOOL, directed=BOOL"
@@ -236,7 +241,8 @@ def getWriter(fileformat, **kwargs):
 			Format.DOT:			DotGraphWriter(),
 			Format.GML:			GMLGraphWriter(),
 			Format.LFR:			EdgeListWriter('\t',1),
-			Format.GraphToolBinary:		GraphToolBinaryWriter()
+			Format.GraphToolBinary:		GraphToolBinaryWriter(),
+			Format.NetworKitBinary:		NetworKitBinaryWriter()
 			}
 	try:
 		# special case for custom Edge Lists
@@ -1,2 +1,2 @@
 # extension imports
-from _NetworKit import PageRankNibble, GCE
\ No newline at end of file
+from _NetworKit import PageRankNibble, GCE, BatchApproximatePageRank
\ No newline at end of file